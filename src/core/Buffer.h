@@ -81,4 +81,26 @@ struct Buffer {
 		return Data;
 	}
 };
+
+/**
+ * @brief 只读的数据视图
+ *
+ * 指向别处持有的一段内存（例如映射的 GPU 缓冲），不拥有数据，有效期由提供方说明。
+ */
+struct BufferView {
+	const uint8_t* Data = nullptr;
+	uint64_t Size = 0;
+
+	BufferView() = default;
+	BufferView(const void* data, uint64_t size)
+		: Data(static_cast<const uint8_t*>(data)), Size(size) {}
+
+	template<typename T>
+	const T* As() const {
+		return reinterpret_cast<const T*>(Data);
+	}
+	operator bool() const {
+		return Data;
+	}
+};
 }
\ No newline at end of file
@@ -7,9 +7,18 @@
     #else
         #error "x86 Builds are not supported"
     #endif
-#else   
+#elif defined(__linux__)
+    // 仅用于无窗口的构建服务器：通过 EGL 创建离屏 OpenGL 上下文，见 platform/headless
+    #define PLATFORM_LINUX
+#else
     #error "Unknown platform"
 #endif
+
+#ifdef _MSC_VER
+    #define DEBUG_BREAK() __debugbreak()
+#else
+    #define DEBUG_BREAK() __builtin_trap()
+#endif
 //BUG: non-negative number
 template<typename T>
 constexpr auto BIT(T x) { return 1 << x; }
@@ -21,8 +30,8 @@ constexpr auto BIT(T x) { return 1 << x; }
 //std::bind(&fn, this, std::placeholders::_1)
 //ASSERT 仅在 Debug 模式或显式开启 ASSERTS_ENABLE 时有效
 #ifdef ASSERTS_ENABLE
-	#define ASSERT(x, ...) { if(!(x)) { LOG_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak(); } }
-	#define ASSERT_ENGINE(x, ...) { if(!(x)) { LOG_ERROR_ENGINE("Assertion Failed: {0}", __VA_ARGS__); __debugbreak(); } }
+	#define ASSERT(x, ...) { if(!(x)) { LOG_ERROR("Assertion Failed: {0}", __VA_ARGS__); DEBUG_BREAK(); } }
+	#define ASSERT_ENGINE(x, ...) { if(!(x)) { LOG_ERROR_ENGINE("Assertion Failed: {0}", __VA_ARGS__); DEBUG_BREAK(); } }
 #else
 	#define ASSERT(x, ...)
 	#define ASSERT_ENGINE(x, ...)
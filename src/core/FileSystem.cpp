@@ -64,4 +64,18 @@ bool FileSystem::WriteFileText(const std::filesystem::path& filepath, const std:
 	}
 	return true;
 }
+
+bool FileSystem::WriteFileBinary(const std::filesystem::path& filepath, BufferView data) {
+	std::ofstream out(filepath, std::ios::out | std::ios::binary);
+	if (!out) {
+		LOG_ERROR_ENGINE("Could not open file '{0}' for writing", filepath.string());
+		return false;
+	}
+	out.write(reinterpret_cast<const char*>(data.Data), data.Size);
+	if (!out) {
+		LOG_ERROR_ENGINE("Could not write to file '{0}'", filepath.string());
+		return false;
+	}
+	return true;
+}
 }
\ No newline at end of file
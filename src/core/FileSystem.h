@@ -11,5 +11,6 @@ public:
 	static Buffer ReadFileBinary(const std::filesystem::path& filepath);
 	static std::string ReadFileText(const std::filesystem::path& filepath);
 	static bool WriteFileText(const std::filesystem::path& filepath, const std::string& content);
+	static bool WriteFileBinary(const std::filesystem::path& filepath, BufferView data);
 };
 }
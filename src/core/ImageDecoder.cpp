@@ -0,0 +1,803 @@
+#include "core/ImageDecoder.h"
+#include "core/Inflate.h"
+#include "core/Log.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <emmintrin.h>
+
+// pshufb 需要 SSSE3；MSVC 在 /arch:AVX2 下定义 __AVX2__，不单独定义 __SSSE3__
+#if defined(__SSSE3__) || defined(__AVX2__)
+#define GE_IMAGE_DECODER_SSSE3 1
+#include <tmmintrin.h>
+#endif
+
+namespace GE {
+
+static inline uint32_t ReadBigEndian32(const uint8_t* p) {
+	return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16)
+		| (static_cast<uint32_t>(p[2]) << 8) | static_cast<uint32_t>(p[3]);
+}
+
+static inline uint16_t ReadBigEndian16(const uint8_t* p) {
+	return static_cast<uint16_t>((p[0] << 8) | p[1]);
+}
+
+static constexpr uint8_t s_PngSignature[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+static constexpr uint8_t s_QoiMagic[4] = { 'q', 'o', 'i', 'f' };
+static constexpr size_t s_QoiHeaderSize = 14;
+static constexpr size_t s_QoiEndMarkerSize = 8;
+
+// ==================== 通道转换 ====================
+
+// 整数近似的 Rec.601 亮度，权重之和为 256
+static inline uint8_t Luminance(uint8_t r, uint8_t g, uint8_t b) {
+	return static_cast<uint8_t>((r * 77 + g * 150 + b * 29 + 128) >> 8);
+}
+
+void ImageDecoder::ConvertChannels(const uint8_t* src, uint32_t srcChannels, uint8_t* dst, uint32_t dstChannels, size_t pixelCount) {
+	if (srcChannels == dstChannels) {
+		memcpy(dst, src, pixelCount * srcChannels);
+		return;
+	}
+	size_t i = 0;
+	if (srcChannels == 1 && dstChannels == 4) {
+		// 16 个灰度值一组：先与自身交错得到 (g, g)，与 255 交错得到 (g, a)，再按 16 位交错得到 (g, g, g, a)
+		const __m128i alpha = _mm_set1_epi8(static_cast<char>(0xFF));
+		for (; i + 16 <= pixelCount; i += 16) {
+			const __m128i gray = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+			const __m128i grayGray0 = _mm_unpacklo_epi8(gray, gray);
+			const __m128i grayGray1 = _mm_unpackhi_epi8(gray, gray);
+			const __m128i grayAlpha0 = _mm_unpacklo_epi8(gray, alpha);
+			const __m128i grayAlpha1 = _mm_unpackhi_epi8(gray, alpha);
+			__m128i* out = reinterpret_cast<__m128i*>(dst + i * 4);
+			_mm_storeu_si128(out + 0, _mm_unpacklo_epi16(grayGray0, grayAlpha0));
+			_mm_storeu_si128(out + 1, _mm_unpackhi_epi16(grayGray0, grayAlpha0));
+			_mm_storeu_si128(out + 2, _mm_unpacklo_epi16(grayGray1, grayAlpha1));
+			_mm_storeu_si128(out + 3, _mm_unpackhi_epi16(grayGray1, grayAlpha1));
+		}
+	}
+#if GE_IMAGE_DECODER_SSSE3
+	else if (srcChannels == 3 && dstChannels == 4) {
+		// 每次读 16 字节、使用其中 12 字节 (4 个像素)，剩余至少 6 个像素时才不会读越界
+		const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -128, 3, 4, 5, -128, 6, 7, 8, -128, 9, 10, 11, -128);
+		const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000));
+		for (; i + 6 <= pixelCount; i += 4) {
+			const __m128i rgb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 3));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), _mm_or_si128(_mm_shuffle_epi8(rgb, shuffle), alpha));
+		}
+	} else if (srcChannels == 4 && dstChannels == 3) {
+		// 每次写 16 字节、有效 12 字节，同样要求剩余至少 6 个像素
+		const __m128i shuffle = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -128, -128, -128, -128);
+		for (; i + 6 <= pixelCount; i += 4) {
+			const __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 3), _mm_shuffle_epi8(rgba, shuffle));
+		}
+	} else if (srcChannels == 2 && dstChannels == 4) {
+		const __m128i shuffleLow = _mm_setr_epi8(0, 0, 0, 1, 2, 2, 2, 3, 4, 4, 4, 5, 6, 6, 6, 7);
+		const __m128i shuffleHigh = _mm_setr_epi8(8, 8, 8, 9, 10, 10, 10, 11, 12, 12, 12, 13, 14, 14, 14, 15);
+		for (; i + 8 <= pixelCount; i += 8) {
+			const __m128i grayAlpha = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 2));
+			__m128i* out = reinterpret_cast<__m128i*>(dst + i * 4);
+			_mm_storeu_si128(out + 0, _mm_shuffle_epi8(grayAlpha, shuffleLow));
+			_mm_storeu_si128(out + 1, _mm_shuffle_epi8(grayAlpha, shuffleHigh));
+		}
+	}
+#endif
+	// 剩余像素与其他组合
+	for (; i < pixelCount; ++i) {
+		const uint8_t* s = src + i * srcChannels;
+		uint8_t* d = dst + i * dstChannels;
+		const bool srcColor = srcChannels >= 3;
+		const uint8_t r = s[0];
+		const uint8_t g = srcColor ? s[1] : s[0];
+		const uint8_t b = srcColor ? s[2] : s[0];
+		const uint8_t a = (srcChannels == 2 || srcChannels == 4) ? s[srcChannels - 1] : 255;
+		switch (dstChannels) {
+			case 1: d[0] = srcColor ? Luminance(r, g, b) : r; break;
+			case 2: d[0] = srcColor ? Luminance(r, g, b) : r; d[1] = a; break;
+			case 3: d[0] = r; d[1] = g; d[2] = b; break;
+			case 4: d[0] = r; d[1] = g; d[2] = b; d[3] = a; break;
+		}
+	}
+}
+
+// ==================== Alpha 预乘 ====================
+
+// 对 [0, 255 * 255] 内的值精确地计算 round(x / 255)
+static inline __m128i DivideBy255(__m128i x) {
+	x = _mm_add_epi16(x, _mm_set1_epi16(128));
+	return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+// sRGB 与线性空间的换算表。线性 -> sRGB 使用 4096 级，比 8 位 sRGB 在暗部的最小间隔更细，a = 255 时往返无损
+struct SrgbTables {
+	static constexpr uint32_t LinearSteps = 4096;
+	float ToLinear[256];
+	uint8_t FromLinear[LinearSteps];
+
+	SrgbTables() {
+		for (uint32_t i = 0; i < 256; ++i) {
+			const float c = static_cast<float>(i) / 255.0f;
+			ToLinear[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+		}
+		for (uint32_t i = 0; i < LinearSteps; ++i) {
+			const float l = static_cast<float>(i) / static_cast<float>(LinearSteps - 1);
+			const float c = l <= 0.0031308f ? l * 12.92f : 1.055f * std::pow(l, 1.0f / 2.4f) - 0.055f;
+			FromLinear[i] = static_cast<uint8_t>(c * 255.0f + 0.5f);
+		}
+	}
+};
+
+static const SrgbTables& GetSrgbTables() {
+	static const SrgbTables s_Tables;
+	return s_Tables;
+}
+
+void ImageDecoder::PremultiplyAlpha(uint8_t* pixels, uint32_t channels, size_t pixelCount, bool srgb) {
+	if (channels != 2 && channels != 4) {
+		return;
+	}
+	const uint32_t colorChannels = channels - 1;
+	if (srgb) {
+		const SrgbTables& tables = GetSrgbTables();
+		for (size_t i = 0; i < pixelCount; ++i) {
+			uint8_t* p = pixels + i * channels;
+			const uint8_t alpha = p[colorChannels];
+			if (alpha == 255) {
+				continue;
+			}
+			const float scale = alpha / 255.0f * (SrgbTables::LinearSteps - 1);
+			for (uint32_t c = 0; c < colorChannels; ++c) {
+				p[c] = tables.FromLinear[static_cast<uint32_t>(tables.ToLinear[p[c]] * scale + 0.5f)];
+			}
+		}
+		return;
+	}
+
+	size_t i = 0;
+	if (channels == 4) {
+		// 4 个像素一组扩展到 16 位，乘以广播后的 Alpha（Alpha 通道自身乘 255），再精确除以 255
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i alphaLane = _mm_setr_epi16(0, 0, 0, -1, 0, 0, 0, -1);
+		const __m128i alphaScale = _mm_setr_epi16(0, 0, 0, 255, 0, 0, 0, 255);
+		for (; i + 4 <= pixelCount; i += 4) {
+			__m128i* p = reinterpret_cast<__m128i*>(pixels + i * 4);
+			const __m128i rgba = _mm_loadu_si128(p);
+			__m128i halves[2] = { _mm_unpacklo_epi8(rgba, zero), _mm_unpackhi_epi8(rgba, zero) };
+			for (__m128i& half : halves) {
+				__m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(half, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+				alpha = _mm_or_si128(_mm_andnot_si128(alphaLane, alpha), alphaScale);
+				half = DivideBy255(_mm_mullo_epi16(half, alpha));
+			}
+			_mm_storeu_si128(p, _mm_packus_epi16(halves[0], halves[1]));
+		}
+	}
+	for (; i < pixelCount; ++i) {
+		uint8_t* p = pixels + i * channels;
+		const uint32_t alpha = p[colorChannels];
+		for (uint32_t c = 0; c < colorChannels; ++c) {
+			const uint32_t x = p[c] * alpha + 128;
+			p[c] = static_cast<uint8_t>((x + (x >> 8)) >> 8);
+		}
+	}
+}
+
+void ImageDecoder::FlipVertically(uint8_t* pixels, uint32_t width, uint32_t height, uint32_t channels) {
+	const size_t rowSize = static_cast<size_t>(width) * channels;
+	std::vector<uint8_t> temp(rowSize);
+	for (uint32_t y = 0; y < height / 2; ++y) {
+		uint8_t* top = pixels + y * rowSize;
+		uint8_t* bottom = pixels + (height - 1 - y) * rowSize;
+		memcpy(temp.data(), top, rowSize);
+		memcpy(top, bottom, rowSize);
+		memcpy(bottom, temp.data(), rowSize);
+	}
+}
+
+// ==================== 缩小 ====================
+
+Buffer ImageDecoder::Downsample(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t channels, bool srgb) {
+	const SrgbTables& tables = GetSrgbTables();
+	const uint32_t dstWidth = std::max(1u, width / 2);
+	const uint32_t dstHeight = std::max(1u, height / 2);
+	Buffer result(static_cast<uint64_t>(dstWidth) * dstHeight * channels);
+	uint8_t* dst = result.Data;
+	for (uint32_t y = 0; y < dstHeight; ++y) {
+		const uint32_t y0 = std::min(y * 2, height - 1);
+		const uint32_t y1 = std::min(y * 2 + 1, height - 1);
+		for (uint32_t x = 0; x < dstWidth; ++x) {
+			const uint32_t x0 = std::min(x * 2, width - 1);
+			const uint32_t x1 = std::min(x * 2 + 1, width - 1);
+			const uint8_t* p00 = pixels + (static_cast<size_t>(y0) * width + x0) * channels;
+			const uint8_t* p01 = pixels + (static_cast<size_t>(y0) * width + x1) * channels;
+			const uint8_t* p10 = pixels + (static_cast<size_t>(y1) * width + x0) * channels;
+			const uint8_t* p11 = pixels + (static_cast<size_t>(y1) * width + x1) * channels;
+			uint8_t* out = dst + (static_cast<size_t>(y) * dstWidth + x) * channels;
+			for (uint32_t c = 0; c < channels; ++c) {
+				// 灰度+Alpha 与 RGBA 的最后一个通道是 Alpha，始终是线性的
+				const bool alpha = (channels == 2 || channels == 4) && c + 1 == channels;
+				if (srgb && !alpha) {
+					const float l = (tables.ToLinear[p00[c]] + tables.ToLinear[p01[c]] + tables.ToLinear[p10[c]] + tables.ToLinear[p11[c]]) * 0.25f;
+					out[c] = tables.FromLinear[static_cast<uint32_t>(l * (SrgbTables::LinearSteps - 1) + 0.5f)];
+				} else {
+					out[c] = static_cast<uint8_t>((p00[c] + p01[c] + p10[c] + p11[c] + 2) / 4);
+				}
+			}
+		}
+	}
+	return result;
+}
+
+// ==================== PNG 反滤波 ====================
+// Sub/Average/Paeth 依赖同一行左侧已还原的像素，无法跨像素并行；
+// bpp 为 3/4 时改为一次处理一个像素的全部通道，Up 没有行内依赖，16 字节一组
+
+enum PngFilter : uint8_t {
+	PngFilterNone = 0,
+	PngFilterSub,
+	PngFilterUp,
+	PngFilterAverage,
+	PngFilterPaeth
+};
+
+static inline uint8_t PaethPredictor(int a, int b, int c) {
+	const int p = a + b - c;
+	const int pa = std::abs(p - a);
+	const int pb = std::abs(p - b);
+	const int pc = std::abs(p - c);
+	if (pa <= pb && pa <= pc) {
+		return static_cast<uint8_t>(a);
+	}
+	return static_cast<uint8_t>(pb <= pc ? b : c);
+}
+
+template<uint32_t Bpp>
+static inline __m128i LoadPixel(const uint8_t* p) {
+	int32_t value = 0;
+	memcpy(&value, p, Bpp);
+	return _mm_cvtsi32_si128(value);
+}
+
+template<uint32_t Bpp>
+static inline void StorePixel(uint8_t* p, __m128i v) {
+	const int32_t value = _mm_cvtsi128_si32(v);
+	memcpy(p, &value, Bpp);
+}
+
+static inline __m128i AbsInt16(__m128i x) {
+	return _mm_max_epi16(x, _mm_sub_epi16(_mm_setzero_si128(), x));
+}
+
+static inline __m128i Select(__m128i mask, __m128i a, __m128i b) {
+	return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+template<uint32_t Bpp>
+static void UnfilterPixels(uint8_t filter, uint8_t* row, const uint8_t* prev, size_t size) {
+	const __m128i zero = _mm_setzero_si128();
+	__m128i a = zero; // 左侧像素（已还原）
+	if (filter == PngFilterSub) {
+		for (size_t i = 0; i < size; i += Bpp) {
+			a = _mm_add_epi8(LoadPixel<Bpp>(row + i), a);
+			StorePixel<Bpp>(row + i, a);
+		}
+	} else if (filter == PngFilterAverage) {
+		// _mm_avg_epu8 向上取整，PNG 要求向下取整，两者在 a + b 为奇数时差 1
+		const __m128i one = _mm_set1_epi8(1);
+		for (size_t i = 0; i < size; i += Bpp) {
+			const __m128i b = LoadPixel<Bpp>(prev + i);
+			const __m128i average = _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+			a = _mm_add_epi8(LoadPixel<Bpp>(row + i), average);
+			StorePixel<Bpp>(row + i, a);
+		}
+	} else {
+		// Paeth：在 16 位下计算 |b - c|、|a - c|、|a + b - 2c|，平局时依次优先 a、b、c
+		__m128i c = zero;
+		for (size_t i = 0; i < size; i += Bpp) {
+			const __m128i b = _mm_unpacklo_epi8(LoadPixel<Bpp>(prev + i), zero);
+			__m128i x = _mm_unpacklo_epi8(LoadPixel<Bpp>(row + i), zero);
+			const __m128i pa = _mm_sub_epi16(b, c);
+			const __m128i pb = _mm_sub_epi16(a, c);
+			const __m128i pc = AbsInt16(_mm_add_epi16(pa, pb));
+			const __m128i absPa = AbsInt16(pa);
+			const __m128i absPb = AbsInt16(pb);
+			const __m128i smallest = _mm_min_epi16(pc, _mm_min_epi16(absPa, absPb));
+			const __m128i predictor = Select(_mm_cmpeq_epi16(absPa, smallest), a,
+				Select(_mm_cmpeq_epi16(absPb, smallest), b, c));
+			x = _mm_and_si128(_mm_add_epi16(x, predictor), _mm_set1_epi16(0xFF));
+			StorePixel<Bpp>(row + i, _mm_packus_epi16(x, x));
+			a = x;
+			c = b;
+		}
+	}
+}
+
+static bool UnfilterRow(uint8_t filter, uint8_t* row, const uint8_t* prev, size_t size, uint32_t bpp) {
+	switch (filter) {
+		case PngFilterNone:
+			return true;
+		case PngFilterUp: {
+			size_t i = 0;
+			for (; i + 16 <= size; i += 16) {
+				__m128i* p = reinterpret_cast<__m128i*>(row + i);
+				_mm_storeu_si128(p, _mm_add_epi8(_mm_loadu_si128(p), _mm_loadu_si128(reinterpret_cast<const __m128i*>(prev + i))));
+			}
+			for (; i < size; ++i) {
+				row[i] = static_cast<uint8_t>(row[i] + prev[i]);
+			}
+			return true;
+		}
+		case PngFilterSub:
+		case PngFilterAverage:
+		case PngFilterPaeth:
+			if (bpp == 4) {
+				UnfilterPixels<4>(filter, row, prev, size);
+				return true;
+			}
+			if (bpp == 3) {
+				UnfilterPixels<3>(filter, row, prev, size);
+				return true;
+			}
+			break;
+		default:
+			return false;
+	}
+
+	// 其他 bpp 的标量路径；每行前 bpp 个字节的左侧像素视为 0
+	const size_t first = bpp < size ? bpp : size;
+	if (filter == PngFilterSub) {
+		for (size_t i = bpp; i < size; ++i) {
+			row[i] = static_cast<uint8_t>(row[i] + row[i - bpp]);
+		}
+	} else if (filter == PngFilterAverage) {
+		for (size_t i = 0; i < first; ++i) {
+			row[i] = static_cast<uint8_t>(row[i] + (prev[i] >> 1));
+		}
+		for (size_t i = bpp; i < size; ++i) {
+			row[i] = static_cast<uint8_t>(row[i] + ((row[i - bpp] + prev[i]) >> 1));
+		}
+	} else {
+		for (size_t i = 0; i < first; ++i) {
+			row[i] = static_cast<uint8_t>(row[i] + prev[i]);
+		}
+		for (size_t i = bpp; i < size; ++i) {
+			row[i] = static_cast<uint8_t>(row[i] + PaethPredictor(row[i - bpp], prev[i], prev[i - bpp]));
+		}
+	}
+	return true;
+}
+
+// ==================== PNG ====================
+
+struct PngState {
+	uint32_t Width = 0;
+	uint32_t Height = 0;
+	uint32_t BitDepth = 0;
+	uint32_t ColorType = 0;
+	bool Interlaced = false;
+	uint32_t Samples = 0;          // 每像素的采样数
+	uint32_t DecodedChannels = 0;  // 展开调色板、加入 tRNS Alpha 之后的通道数
+
+	uint8_t Palette[256 * 4] = {};
+	uint32_t PaletteSize = 0;
+	bool HasPaletteAlpha = false;
+	bool HasColorKey = false;      // 灰度 / RGB 图片的 tRNS：等于此值的像素完全透明
+	uint16_t ColorKey[3] = {};
+};
+
+static bool ValidatePngFormat(uint32_t colorType, uint32_t bitDepth, uint32_t& samples) {
+	switch (colorType) {
+		case 0: samples = 1; return bitDepth == 1 || bitDepth == 2 || bitDepth == 4 || bitDepth == 8 || bitDepth == 16;
+		case 2: samples = 3; return bitDepth == 8 || bitDepth == 16;
+		case 3: samples = 1; return bitDepth == 1 || bitDepth == 2 || bitDepth == 4 || bitDepth == 8;
+		case 4: samples = 2; return bitDepth == 8 || bitDepth == 16;
+		case 6: samples = 4; return bitDepth == 8 || bitDepth == 16;
+	}
+	return false;
+}
+
+// 解析文件头与辅助块；idat 为 nullptr 时遇到第一个 IDAT 即返回（只读取信息）
+static bool ParsePng(const uint8_t* data, size_t size, PngState& state, std::vector<uint8_t>* idat) {
+	if (size < sizeof(s_PngSignature) || memcmp(data, s_PngSignature, sizeof(s_PngSignature)) != 0) {
+		LOG_ERROR_ENGINE("PNG: invalid signature");
+		return false;
+	}
+	size_t offset = sizeof(s_PngSignature);
+	bool headerSeen = false;
+	bool dataSeen = false;
+	while (offset + 12 <= size) {
+		const uint32_t length = ReadBigEndian32(data + offset);
+		const uint8_t* type = data + offset + 4;
+		const uint8_t* chunk = data + offset + 8;
+		if (length > size - offset - 12) {
+			LOG_ERROR_ENGINE("PNG: truncated chunk");
+			return false;
+		}
+		if (memcmp(type, "IHDR", 4) == 0) {
+			if (length != 13) {
+				LOG_ERROR_ENGINE("PNG: invalid IHDR chunk");
+				return false;
+			}
+			state.Width = ReadBigEndian32(chunk);
+			state.Height = ReadBigEndian32(chunk + 4);
+			state.BitDepth = chunk[8];
+			state.ColorType = chunk[9];
+			state.Interlaced = chunk[12] == 1;
+			if (state.Width == 0 || state.Height == 0
+				|| state.Width > ImageDecoder::MaxDimension || state.Height > ImageDecoder::MaxDimension) {
+				LOG_ERROR_ENGINE("PNG: unsupported image size {0}x{1}", state.Width, state.Height);
+				return false;
+			}
+			if (!ValidatePngFormat(state.ColorType, state.BitDepth, state.Samples)
+				|| chunk[10] != 0 || chunk[11] != 0 || chunk[12] > 1) {
+				LOG_ERROR_ENGINE("PNG: invalid format (color type {0}, bit depth {1})", state.ColorType, state.BitDepth);
+				return false;
+			}
+			headerSeen = true;
+		} else if (!headerSeen) {
+			LOG_ERROR_ENGINE("PNG: first chunk is not IHDR");
+			return false;
+		} else if (memcmp(type, "PLTE", 4) == 0) {
+			state.PaletteSize = length / 3;
+			if (state.PaletteSize > 256 || length % 3 != 0) {
+				LOG_ERROR_ENGINE("PNG: invalid PLTE chunk");
+				return false;
+			}
+			for (uint32_t i = 0; i < state.PaletteSize; ++i) {
+				state.Palette[i * 4 + 0] = chunk[i * 3 + 0];
+				state.Palette[i * 4 + 1] = chunk[i * 3 + 1];
+				state.Palette[i * 4 + 2] = chunk[i * 3 + 2];
+				state.Palette[i * 4 + 3] = 255;
+			}
+		} else if (memcmp(type, "tRNS", 4) == 0) {
+			if (state.ColorType == 3) {
+				if (length > state.PaletteSize) {
+					LOG_ERROR_ENGINE("PNG: invalid tRNS chunk");
+					return false;
+				}
+				for (uint32_t i = 0; i < length; ++i) {
+					state.Palette[i * 4 + 3] = chunk[i];
+				}
+				state.HasPaletteAlpha = true;
+			} else if (state.ColorType == 0 || state.ColorType == 2) {
+				if (length != state.Samples * 2) {
+					LOG_ERROR_ENGINE("PNG: invalid tRNS chunk");
+					return false;
+				}
+				for (uint32_t i = 0; i < state.Samples; ++i) {
+					state.ColorKey[i] = ReadBigEndian16(chunk + i * 2);
+				}
+				state.HasColorKey = true;
+			}
+		} else if (memcmp(type, "IDAT", 4) == 0) {
+			dataSeen = true;
+			if (!idat) {
+				break;
+			}
+			idat->insert(idat->end(), chunk, chunk + length);
+		} else if (memcmp(type, "IEND", 4) == 0) {
+			break;
+		}
+		offset += 12 + static_cast<size_t>(length);
+	}
+	if (!headerSeen || !dataSeen) {
+		LOG_ERROR_ENGINE("PNG: missing IHDR or IDAT chunk");
+		return false;
+	}
+	if (state.ColorType == 3 && state.PaletteSize == 0) {
+		LOG_ERROR_ENGINE("PNG: missing PLTE chunk");
+		return false;
+	}
+	if (state.ColorType == 3) {
+		state.DecodedChannels = state.HasPaletteAlpha ? 4 : 3;
+	} else {
+		state.DecodedChannels = state.Samples + (state.HasColorKey ? 1 : 0);
+	}
+	return true;
+}
+
+static inline uint32_t ReadPackedSample(const uint8_t* row, size_t index, uint32_t bitDepth) {
+	const size_t bit = index * bitDepth;
+	const uint32_t shift = 8 - bitDepth - static_cast<uint32_t>(bit & 7);
+	return (row[bit >> 3] >> shift) & ((1u << bitDepth) - 1);
+}
+
+// 把一行反滤波后的数据展开为每通道 8 位的 DecodedChannels 通道像素。
+// 8 位且无调色板、无 tRNS 时数据已是目标格式，直接返回原行
+static const uint8_t* ExpandRow(const PngState& state, const uint8_t* row, uint32_t width, uint8_t* out) {
+	const uint32_t bitDepth = state.BitDepth;
+	if (bitDepth == 8 && state.ColorType != 3 && !state.HasColorKey) {
+		return row;
+	}
+	const uint32_t channels = state.DecodedChannels;
+	if (state.ColorType == 3) {
+		for (uint32_t x = 0; x < width; ++x) {
+			const uint32_t index = bitDepth == 8 ? row[x] : ReadPackedSample(row, x, bitDepth);
+			memcpy(out + x * channels, state.Palette + index * 4, channels);
+		}
+		return out;
+	}
+	// 低位深灰度按比例放大到 0..255：1 位 x255，2 位 x85，4 位 x17
+	const uint32_t scale = bitDepth < 8 ? 255 / ((1u << bitDepth) - 1) : 1;
+	const uint32_t samples = state.Samples;
+	for (uint32_t x = 0; x < width; ++x) {
+		bool transparent = state.HasColorKey;
+		for (uint32_t c = 0; c < samples; ++c) {
+			const size_t index = static_cast<size_t>(x) * samples + c;
+			uint32_t value;
+			uint8_t value8;
+			if (bitDepth == 16) {
+				value = ReadBigEndian16(row + index * 2);
+				value8 = static_cast<uint8_t>(value >> 8);
+			} else if (bitDepth == 8) {
+				value = row[index];
+				value8 = static_cast<uint8_t>(value);
+			} else {
+				value = ReadPackedSample(row, index, bitDepth);
+				value8 = static_cast<uint8_t>(value * scale);
+			}
+			transparent = transparent && value == state.ColorKey[c];
+			out[x * channels + c] = value8;
+		}
+		if (state.HasColorKey) {
+			out[x * channels + samples] = transparent ? 0 : 255;
+		}
+	}
+	return out;
+}
+
+// Adam7 隔行的 7 个子图：起始位置与步长
+static constexpr uint32_t s_Adam7StartX[7] = { 0, 4, 0, 2, 0, 1, 0 };
+static constexpr uint32_t s_Adam7StartY[7] = { 0, 0, 4, 0, 2, 0, 1 };
+static constexpr uint32_t s_Adam7StepX[7] = { 8, 8, 4, 4, 2, 2, 1 };
+static constexpr uint32_t s_Adam7StepY[7] = { 8, 8, 8, 4, 4, 2, 2 };
+
+struct PngPass {
+	uint32_t StartX = 0, StartY = 0, StepX = 1, StepY = 1;
+	uint32_t Width = 0, Height = 0;
+};
+
+static uint32_t GetPngPasses(const PngState& state, PngPass passes[7]) {
+	if (!state.Interlaced) {
+		passes[0].Width = state.Width;
+		passes[0].Height = state.Height;
+		return 1;
+	}
+	for (uint32_t i = 0; i < 7; ++i) {
+		PngPass& pass = passes[i];
+		pass.StartX = s_Adam7StartX[i];
+		pass.StartY = s_Adam7StartY[i];
+		pass.StepX = s_Adam7StepX[i];
+		pass.StepY = s_Adam7StepY[i];
+		pass.Width = state.Width > pass.StartX ? (state.Width - pass.StartX + pass.StepX - 1) / pass.StepX : 0;
+		pass.Height = state.Height > pass.StartY ? (state.Height - pass.StartY + pass.StepY - 1) / pass.StepY : 0;
+	}
+	return 7;
+}
+
+bool ImageDecoder::DecodePNG(const uint8_t* data, size_t size, const ImageDecodeOptions& options, Image& image) {
+	PngState state;
+	std::vector<uint8_t> compressed;
+	if (!ParsePng(data, size, state, &compressed)) {
+		return false;
+	}
+
+	PngPass passes[7];
+	const uint32_t passCount = GetPngPasses(state, passes);
+	const uint32_t bitsPerPixel = state.Samples * state.BitDepth;
+	const uint32_t bytesPerPixel = bitsPerPixel >= 8 ? bitsPerPixel / 8 : 1;
+	auto rowBytes = [&](uint32_t width) { return (static_cast<size_t>(width) * bitsPerPixel + 7) / 8; };
+	size_t filteredSize = 0;
+	for (uint32_t i = 0; i < passCount; ++i) {
+		if (passes[i].Width && passes[i].Height) {
+			filteredSize += (rowBytes(passes[i].Width) + 1) * passes[i].Height;
+		}
+	}
+
+	Buffer filtered(filteredSize);
+	size_t inflatedSize = 0;
+	if (!Inflate::DecompressZlib(compressed.data(), compressed.size(), filtered.Data, filteredSize, inflatedSize)
+		|| inflatedSize != filteredSize) {
+		LOG_ERROR_ENGINE("PNG: corrupt image data");
+		return false;
+	}
+
+	const uint32_t outChannels = options.DesiredChannels ? options.DesiredChannels : state.DecodedChannels;
+	ASSERT_ENGINE(outChannels <= 4, "ImageDecoder: DesiredChannels must be 0..4");
+	const size_t outRowSize = static_cast<size_t>(state.Width) * outChannels;
+	image.Width = state.Width;
+	image.Height = state.Height;
+	image.Channels = outChannels;
+	image.Pixels.Allocate(outRowSize * state.Height);
+
+	std::vector<uint8_t> zeroRow(rowBytes(state.Width), 0);
+	std::vector<uint8_t> expanded(static_cast<size_t>(state.Width) * 4);
+	std::vector<uint8_t> converted(state.Interlaced ? outRowSize : 0);
+	uint8_t* source = filtered.Data;
+	for (uint32_t p = 0; p < passCount; ++p) {
+		const PngPass& pass = passes[p];
+		if (!pass.Width || !pass.Height) {
+			continue;
+		}
+		const size_t rowSize = rowBytes(pass.Width);
+		const uint8_t* prev = zeroRow.data();
+		for (uint32_t y = 0; y < pass.Height; ++y) {
+			uint8_t* row = source + 1;
+			if (!UnfilterRow(source[0], row, prev, rowSize, bytesPerPixel)) {
+				LOG_ERROR_ENGINE("PNG: invalid filter type {0}", source[0]);
+				image = Image();
+				return false;
+			}
+			const uint8_t* pixels = ExpandRow(state, row, pass.Width, expanded.data());
+			if (!state.Interlaced) {
+				ConvertChannels(pixels, state.DecodedChannels, image.Pixels.Data + y * outRowSize, outChannels, pass.Width);
+			} else {
+				ConvertChannels(pixels, state.DecodedChannels, converted.data(), outChannels, pass.Width);
+				uint8_t* dst = image.Pixels.Data + (pass.StartY + y * pass.StepY) * outRowSize + pass.StartX * outChannels;
+				for (uint32_t x = 0; x < pass.Width; ++x) {
+					memcpy(dst + static_cast<size_t>(x) * pass.StepX * outChannels, converted.data() + x * outChannels, outChannels);
+				}
+			}
+			prev = row;
+			source += rowSize + 1;
+		}
+	}
+
+	if (options.PremultiplyAlpha) {
+		PremultiplyAlpha(image.Pixels.Data, outChannels, static_cast<size_t>(state.Width) * state.Height, options.SRGB);
+	}
+	if (options.FlipVertically) {
+		FlipVertically(image.Pixels.Data, image.Width, image.Height, outChannels);
+	}
+	return true;
+}
+
+// ==================== QOI ====================
+
+static inline uint32_t QoiHash(const uint8_t* rgba) {
+	return (rgba[0] * 3 + rgba[1] * 5 + rgba[2] * 7 + rgba[3] * 11) & 63;
+}
+
+bool ImageDecoder::DecodeQOI(const uint8_t* data, size_t size, const ImageDecodeOptions& options, Image& image) {
+	if (size < s_QoiHeaderSize + s_QoiEndMarkerSize || memcmp(data, s_QoiMagic, sizeof(s_QoiMagic)) != 0) {
+		LOG_ERROR_ENGINE("QOI: invalid header");
+		return false;
+	}
+	const uint32_t width = ReadBigEndian32(data + 4);
+	const uint32_t height = ReadBigEndian32(data + 8);
+	const uint32_t fileChannels = data[12];
+	if (width == 0 || height == 0 || width > MaxDimension || height > MaxDimension
+		|| (fileChannels != 3 && fileChannels != 4)) {
+		LOG_ERROR_ENGINE("QOI: unsupported image ({0}x{1}, {2} channels)", width, height, fileChannels);
+		return false;
+	}
+
+	const uint32_t outChannels = options.DesiredChannels ? options.DesiredChannels : fileChannels;
+	ASSERT_ENGINE(outChannels <= 4, "ImageDecoder: DesiredChannels must be 0..4");
+	const size_t pixelCount = static_cast<size_t>(width) * height;
+	image.Width = width;
+	image.Height = height;
+	image.Channels = outChannels;
+	image.Pixels.Allocate(pixelCount * outChannels);
+	// 输出为 RGBA 时直接解码到结果中，否则先解码到临时 RGBA 缓冲区再转换
+	Buffer rgbaStorage(outChannels == 4 ? 0 : pixelCount * 4);
+	uint8_t* out = outChannels == 4 ? image.Pixels.Data : rgbaStorage.Data;
+
+	uint8_t index[64 * 4] = {};
+	uint8_t px[4] = { 0, 0, 0, 255 };
+	uint32_t run = 0;
+	size_t p = s_QoiHeaderSize;
+	const size_t end = size - s_QoiEndMarkerSize;
+	bool truncated = false;
+	for (size_t i = 0; i < pixelCount; ++i) {
+		if (run > 0) {
+			--run;
+		} else {
+			if (p >= end) {
+				truncated = true;
+				break;
+			}
+			const uint8_t b1 = data[p++];
+			if (b1 == 0xFE) { // QOI_OP_RGB
+				if (p + 3 > end) {
+					truncated = true;
+					break;
+				}
+				px[0] = data[p]; px[1] = data[p + 1]; px[2] = data[p + 2];
+				p += 3;
+			} else if (b1 == 0xFF) { // QOI_OP_RGBA
+				if (p + 4 > end) {
+					truncated = true;
+					break;
+				}
+				memcpy(px, data + p, 4);
+				p += 4;
+			} else if ((b1 & 0xC0) == 0x00) { // QOI_OP_INDEX
+				memcpy(px, index + b1 * 4, 4);
+			} else if ((b1 & 0xC0) == 0x40) { // QOI_OP_DIFF
+				px[0] = static_cast<uint8_t>(px[0] + ((b1 >> 4) & 3) - 2);
+				px[1] = static_cast<uint8_t>(px[1] + ((b1 >> 2) & 3) - 2);
+				px[2] = static_cast<uint8_t>(px[2] + (b1 & 3) - 2);
+			} else if ((b1 & 0xC0) == 0x80) { // QOI_OP_LUMA
+				if (p >= end) {
+					truncated = true;
+					break;
+				}
+				const uint8_t b2 = data[p++];
+				const int vg = (b1 & 0x3F) - 32;
+				px[0] = static_cast<uint8_t>(px[0] + vg - 8 + ((b2 >> 4) & 0x0F));
+				px[1] = static_cast<uint8_t>(px[1] + vg);
+				px[2] = static_cast<uint8_t>(px[2] + vg - 8 + (b2 & 0x0F));
+			} else { // QOI_OP_RUN
+				run = b1 & 0x3F;
+			}
+			memcpy(index + QoiHash(px) * 4, px, 4);
+		}
+		memcpy(out + i * 4, px, 4);
+	}
+	if (truncated) {
+		LOG_ERROR_ENGINE("QOI: truncated image data");
+		image = Image();
+		return false;
+	}
+
+	if (outChannels != 4) {
+		ConvertChannels(out, 4, image.Pixels.Data, outChannels, pixelCount);
+	}
+	if (options.PremultiplyAlpha) {
+		PremultiplyAlpha(image.Pixels.Data, outChannels, pixelCount, options.SRGB);
+	}
+	if (options.FlipVertically) {
+		FlipVertically(image.Pixels.Data, width, height, outChannels);
+	}
+	return true;
+}
+
+// ==================== 入口 ====================
+
+ImageFileFormat ImageDecoder::DetectFormat(const uint8_t* data, size_t size) {
+	if (size >= sizeof(s_PngSignature) && memcmp(data, s_PngSignature, sizeof(s_PngSignature)) == 0) {
+		return ImageFileFormat::PNG;
+	}
+	if (size >= sizeof(s_QoiMagic) && memcmp(data, s_QoiMagic, sizeof(s_QoiMagic)) == 0) {
+		return ImageFileFormat::QOI;
+	}
+	return ImageFileFormat::Unknown;
+}
+
+bool ImageDecoder::ReadInfo(const uint8_t* data, size_t size, ImageInfo& info) {
+	info = ImageInfo();
+	switch (DetectFormat(data, size)) {
+		case ImageFileFormat::PNG: {
+			PngState state;
+			if (!ParsePng(data, size, state, nullptr)) {
+				return false;
+			}
+			info = { ImageFileFormat::PNG, state.Width, state.Height, state.DecodedChannels };
+			return true;
+		}
+		case ImageFileFormat::QOI:
+			if (size < s_QoiHeaderSize) {
+				return false;
+			}
+			info = { ImageFileFormat::QOI, ReadBigEndian32(data + 4), ReadBigEndian32(data + 8), data[12] };
+			return info.Width && info.Height && (info.Channels == 3 || info.Channels == 4);
+		case ImageFileFormat::Unknown:
+			break;
+	}
+	return false;
+}
+
+bool ImageDecoder::Decode(const uint8_t* data, size_t size, const ImageDecodeOptions& options, Image& image) {
+	switch (DetectFormat(data, size)) {
+		case ImageFileFormat::PNG:     return DecodePNG(data, size, options, image);
+		case ImageFileFormat::QOI:     return DecodeQOI(data, size, options, image);
+		case ImageFileFormat::Unknown: break;
+	}
+	LOG_ERROR_ENGINE("ImageDecoder: unrecognized image format");
+	return false;
+}
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "core/Buffer.h"
+
+namespace GE {
+
+enum class ImageFileFormat {
+	Unknown = 0,
+	PNG,
+	QOI
+};
+
+struct ImageDecodeOptions {
+	// 输出通道数 1..4（灰度 / 灰度+Alpha / RGB / RGBA），0 表示保持文件中的通道数
+	uint32_t DesiredChannels = 4;
+	// 颜色通道乘以 Alpha（仅对带 Alpha 的输出生效）
+	bool PremultiplyAlpha = false;
+	// 颜色值按 sRGB 编码处理：预乘在线性空间中进行，再编码回 sRGB
+	bool SRGB = true;
+	// 上下翻转，使第一行成为图片底部（OpenGL 纹理坐标原点在左下角）
+	bool FlipVertically = false;
+};
+
+// 只读取文件头即可得到的信息
+struct ImageInfo {
+	ImageFileFormat Format = ImageFileFormat::Unknown;
+	uint32_t Width = 0;
+	uint32_t Height = 0;
+	uint32_t Channels = 0; // 文件本身的通道数（调色板图片视 tRNS 为 3 或 4）
+};
+
+// 解码结果：每通道 8 位、行与行之间紧密排列，可以直接交给 Texture::SetData
+struct Image {
+	uint32_t Width = 0;
+	uint32_t Height = 0;
+	uint32_t Channels = 0;
+	Buffer Pixels;
+
+	operator bool() const { return Pixels; }
+};
+
+/**
+ * @brief 图片解码器 (PNG / QOI)
+ *
+ * 无状态、可在多个线程上同时调用。PNG 支持全部颜色类型与位深（16 位降为 8 位）、调色板、tRNS 和 Adam7 隔行；
+ * 不校验块的 CRC。逐行反滤波、通道转换和 Alpha 预乘使用 SSE2/SSSE3，
+ * 最常见的 8 位 RGB/RGBA 图片从解压结果直接写入输出缓冲区，中间没有额外的整图复制。
+ */
+class ImageDecoder {
+public:
+	// 宽高不超过此上限，防止损坏的文件头导致巨量分配
+	static constexpr uint32_t MaxDimension = 32768;
+
+	static ImageFileFormat DetectFormat(const uint8_t* data, size_t size);
+	static bool ReadInfo(const uint8_t* data, size_t size, ImageInfo& info);
+
+	// 按文件头自动选择解码器，失败时记录错误日志并返回 false
+	static bool Decode(const uint8_t* data, size_t size, const ImageDecodeOptions& options, Image& image);
+	static bool DecodePNG(const uint8_t* data, size_t size, const ImageDecodeOptions& options, Image& image);
+	static bool DecodeQOI(const uint8_t* data, size_t size, const ImageDecodeOptions& options, Image& image);
+
+	// 通道转换 (1..4 -> 1..4)：增加的颜色通道复制灰度，增加的 Alpha 为 255，减少颜色通道时取亮度
+	static void ConvertChannels(const uint8_t* src, uint32_t srcChannels, uint8_t* dst, uint32_t dstChannels, size_t pixelCount);
+	// 颜色通道乘以 Alpha（channels 为 2 或 4），srgb 为 true 时在线性空间中相乘
+	static void PremultiplyAlpha(uint8_t* pixels, uint32_t channels, size_t pixelCount, bool srgb);
+	static void FlipVertically(uint8_t* pixels, uint32_t width, uint32_t height, uint32_t channels);
+	// 2x2 盒式滤波缩小为一半（奇数尺寸时边缘像素重复采样），用于生成 mip；srgb 为 true 时颜色在线性空间中求平均
+	static Buffer Downsample(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t channels, bool srgb);
+};
+}
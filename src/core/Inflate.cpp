@@ -0,0 +1,347 @@
+#include "core/Inflate.h"
+#include <cstring>
+
+namespace GE {
+
+// ==================== 位读取 ====================
+// DEFLATE 按 LSB 优先打包比特。缓冲区保持至少 56 位可用，读到输入末尾后补 0，
+// 补 0 过多（说明数据被截断）时视为错误
+
+struct BitReader {
+	const uint8_t* Data;
+	const uint8_t* End;
+	uint64_t Bits = 0;
+	uint32_t Count = 0;
+	uint32_t Padding = 0; // 输入结束后补入的字节数
+
+	BitReader(const uint8_t* data, size_t size) : Data(data), End(data + size) {}
+
+	inline void Refill() {
+		if (End - Data >= 8) {
+			uint64_t value;
+			memcpy(&value, Data, sizeof(value)); // 小端
+			Bits |= value << Count;
+			Data += (63 - Count) >> 3;
+			Count |= 56;
+			return;
+		}
+		while (Count <= 56) {
+			if (Data < End) {
+				Bits |= static_cast<uint64_t>(*Data++) << Count;
+			} else {
+				Padding++;
+			}
+			Count += 8;
+		}
+	}
+	inline uint32_t Peek(uint32_t count) const { return static_cast<uint32_t>(Bits & ((1ull << count) - 1)); }
+	inline void Consume(uint32_t count) { Bits >>= count; Count -= count; }
+	inline uint32_t Read(uint32_t count) {
+		if (Count < count) {
+			Refill();
+		}
+		uint32_t value = Peek(count);
+		Consume(count);
+		return value;
+	}
+	inline bool Overrun() const { return Padding > 8; }
+};
+
+// ==================== Huffman ====================
+
+static inline uint32_t ReverseBits(uint32_t value, uint32_t count) {
+	uint32_t result = 0;
+	for (uint32_t i = 0; i < count; ++i) {
+		result = (result << 1) | (value & 1);
+		value >>= 1;
+	}
+	return result;
+}
+
+struct Huffman {
+	static constexpr uint32_t FastBits = 10;
+	static constexpr uint32_t FastMask = (1u << FastBits) - 1;
+	static constexpr uint32_t MaxSymbols = 288;
+
+	uint16_t Fast[1u << FastBits];  // (码长 << 9) | 符号，0 表示不在快速表中
+	uint32_t MaxCode[17];           // 每个码长的最大码值（左对齐到 16 位）+ 1
+	uint16_t FirstCode[16];
+	uint16_t FirstSymbol[16];
+	uint8_t Sizes[MaxSymbols];
+	uint16_t Values[MaxSymbols];
+
+	bool Build(const uint8_t* lengths, uint32_t count) {
+		uint32_t sizes[17] = {};
+		memset(Fast, 0, sizeof(Fast));
+		for (uint32_t i = 0; i < count; ++i) {
+			sizes[lengths[i]]++;
+		}
+		sizes[0] = 0;
+		for (uint32_t i = 1; i < 16; ++i) {
+			if (sizes[i] > (1u << i)) {
+				return false;
+			}
+		}
+		uint32_t nextCode[16] = {};
+		uint32_t code = 0;
+		uint32_t symbol = 0;
+		for (uint32_t i = 1; i < 16; ++i) {
+			nextCode[i] = code;
+			FirstCode[i] = static_cast<uint16_t>(code);
+			FirstSymbol[i] = static_cast<uint16_t>(symbol);
+			code += sizes[i];
+			if (sizes[i] && code - 1 >= (1u << i)) {
+				return false; // 码字超额分配
+			}
+			MaxCode[i] = code << (16 - i);
+			code <<= 1;
+			symbol += sizes[i];
+		}
+		MaxCode[16] = 0x10000;
+		for (uint32_t i = 0; i < count; ++i) {
+			const uint32_t length = lengths[i];
+			if (!length) {
+				continue;
+			}
+			const uint32_t index = nextCode[length] - FirstCode[length] + FirstSymbol[length];
+			Sizes[index] = static_cast<uint8_t>(length);
+			Values[index] = static_cast<uint16_t>(i);
+			if (length <= FastBits) {
+				// 码字按 MSB 优先定义而比特按 LSB 优先读取，填表时需反转
+				for (uint32_t j = ReverseBits(nextCode[length], length); j < (1u << FastBits); j += (1u << length)) {
+					Fast[j] = static_cast<uint16_t>((length << 9) | i);
+				}
+			}
+			nextCode[length]++;
+		}
+		return true;
+	}
+
+	// 返回符号，出错时返回 -1
+	inline int Decode(BitReader& reader) const {
+		if (reader.Count < 16) {
+			reader.Refill();
+		}
+		const uint32_t fast = Fast[reader.Bits & FastMask];
+		if (fast) {
+			reader.Consume(fast >> 9);
+			return fast & 511;
+		}
+		// 慢路径：按码长逐个比较左对齐的码值
+		const uint32_t key = ReverseBits(reader.Peek(16), 16);
+		uint32_t length = FastBits + 1;
+		while (length < 16 && key >= MaxCode[length]) {
+			++length;
+		}
+		if (length >= 16) {
+			return -1;
+		}
+		const uint32_t index = (key >> (16 - length)) - FirstCode[length] + FirstSymbol[length];
+		if (index >= MaxSymbols || Sizes[index] != length) {
+			return -1;
+		}
+		reader.Consume(length);
+		return Values[index];
+	}
+};
+
+static constexpr uint16_t s_LengthBase[29] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static constexpr uint8_t s_LengthExtra[29] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static constexpr uint16_t s_DistanceBase[30] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static constexpr uint8_t s_DistanceExtra[30] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+// 固定 Huffman 表 (BTYPE = 01)，首次使用时构建
+struct FixedHuffmanTables {
+	Huffman Literal;
+	Huffman Distance;
+	FixedHuffmanTables() {
+		uint8_t lengths[288];
+		memset(lengths, 8, 144);
+		memset(lengths + 144, 9, 112);
+		memset(lengths + 256, 7, 24);
+		memset(lengths + 280, 8, 8);
+		Literal.Build(lengths, 288);
+		memset(lengths, 5, 30);
+		Distance.Build(lengths, 30);
+	}
+};
+
+// ==================== 解压 ====================
+
+static bool DecodeHuffmanBlock(BitReader& reader, const Huffman& literal, const Huffman& distance,
+	uint8_t* dst, size_t dstCapacity, size_t& position) {
+	while (true) {
+		int symbol = literal.Decode(reader);
+		if (symbol < 256) {
+			if (symbol < 0 || position >= dstCapacity) {
+				return false;
+			}
+			dst[position++] = static_cast<uint8_t>(symbol);
+			continue;
+		}
+		if (symbol == 256) {
+			return !reader.Overrun();
+		}
+		symbol -= 257;
+		if (symbol >= 29) {
+			return false;
+		}
+		const uint32_t length = s_LengthBase[symbol] + reader.Read(s_LengthExtra[symbol]);
+		const int distanceSymbol = distance.Decode(reader);
+		if (distanceSymbol < 0 || distanceSymbol >= 30) {
+			return false;
+		}
+		const uint32_t dist = s_DistanceBase[distanceSymbol] + reader.Read(s_DistanceExtra[distanceSymbol]);
+		if (dist > position || length > dstCapacity - position || reader.Overrun()) {
+			return false;
+		}
+		uint8_t* out = dst + position;
+		const uint8_t* from = out - dist;
+		if (dist >= 8 && dstCapacity - position >= length + 8) {
+			// 距离不小于 8 时 8 字节一组复制不会读到本次尚未写入的数据；末尾可能多写几个字节，随后会被覆盖
+			for (uint32_t i = 0; i < length; i += 8) {
+				uint64_t chunk;
+				memcpy(&chunk, from + i, 8);
+				memcpy(out + i, &chunk, 8);
+			}
+		} else {
+			for (uint32_t i = 0; i < length; ++i) {
+				out[i] = from[i];
+			}
+		}
+		position += length;
+	}
+}
+
+static bool DecodeDynamicTables(BitReader& reader, Huffman& literal, Huffman& distance) {
+	static constexpr uint8_t s_CodeLengthOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+	const uint32_t literalCount = reader.Read(5) + 257;
+	const uint32_t distanceCount = reader.Read(5) + 1;
+	const uint32_t codeLengthCount = reader.Read(4) + 4;
+	if (literalCount > 286 || distanceCount > 30) {
+		return false;
+	}
+
+	uint8_t codeLengthLengths[19] = {};
+	for (uint32_t i = 0; i < codeLengthCount; ++i) {
+		codeLengthLengths[s_CodeLengthOrder[i]] = static_cast<uint8_t>(reader.Read(3));
+	}
+	Huffman codeLength;
+	if (!codeLength.Build(codeLengthLengths, 19)) {
+		return false;
+	}
+
+	// 字面量/长度表与距离表的码长连续编码，重复码 (16/17/18) 可以跨越两表边界
+	uint8_t lengths[286 + 30] = {};
+	const uint32_t total = literalCount + distanceCount;
+	uint32_t count = 0;
+	while (count < total) {
+		const int symbol = codeLength.Decode(reader);
+		if (symbol < 0 || reader.Overrun()) {
+			return false;
+		}
+		if (symbol < 16) {
+			lengths[count++] = static_cast<uint8_t>(symbol);
+			continue;
+		}
+		uint32_t repeat = 0;
+		uint8_t value = 0;
+		if (symbol == 16) {
+			if (count == 0) {
+				return false;
+			}
+			repeat = reader.Read(2) + 3;
+			value = lengths[count - 1];
+		} else if (symbol == 17) {
+			repeat = reader.Read(3) + 3;
+		} else {
+			repeat = reader.Read(7) + 11;
+		}
+		if (count + repeat > total) {
+			return false;
+		}
+		memset(lengths + count, value, repeat);
+		count += repeat;
+	}
+	if (lengths[256] == 0) {
+		return false; // 必须存在块结束符
+	}
+	return literal.Build(lengths, literalCount) && distance.Build(lengths + literalCount, distanceCount);
+}
+
+bool Inflate::DecompressDeflate(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity, size_t& outSize) {
+	static const FixedHuffmanTables s_Fixed;
+	BitReader reader(src, srcSize);
+	size_t position = 0;
+	outSize = 0;
+	bool finalBlock = false;
+	Huffman literal;
+	Huffman distance;
+	while (!finalBlock) {
+		finalBlock = reader.Read(1) != 0;
+		const uint32_t type = reader.Read(2);
+		if (type == 0) {
+			// 存储块：丢弃到字节边界，先取出位缓冲中剩余的整字节，再直接复制
+			reader.Consume(reader.Count & 7);
+			const uint32_t length = reader.Read(16);
+			const uint32_t lengthComplement = reader.Read(16);
+			if ((length ^ 0xFFFF) != lengthComplement || length > dstCapacity - position) {
+				return false;
+			}
+			uint32_t remaining = length;
+			while (remaining > 0 && reader.Count >= 8) {
+				dst[position++] = static_cast<uint8_t>(reader.Read(8));
+				--remaining;
+			}
+			if (remaining > 0) {
+				if (remaining > static_cast<size_t>(reader.End - reader.Data)) {
+					return false;
+				}
+				// 位缓冲已取空，但快速 Refill 预读的高位仍是 Data 处的旧数据；跳过存储数据后必须丢弃，
+				// 否则下一次 Refill 会把它们与新位置的数据混在一起
+				reader.Bits = 0;
+				reader.Count = 0;
+				memcpy(dst + position, reader.Data, remaining);
+				reader.Data += remaining;
+				position += remaining;
+			}
+		} else if (type == 1) {
+			if (!DecodeHuffmanBlock(reader, s_Fixed.Literal, s_Fixed.Distance, dst, dstCapacity, position)) {
+				return false;
+			}
+		} else if (type == 2) {
+			if (!DecodeDynamicTables(reader, literal, distance)
+				|| !DecodeHuffmanBlock(reader, literal, distance, dst, dstCapacity, position)) {
+				return false;
+			}
+		} else {
+			return false;
+		}
+		if (reader.Overrun()) {
+			return false;
+		}
+	}
+	outSize = position;
+	return true;
+}
+
+bool Inflate::DecompressZlib(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity, size_t& outSize) {
+	outSize = 0;
+	if (srcSize < 2) {
+		return false;
+	}
+	const uint32_t cmf = src[0];
+	const uint32_t flags = src[1];
+	// CM = 8 (deflate)，头部校验，且不支持预设字典
+	if ((cmf & 0x0F) != 8 || ((cmf << 8) | flags) % 31 != 0 || (flags & 0x20)) {
+		return false;
+	}
+	return DecompressDeflate(src + 2, srcSize - 2, dst, dstCapacity, outSize);
+}
+}
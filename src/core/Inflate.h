@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace GE {
+
+/**
+ * @brief DEFLATE / zlib 解压 (RFC 1951 / RFC 1950)
+ *
+ * 解压到调用者提供的固定大小缓冲区中（例如 PNG 已知解压后的大小），过程中不分配内存。
+ * Huffman 解码使用 10 位快速查找表，只有较长的码字才走逐位比较的慢路径。
+ * 不校验 zlib 流末尾的 Adler-32。
+ */
+class Inflate {
+public:
+	/**
+	 * @brief 解压 zlib 流（2 字节头 + DEFLATE 数据）
+	 *
+	 * @param src 压缩数据
+	 * @param srcSize 压缩数据字节数
+	 * @param dst 输出缓冲区
+	 * @param dstCapacity 输出缓冲区容量
+	 * @param outSize 实际解压出的字节数
+	 * @return 数据损坏或输出空间不足时返回 false
+	 */
+	static bool DecompressZlib(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity, size_t& outSize);
+
+	// 解压不带 zlib 头的原始 DEFLATE 流
+	static bool DecompressDeflate(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity, size_t& outSize);
+};
+}
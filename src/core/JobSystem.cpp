@@ -0,0 +1,137 @@
+#include "core/JobSystem.h"
+#include "core/Log.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace GE {
+
+struct JobEntry {
+	JobContext* Context;
+	std::function<void()> Task;
+};
+
+struct JobSystemData {
+	std::vector<std::thread> Workers;
+	std::deque<JobEntry> Queue;
+	std::mutex QueueMutex;
+	std::condition_variable WakeCondition;
+	bool Running = false;
+};
+static JobSystemData s_JobSystem;
+static thread_local uint32_t s_ThreadIndex = 0;
+
+static bool TryRunPendingJob() {
+	JobEntry entry;
+	{
+		std::lock_guard<std::mutex> lock(s_JobSystem.QueueMutex);
+		if (s_JobSystem.Queue.empty()) {
+			return false;
+		}
+		entry = std::move(s_JobSystem.Queue.front());
+		s_JobSystem.Queue.pop_front();
+	}
+	entry.Task();
+	entry.Context->Counter.fetch_sub(1, std::memory_order_acq_rel);
+	return true;
+}
+
+void JobSystem::Init(uint32_t workerCount) {
+	if (s_JobSystem.Running) {
+		return;
+	}
+	if (workerCount == 0) {
+		const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+		workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+	}
+	s_JobSystem.Running = true;
+	for (uint32_t i = 0; i < workerCount; ++i) {
+		s_JobSystem.Workers.emplace_back([index = i + 1]() {
+			s_ThreadIndex = index;
+			while (true) {
+				JobEntry entry;
+				{
+					std::unique_lock<std::mutex> lock(s_JobSystem.QueueMutex);
+					s_JobSystem.WakeCondition.wait(lock, [] { return !s_JobSystem.Queue.empty() || !s_JobSystem.Running; });
+					if (s_JobSystem.Queue.empty()) {
+						return; // 已停止且没有剩余任务
+					}
+					entry = std::move(s_JobSystem.Queue.front());
+					s_JobSystem.Queue.pop_front();
+				}
+				entry.Task();
+				entry.Context->Counter.fetch_sub(1, std::memory_order_acq_rel);
+			}
+		});
+	}
+	LOG_INFO_ENGINE("JobSystem initialized with {0} worker threads", workerCount);
+}
+
+void JobSystem::Shutdown() {
+	{
+		std::lock_guard<std::mutex> lock(s_JobSystem.QueueMutex);
+		s_JobSystem.Running = false;
+	}
+	s_JobSystem.WakeCondition.notify_all();
+	for (auto& worker : s_JobSystem.Workers) {
+		worker.join();
+	}
+	s_JobSystem.Workers.clear();
+}
+
+uint32_t JobSystem::GetWorkerCount() {
+	return static_cast<uint32_t>(s_JobSystem.Workers.size());
+}
+
+uint32_t JobSystem::GetThreadIndex() {
+	return s_ThreadIndex;
+}
+
+bool JobSystem::IsWorkerThread() {
+	return s_ThreadIndex != 0;
+}
+
+void JobSystem::Execute(JobContext& context, std::function<void()> job) {
+	if (s_JobSystem.Workers.empty()) {
+		job();
+		return;
+	}
+	context.Counter.fetch_add(1, std::memory_order_relaxed);
+	{
+		std::lock_guard<std::mutex> lock(s_JobSystem.QueueMutex);
+		s_JobSystem.Queue.push_back({ &context, std::move(job) });
+	}
+	s_JobSystem.WakeCondition.notify_one();
+}
+
+void JobSystem::Dispatch(JobContext& context, uint32_t jobCount, uint32_t groupSize,
+	const std::function<void(JobDispatchArgs)>& job) {
+	if (jobCount == 0 || groupSize == 0) {
+		return;
+	}
+	const uint32_t groupCount = (jobCount + groupSize - 1) / groupSize;
+	for (uint32_t groupIndex = 0; groupIndex < groupCount; ++groupIndex) {
+		Execute(context, [=]() {
+			const uint32_t begin = groupIndex * groupSize;
+			const uint32_t end = begin + groupSize < jobCount ? begin + groupSize : jobCount;
+			for (uint32_t jobIndex = begin; jobIndex < end; ++jobIndex) {
+				job({ jobIndex, groupIndex });
+			}
+		});
+	}
+}
+
+bool JobSystem::IsBusy(const JobContext& context) {
+	return context.Counter.load(std::memory_order_acquire) > 0;
+}
+
+void JobSystem::Wait(const JobContext& context) {
+	while (IsBusy(context)) {
+		if (!TryRunPendingJob()) {
+			std::this_thread::yield();
+		}
+	}
+}
+}
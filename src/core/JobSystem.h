@@ -0,0 +1,53 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+namespace GE {
+
+// Dispatch 中每个任务收到的参数
+struct JobDispatchArgs {
+	uint32_t JobIndex;   // 在整个 Dispatch 中的序号 [0, jobCount)
+	uint32_t GroupIndex; // 所在分组的序号
+};
+
+/**
+ * @brief 一组相关任务的完成计数
+ *
+ * 提交任务时计数加一，任务执行完毕后减一；Wait 等待计数归零。
+ * 不同的系统各自持有自己的 JobContext，互不等待。
+ */
+struct JobContext {
+	std::atomic<uint32_t> Counter{ 0 };
+};
+
+/**
+ * @brief 任务系统 (线程池)
+ *
+ * 启动固定数量的工作线程，从共享队列中取出任务执行。
+ * 没有工作线程时（单核或未初始化）任务在提交线程上立即执行，调用方无需区分。
+ * 等待中的线程会顺带执行队列中的任务，而不是空转。
+ */
+class JobSystem {
+public:
+	// workerCount 为 0 时使用 (硬件线程数 - 1)，为主线程保留一个核心
+	static void Init(uint32_t workerCount = 0);
+	static void Shutdown();
+
+	static uint32_t GetWorkerCount();
+	// 当前线程的编号：工作线程为 1..GetWorkerCount()，其他线程（主线程）为 0
+	static uint32_t GetThreadIndex();
+	// 当前线程是否为 JobSystem 的工作线程
+	static bool IsWorkerThread();
+
+	// 提交单个任务
+	static void Execute(JobContext& context, std::function<void()> job);
+	// 把 jobCount 个任务按 groupSize 分组提交，每组作为一个任务在同一线程上顺序执行
+	static void Dispatch(JobContext& context, uint32_t jobCount, uint32_t groupSize,
+		const std::function<void(JobDispatchArgs)>& job);
+
+	static bool IsBusy(const JobContext& context);
+	// 等待 context 中的任务全部完成，期间在当前线程上执行其他排队的任务
+	static void Wait(const JobContext& context);
+};
+}
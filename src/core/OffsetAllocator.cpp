@@ -0,0 +1,284 @@
+#include "core/OffsetAllocator.h"
+#include "core/Core.h"
+#include "core/Log.h"
+#include <bit>
+
+namespace GE {
+
+// 桶大小按 "指数 + 3 位尾数" 的浮点分布划分，使每个桶的平均浪费比例大致相同
+static constexpr uint32_t s_MantissaBits = 3;
+static constexpr uint32_t s_MantissaValue = 1 << s_MantissaBits;
+static constexpr uint32_t s_MantissaMask = s_MantissaValue - 1;
+static constexpr uint32_t s_TopBinsIndexShift = 3;
+static constexpr uint32_t s_LeafBinsIndexMask = 0x7;
+
+// 向上取整到桶编号：分配时使用，保证桶内任意块都能容纳请求
+static uint32_t UintToFloatRoundUp(uint32_t size) {
+	uint32_t exponent = 0;
+	uint32_t mantissa = 0;
+	if (size < s_MantissaValue) {
+		mantissa = size;
+	} else {
+		uint32_t highestSetBit = 31 - static_cast<uint32_t>(std::countl_zero(size));
+		uint32_t mantissaStartBit = highestSetBit - s_MantissaBits;
+		exponent = mantissaStartBit + 1;
+		mantissa = (size >> mantissaStartBit) & s_MantissaMask;
+		uint32_t lowBitsMask = (1u << mantissaStartBit) - 1;
+		if ((size & lowBitsMask) != 0) {
+			mantissa++;
+		}
+	}
+	// 用加法而非按位或：尾数进位时自然溢出到指数
+	return (exponent << s_MantissaBits) + mantissa;
+}
+
+// 向下取整到桶编号：插入空闲块时使用
+static uint32_t UintToFloatRoundDown(uint32_t size) {
+	uint32_t exponent = 0;
+	uint32_t mantissa = 0;
+	if (size < s_MantissaValue) {
+		mantissa = size;
+	} else {
+		uint32_t highestSetBit = 31 - static_cast<uint32_t>(std::countl_zero(size));
+		uint32_t mantissaStartBit = highestSetBit - s_MantissaBits;
+		exponent = mantissaStartBit + 1;
+		mantissa = (size >> mantissaStartBit) & s_MantissaMask;
+	}
+	return (exponent << s_MantissaBits) | mantissa;
+}
+
+static uint32_t FloatToUint(uint32_t floatValue) {
+	uint32_t exponent = floatValue >> s_MantissaBits;
+	uint32_t mantissa = floatValue & s_MantissaMask;
+	if (exponent == 0) {
+		return mantissa;
+	}
+	return (mantissa | s_MantissaValue) << (exponent - 1);
+}
+
+// 返回 bitMask 中不低于 startBitIndex 的最低置位，没有则返回 NoSpace
+static uint32_t FindLowestSetBitAfter(uint32_t bitMask, uint32_t startBitIndex) {
+	if (startBitIndex >= 32) {
+		return OffsetAllocator::NoSpace;
+	}
+	uint32_t maskBeforeStartIndex = (1u << startBitIndex) - 1;
+	uint32_t bitsAfter = bitMask & ~maskBeforeStartIndex;
+	if (bitsAfter == 0) {
+		return OffsetAllocator::NoSpace;
+	}
+	return static_cast<uint32_t>(std::countr_zero(bitsAfter));
+}
+
+OffsetAllocator::OffsetAllocator(uint32_t size, uint32_t maxAllocations)
+	: m_Size(size), m_MaxAllocations(maxAllocations) {
+	Reset();
+}
+
+void OffsetAllocator::Reset() {
+	m_FreeStorage = 0;
+	m_UsedBinsTop = 0;
+	for (auto& bins : m_UsedBins) {
+		bins = 0;
+	}
+	for (auto& binIndex : m_BinIndices) {
+		binIndex = Unused;
+	}
+	m_Nodes.assign(m_MaxAllocations, Node{});
+	// 逆序压栈，使节点 0 最先被使用
+	m_FreeNodes.resize(m_MaxAllocations);
+	for (uint32_t i = 0; i < m_MaxAllocations; ++i) {
+		m_FreeNodes[i] = m_MaxAllocations - i - 1;
+	}
+	// 整个空间作为一个空闲块
+	if (m_Size > 0) {
+		InsertNodeIntoBin(m_Size, 0);
+	}
+}
+
+OffsetAllocator::Allocation OffsetAllocator::Allocate(uint32_t size) {
+	// 拆分剩余空间时还需要一个新节点
+	if (m_FreeNodes.empty() || size == 0) {
+		return {};
+	}
+
+	uint32_t minBinIndex = UintToFloatRoundUp(size);
+	uint32_t minTopBinIndex = minBinIndex >> s_TopBinsIndexShift;
+	uint32_t minLeafBinIndex = minBinIndex & s_LeafBinsIndexMask;
+
+	uint32_t topBinIndex = minTopBinIndex;
+	uint32_t leafBinIndex = NoSpace;
+	// 先在同一个顶层桶中找不小于所需尺寸的叶子桶
+	if (topBinIndex < NumTopBins && (m_UsedBinsTop & (1u << topBinIndex))) {
+		leafBinIndex = FindLowestSetBitAfter(m_UsedBins[topBinIndex], minLeafBinIndex);
+	}
+	// 否则取更大的顶层桶中最小的叶子桶
+	if (leafBinIndex == NoSpace) {
+		topBinIndex = FindLowestSetBitAfter(m_UsedBinsTop, minTopBinIndex + 1);
+		if (topBinIndex == NoSpace) {
+			return {};
+		}
+		leafBinIndex = static_cast<uint32_t>(std::countr_zero(static_cast<uint32_t>(m_UsedBins[topBinIndex])));
+	}
+
+	uint32_t binIndex = (topBinIndex << s_TopBinsIndexShift) | leafBinIndex;
+
+	// 从桶链表头取出节点
+	uint32_t nodeIndex = m_BinIndices[binIndex];
+	Node& node = m_Nodes[nodeIndex];
+	uint32_t nodeTotalSize = node.DataSize;
+	node.DataSize = size;
+	node.Used = true;
+	m_BinIndices[binIndex] = node.BinListNext;
+	if (node.BinListNext != Unused) {
+		m_Nodes[node.BinListNext].BinListPrev = Unused;
+	}
+	m_FreeStorage -= nodeTotalSize;
+
+	if (m_BinIndices[binIndex] == Unused) {
+		m_UsedBins[topBinIndex] &= static_cast<uint8_t>(~(1u << leafBinIndex));
+		if (m_UsedBins[topBinIndex] == 0) {
+			m_UsedBinsTop &= ~(1u << topBinIndex);
+		}
+	}
+
+	// 剩余部分作为新的空闲块放回桶中，并接入相邻链表
+	uint32_t reminderSize = nodeTotalSize - size;
+	if (reminderSize > 0) {
+		uint32_t newNodeIndex = InsertNodeIntoBin(reminderSize, node.DataOffset + size);
+		if (node.NeighborNext != Unused) {
+			m_Nodes[node.NeighborNext].NeighborPrev = newNodeIndex;
+		}
+		m_Nodes[newNodeIndex].NeighborPrev = nodeIndex;
+		m_Nodes[newNodeIndex].NeighborNext = node.NeighborNext;
+		node.NeighborNext = newNodeIndex;
+	}
+
+	return { node.DataOffset, nodeIndex };
+}
+
+void OffsetAllocator::Free(const Allocation& allocation) {
+	if (!allocation.IsValid()) {
+		return;
+	}
+	ASSERT_ENGINE(allocation.Metadata < m_MaxAllocations, "Invalid allocation metadata!");
+	uint32_t nodeIndex = allocation.Metadata;
+	Node& node = m_Nodes[nodeIndex];
+	ASSERT_ENGINE(node.Used, "Double free of offset allocation!");
+
+	uint32_t offset = node.DataOffset;
+	uint32_t size = node.DataSize;
+
+	// 与前一个空闲块合并
+	if (node.NeighborPrev != Unused && !m_Nodes[node.NeighborPrev].Used) {
+		Node prevNode = m_Nodes[node.NeighborPrev];
+		offset = prevNode.DataOffset;
+		size += prevNode.DataSize;
+		RemoveNodeFromBin(node.NeighborPrev);
+		node.NeighborPrev = prevNode.NeighborPrev;
+	}
+
+	// 与后一个空闲块合并
+	if (node.NeighborNext != Unused && !m_Nodes[node.NeighborNext].Used) {
+		Node nextNode = m_Nodes[node.NeighborNext];
+		size += nextNode.DataSize;
+		RemoveNodeFromBin(node.NeighborNext);
+		node.NeighborNext = nextNode.NeighborNext;
+	}
+
+	uint32_t neighborNext = node.NeighborNext;
+	uint32_t neighborPrev = node.NeighborPrev;
+
+	// 回收当前节点，再以合并后的区间插入一个新的空闲节点
+	node = Node{};
+	m_FreeNodes.push_back(nodeIndex);
+
+	uint32_t combinedNodeIndex = InsertNodeIntoBin(size, offset);
+	if (neighborNext != Unused) {
+		m_Nodes[combinedNodeIndex].NeighborNext = neighborNext;
+		m_Nodes[neighborNext].NeighborPrev = combinedNodeIndex;
+	}
+	if (neighborPrev != Unused) {
+		m_Nodes[combinedNodeIndex].NeighborPrev = neighborPrev;
+		m_Nodes[neighborPrev].NeighborNext = combinedNodeIndex;
+	}
+}
+
+uint32_t OffsetAllocator::InsertNodeIntoBin(uint32_t size, uint32_t dataOffset) {
+	uint32_t binIndex = UintToFloatRoundDown(size);
+	uint32_t topBinIndex = binIndex >> s_TopBinsIndexShift;
+	uint32_t leafBinIndex = binIndex & s_LeafBinsIndexMask;
+
+	if (m_BinIndices[binIndex] == Unused) {
+		m_UsedBins[topBinIndex] |= static_cast<uint8_t>(1u << leafBinIndex);
+		m_UsedBinsTop |= 1u << topBinIndex;
+	}
+
+	uint32_t topNodeIndex = m_BinIndices[binIndex];
+	uint32_t nodeIndex = m_FreeNodes.back();
+	m_FreeNodes.pop_back();
+
+	Node& node = m_Nodes[nodeIndex];
+	node = Node{};
+	node.DataOffset = dataOffset;
+	node.DataSize = size;
+	node.BinListNext = topNodeIndex;
+	if (topNodeIndex != Unused) {
+		m_Nodes[topNodeIndex].BinListPrev = nodeIndex;
+	}
+	m_BinIndices[binIndex] = nodeIndex;
+
+	m_FreeStorage += size;
+	return nodeIndex;
+}
+
+void OffsetAllocator::RemoveNodeFromBin(uint32_t nodeIndex) {
+	Node& node = m_Nodes[nodeIndex];
+	if (node.BinListPrev != Unused) {
+		// 不是链表头：直接摘除
+		m_Nodes[node.BinListPrev].BinListNext = node.BinListNext;
+		if (node.BinListNext != Unused) {
+			m_Nodes[node.BinListNext].BinListPrev = node.BinListPrev;
+		}
+	} else {
+		// 链表头：更新桶的头指针，必要时清除位掩码
+		uint32_t binIndex = UintToFloatRoundDown(node.DataSize);
+		uint32_t topBinIndex = binIndex >> s_TopBinsIndexShift;
+		uint32_t leafBinIndex = binIndex & s_LeafBinsIndexMask;
+
+		m_BinIndices[binIndex] = node.BinListNext;
+		if (node.BinListNext != Unused) {
+			m_Nodes[node.BinListNext].BinListPrev = Unused;
+		}
+		if (m_BinIndices[binIndex] == Unused) {
+			m_UsedBins[topBinIndex] &= static_cast<uint8_t>(~(1u << leafBinIndex));
+			if (m_UsedBins[topBinIndex] == 0) {
+				m_UsedBinsTop &= ~(1u << topBinIndex);
+			}
+		}
+	}
+
+	m_FreeStorage -= node.DataSize;
+	node = Node{};
+	m_FreeNodes.push_back(nodeIndex);
+}
+
+uint32_t OffsetAllocator::GetAllocationSize(const Allocation& allocation) const {
+	if (!allocation.IsValid()) {
+		return 0;
+	}
+	return m_Nodes[allocation.Metadata].DataSize;
+}
+
+OffsetAllocator::StorageReport OffsetAllocator::GetStorageReport() const {
+	StorageReport report;
+	if (!m_FreeNodes.empty()) {
+		report.TotalFreeSpace = m_FreeStorage;
+		if (m_UsedBinsTop) {
+			uint32_t topBinIndex = 31 - static_cast<uint32_t>(std::countl_zero(m_UsedBinsTop));
+			uint32_t leafBinIndex = 31 - static_cast<uint32_t>(std::countl_zero(static_cast<uint32_t>(m_UsedBins[topBinIndex])));
+			report.LargestFreeRegion = FloatToUint((topBinIndex << s_TopBinsIndexShift) | leafBinIndex);
+		}
+	}
+	return report;
+}
+}
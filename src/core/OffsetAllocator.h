@@ -0,0 +1,72 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+namespace GE {
+/**
+ * @brief 偏移分配器 (TLSF 风格)
+ *
+ * 在一段抽象的线性空间 [0, size) 上分配连续区间。它只返回偏移，不持有实际内存，
+ * 用于对大块 GPU 缓冲做子分配（例如几何堆中的顶点/索引区间）。
+ * - 空闲块按大小放入 32 x 8 个桶（5 位指数 + 3 位尾数的浮点式编码），通过两级位掩码 O(1) 找到合适的桶；
+ * - 释放时与物理相邻的空闲块合并 (coalescing)，抑制碎片。
+ *
+ * 本类没有内置线程同步，多线程使用需调用者自行加锁。
+ */
+class OffsetAllocator {
+public:
+	static constexpr uint32_t NoSpace = 0xFFFFFFFF;
+
+	struct Allocation {
+		uint32_t Offset = NoSpace;   // 分配到的起始偏移
+		uint32_t Metadata = NoSpace; // 内部节点索引，释放时使用
+		inline bool IsValid() const { return Offset != NoSpace; }
+	};
+
+	struct StorageReport {
+		uint32_t TotalFreeSpace = 0;
+		uint32_t LargestFreeRegion = 0;
+	};
+
+	OffsetAllocator(uint32_t size, uint32_t maxAllocations = 128 * 1024);
+
+	// 分配 size 个单位，空间或节点不足时返回无效的 Allocation
+	Allocation Allocate(uint32_t size);
+	void Free(const Allocation& allocation);
+	// 释放全部分配，恢复为一整块空闲空间
+	void Reset();
+
+	uint32_t GetAllocationSize(const Allocation& allocation) const;
+	StorageReport GetStorageReport() const;
+	inline uint32_t GetSize() const { return m_Size; }
+private:
+	uint32_t InsertNodeIntoBin(uint32_t size, uint32_t dataOffset);
+	void RemoveNodeFromBin(uint32_t nodeIndex);
+private:
+	static constexpr uint32_t NumTopBins = 32;
+	static constexpr uint32_t BinsPerLeaf = 8;
+	static constexpr uint32_t NumLeafBins = NumTopBins * BinsPerLeaf;
+	static constexpr uint32_t Unused = 0xFFFFFFFF;
+
+	struct Node {
+		uint32_t DataOffset = 0;
+		uint32_t DataSize = 0;
+		uint32_t BinListPrev = Unused;  // 同一个桶内的空闲链表
+		uint32_t BinListNext = Unused;
+		uint32_t NeighborPrev = Unused; // 地址上相邻的块，用于合并
+		uint32_t NeighborNext = Unused;
+		bool Used = false;
+	};
+
+	uint32_t m_Size;
+	uint32_t m_MaxAllocations;
+	uint32_t m_FreeStorage = 0;
+
+	uint32_t m_UsedBinsTop = 0;
+	uint8_t m_UsedBins[NumTopBins] = {};
+	uint32_t m_BinIndices[NumLeafBins] = {};
+
+	std::vector<Node> m_Nodes;
+	std::vector<uint32_t> m_FreeNodes; // 空闲节点索引栈
+};
+}
@@ -0,0 +1,139 @@
+#include "core/RectPacker.h"
+#include <algorithm>
+#include <numeric>
+
+namespace GE {
+
+RectPacker::RectPacker(uint32_t width, uint32_t height) {
+	Reset(width, height);
+}
+
+void RectPacker::Reset(uint32_t width, uint32_t height) {
+	m_Width = width;
+	m_Height = height;
+	m_UsedArea = 0;
+	m_Skyline.clear();
+	if (width > 0) {
+		m_Skyline.push_back({ 0, 0, width });
+	}
+}
+
+bool RectPacker::Fit(size_t index, uint32_t width, uint32_t height, uint32_t& y) const {
+	const uint32_t x = m_Skyline[index].X;
+	if (x + width > m_Width) {
+		return false;
+	}
+	// 矩形横跨的所有线段中最高的一条决定底边
+	y = 0;
+	uint32_t widthLeft = width;
+	for (size_t i = index; widthLeft > 0; ++i) {
+		if (i >= m_Skyline.size()) {
+			return false;
+		}
+		y = std::max(y, m_Skyline[i].Y);
+		if (y + height > m_Height) {
+			return false;
+		}
+		widthLeft -= std::min(widthLeft, m_Skyline[i].Width);
+	}
+	return true;
+}
+
+void RectPacker::AddLevel(size_t index, const Rect& rect) {
+	m_Skyline.insert(m_Skyline.begin() + static_cast<ptrdiff_t>(index), { rect.X, rect.Y + rect.Height, rect.Width });
+
+	// 新线段遮住的部分从后续线段中去掉
+	for (size_t i = index + 1; i < m_Skyline.size();) {
+		const SkylineNode& previous = m_Skyline[i - 1];
+		SkylineNode& node = m_Skyline[i];
+		const uint32_t previousEnd = previous.X + previous.Width;
+		if (node.X >= previousEnd) {
+			break;
+		}
+		const uint32_t shrink = previousEnd - node.X;
+		if (node.Width > shrink) {
+			node.X += shrink;
+			node.Width -= shrink;
+			break;
+		}
+		m_Skyline.erase(m_Skyline.begin() + static_cast<ptrdiff_t>(i));
+	}
+
+	// 合并高度相同的相邻线段
+	for (size_t i = 0; i + 1 < m_Skyline.size();) {
+		if (m_Skyline[i].Y == m_Skyline[i + 1].Y) {
+			m_Skyline[i].Width += m_Skyline[i + 1].Width;
+			m_Skyline.erase(m_Skyline.begin() + static_cast<ptrdiff_t>(i + 1));
+		} else {
+			++i;
+		}
+	}
+}
+
+bool RectPacker::Pack(uint32_t width, uint32_t height, Rect& result) {
+	if (width == 0 || height == 0) {
+		result = {};
+		return true;
+	}
+	size_t bestIndex = m_Skyline.size();
+	uint32_t bestTop = UINT32_MAX;
+	uint32_t bestWidth = UINT32_MAX;
+	uint32_t bestY = 0;
+	for (size_t i = 0; i < m_Skyline.size(); ++i) {
+		uint32_t y = 0;
+		if (!Fit(i, width, height, y)) {
+			continue;
+		}
+		const uint32_t top = y + height;
+		if (top < bestTop || (top == bestTop && m_Skyline[i].Width < bestWidth)) {
+			bestIndex = i;
+			bestTop = top;
+			bestWidth = m_Skyline[i].Width;
+			bestY = y;
+		}
+	}
+	if (bestIndex == m_Skyline.size()) {
+		return false;
+	}
+	result = { m_Skyline[bestIndex].X, bestY, width, height };
+	AddLevel(bestIndex, result);
+	m_UsedArea += static_cast<uint64_t>(width) * height;
+	return true;
+}
+
+uint32_t RectPacker::PackBatch(std::span<BatchEntry> entries) {
+	// 先放高的、再放宽的，天际线更平整，留下的空隙更少
+	std::vector<uint32_t> order(entries.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+		if (entries[a].Height != entries[b].Height) {
+			return entries[a].Height > entries[b].Height;
+		}
+		return entries[a].Width > entries[b].Width;
+	});
+	uint32_t packedCount = 0;
+	for (uint32_t index : order) {
+		BatchEntry& entry = entries[index];
+		entry.Packed = Pack(entry.Width, entry.Height, entry.Result);
+		packedCount += entry.Packed ? 1 : 0;
+	}
+	return packedCount;
+}
+
+void RectPacker::Grow(uint32_t width, uint32_t height) {
+	if (width > m_Width) {
+		if (!m_Skyline.empty() && m_Skyline.back().Y == 0) {
+			m_Skyline.back().Width += width - m_Width;
+		} else {
+			m_Skyline.push_back({ m_Width, 0, width - m_Width });
+		}
+		m_Width = width;
+	}
+	m_Height = std::max(m_Height, height);
+}
+
+float RectPacker::GetOccupancy() const {
+	const uint64_t area = static_cast<uint64_t>(m_Width) * m_Height;
+	return area ? static_cast<float>(static_cast<double>(m_UsedArea) / static_cast<double>(area)) : 0.0f;
+}
+}
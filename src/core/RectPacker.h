@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace GE {
+/**
+ * @brief 矩形装箱 (Skyline Bottom-Left)
+ *
+ * 用一条“天际线”（从左到右、互不重叠的水平线段）记录已占用区域的上边界。
+ * 放置新矩形时在每条线段的起点尝试，选择放置后顶边最低的位置，平局时选更窄的线段以减少浪费。
+ * 天际线下方被遮住的空隙不再利用，换来 O(线段数) 的放置开销，适合运行时逐个追加的图集。
+ * 离线构建时用 PackBatch 先按高度降序排序再放置，利用率接近 MaxRects。
+ *
+ * 可用区域可以扩大 (Grow)，已放置的矩形位置不变。
+ */
+class RectPacker {
+public:
+	struct Rect {
+		uint32_t X = 0;
+		uint32_t Y = 0;
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+	};
+
+	// 批量放置的输入与输出
+	struct BatchEntry {
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		Rect Result;
+		bool Packed = false;
+	};
+
+	RectPacker(uint32_t width = 0, uint32_t height = 0);
+
+	// 清空并重新设定可用区域
+	void Reset(uint32_t width, uint32_t height);
+	// 放置一个矩形，放不下时返回 false
+	bool Pack(uint32_t width, uint32_t height, Rect& result);
+	// 按高度降序（再按宽度）依次放置，返回放下的数量；结果写回对应的条目
+	uint32_t PackBatch(std::span<BatchEntry> entries);
+	// 扩大可用区域（不能缩小）
+	void Grow(uint32_t width, uint32_t height);
+
+	inline uint32_t GetWidth() const { return m_Width; }
+	inline uint32_t GetHeight() const { return m_Height; }
+	inline uint64_t GetUsedArea() const { return m_UsedArea; }
+	// 已放置矩形的面积占总面积的比例
+	float GetOccupancy() const;
+private:
+	struct SkylineNode {
+		uint32_t X;
+		uint32_t Y;
+		uint32_t Width;
+	};
+
+	// 以第 index 条线段为左端放置时矩形的底边 y，放不下时返回 false
+	bool Fit(size_t index, uint32_t width, uint32_t height, uint32_t& y) const;
+	void AddLevel(size_t index, const Rect& rect);
+private:
+	uint32_t m_Width = 0;
+	uint32_t m_Height = 0;
+	uint64_t m_UsedArea = 0;
+	std::vector<SkylineNode> m_Skyline;
+};
+}
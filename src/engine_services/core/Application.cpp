@@ -1,16 +1,19 @@
 #include "Application.h"
 #include "core/CoreTime.h"
+#include "core/JobSystem.h"
 #include "core/Core.h"
 #include "core/Log.h"
 #include "engine_services/renderer/Renderer.h"
+#include "engine_services/renderer/GpuProfiler.h"
 #include <glad/glad.h>
+#include <chrono>
 
 namespace GE {
     
 Ref<Application> Application::s_Instance = nullptr;
 bool Application::s_allowConstruction = false;
 
-Application::Application() {
+Application::Application(const WindowProps& props) {
     if (!s_allowConstruction) {
         ASSERT_ENGINE(false, "Application must be created via CreateApplication()");
     }
@@ -18,16 +21,22 @@ Application::Application() {
         ASSERT_ENGINE(false, "Application already exists!");
     }
     Time::Init();
-    m_Window = IWindow::Create();
+    JobSystem::Init();
+    m_Window = IWindow::Create(props);
+    RenderThread::Init(m_Window->GetContext());
 
     //TODO: Renderer,Physics2D,...
     Renderer::Init();
+    Renderer::OnWindowResize(m_Window->GetWidth(), m_Window->GetHeight());
 
     m_Window->SetEventCallback(BIND_EVENT_FN(Application::OnEvent));
 
-    auto imguiLayer = CreateScope<ImGuiLayer>();
-	m_ImGuiLayer = imguiLayer.get();
-	PushOverlayer(std::move(imguiLayer));
+    // ImGui 的平台层需要 GLFW 窗口
+    if (m_Window->GetNativeWindow()) {
+        auto imguiLayer = CreateScope<ImGuiLayer>();
+        m_ImGuiLayer = imguiLayer.get();
+        PushOverlayer(std::move(imguiLayer));
+    }
 }
 
 
@@ -46,26 +55,49 @@ void Application::Run() {
 	while (m_Running) {
 		Time::Update();
 		Timestep timestep = Time::GetDeltaTime();
+        const auto frameStart = std::chrono::steady_clock::now();
 
         for(const auto& layer : m_LayerStack) {
             layer->OnUpdate(timestep);
         }
 
         // 渲染更新
-        Renderer::BeginScene();
+        Renderer::BeginFrame();
+        GpuProfiler::BeginScope("Scene");
+        if (m_DynamicResolution) {
+            m_DynamicResolution->Update(m_CpuFrameTime);
+            m_DynamicResolution->BeginScene();
+        } else {
+            Renderer::BeginScene();
+        }
         for(const auto& layer : m_LayerStack) {
             layer->OnRender();
         }
-        Renderer::EndScene();
-
-        //TODO: Render thread, ImGuiRender
-        m_ImGuiLayer->Begin();
-        for(const auto& layer : m_LayerStack) {
-            layer->OnImGuiRender();
+        if (m_DynamicResolution) {
+            m_DynamicResolution->EndScene();
+        } else {
+            Renderer::EndScene();
+        }
+        GpuProfiler::EndScope();
+
+        if (m_ImGuiLayer) {
+            GpuProfiler::BeginScope("ImGui");
+            m_ImGuiLayer->Begin();
+            for(const auto& layer : m_LayerStack) {
+                layer->OnImGuiRender();
+            }
+            m_ImGuiLayer->End();
+            GpuProfiler::EndScope();
+        }
+        Renderer::EndFrame();
+        // 交换缓冲区可能等待垂直同步，不计入 CPU 时间；多线程模式下也不含等待渲染线程的时间
+        m_CpuFrameTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+        // 单线程时交换缓冲区，多线程时把本帧的命令交给渲染线程
+        RenderThread::EndFrame();
+        m_Window->PollEvents();
+        if (m_RenderThreadPolicy != RenderThread::GetPolicy()) {
+            RenderThread::SetPolicy(m_RenderThreadPolicy);
         }
-        m_ImGuiLayer->End();
-        // PollEvents + SwapBuffers
-		m_Window->Update();
 	}
 }
 
@@ -102,14 +134,34 @@ bool Application::OnWindowResize(WindowResizeEvent& e) {
         return false;
     }
     Renderer::OnWindowResize(e.GetWidth(), e.GetHeight());
+    if (m_DynamicResolution) {
+        m_DynamicResolution->SetOutputSize(e.GetWidth(), e.GetHeight());
+    }
     return false;
 }
 
+void Application::EnableDynamicResolution(const DynamicResolutionSpecification& specification) {
+    m_DynamicResolution = CreateScope<DynamicResolution>(specification, m_Window->GetWidth(), m_Window->GetHeight());
+}
+
+void Application::DisableDynamicResolution() {
+    m_DynamicResolution.reset();
+}
+
+void Application::SetRenderThreadPolicy(RenderThreadPolicy policy) {
+    m_RenderThreadPolicy = policy;
+}
+
 void Application::Shutdown() {
 	LOG_INFO_ENGINE("Application::Shutdown begin");
 	m_Running = false;
+	// 执行完剩余的命令并把上下文交还主线程，之后的清理都在主线程上进行
+	RenderThread::Shutdown();
 	// 先显式清理所有 Layer，确保 ImGui 等依赖的系统在窗口销毁前已被卸载
 	m_LayerStack.Clear();
+	m_DynamicResolution.reset();
+	Renderer::Shutdown();
+	JobSystem::Shutdown();
 	LOG_INFO_ENGINE("Application::Shutdown end");
 }
 }
\ No newline at end of file
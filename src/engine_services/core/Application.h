@@ -2,6 +2,8 @@
 #include "engine_services/core/Window.h"
 #include "engine_services/core/LayerStack.h"
 #include "engine_services/platform/imgui/ImGuiLayer.h"
+#include "engine_services/renderer/DynamicResolution.h"
+#include "engine_services/renderer/RenderThread.h"
 #include "core/events/ApplicationEvent.h"
 #include "core/events/Event.h"
 #include "core/Core.h"
@@ -9,7 +11,7 @@ namespace GE {
 
 class Application {
 protected:
-    Application();
+    Application(const WindowProps& props = WindowProps());
     Application(const Application&) = delete;
     Application& operator=(const Application&) = delete;
     Application(Application&&) = delete;
@@ -18,6 +20,8 @@ public:
     virtual ~Application();
     void Run();
     void Shutdown();
+    // 在当前帧结束后退出 Run，无窗口模式下没有关闭事件，由程序自己调用
+    inline void Close() { m_Running = false; }
     
     void OnEvent(Event& e);
     void PushLayer(Scope<Layer> layer);
@@ -26,6 +30,18 @@ public:
     static void SetInstance(const Ref<Application>& instance);
     inline static Application& Get() { return *s_Instance; }
     inline IWindow& GetWindow() { return *m_Window; }
+
+    // 开启动态分辨率：之后各层的 OnRender 渲染到按帧时间缩放的离屏目标，再放大到窗口
+    void EnableDynamicResolution(const DynamicResolutionSpecification& specification = {});
+    void DisableDynamicResolution();
+    // 未开启时为 nullptr
+    inline DynamicResolution* GetDynamicResolution() { return m_DynamicResolution.get(); }
+    // 上一帧 CPU 的工作时间（毫秒），与 GpuProfiler 的帧时间对比可判断瓶颈在哪一侧
+    inline float GetCpuFrameTime() const { return m_CpuFrameTime; }
+
+    // 切换渲染线程模式，在当前帧结束后生效；默认单线程
+    void SetRenderThreadPolicy(RenderThreadPolicy policy);
+    inline RenderThreadPolicy GetRenderThreadPolicy() const { return m_RenderThreadPolicy; }
 private:
     bool OnWindowClose(WindowCloseEvent& e);
     bool OnWindowResize(WindowResizeEvent& e);
@@ -36,7 +52,10 @@ private:
     bool m_Running = true;
     Scope<IWindow> m_Window;
     LayerStack m_LayerStack;
-    ImGuiLayer* m_ImGuiLayer;
+    ImGuiLayer* m_ImGuiLayer = nullptr; // 没有系统窗口时不创建
+    Scope<DynamicResolution> m_DynamicResolution;
+    float m_CpuFrameTime = 0.0f; // 上一帧 CPU 的工作时间（毫秒），不含交换缓冲区
+    RenderThreadPolicy m_RenderThreadPolicy = RenderThreadPolicy::SingleThreaded;
 };
 
 Ref<Application> CreateApplication();
@@ -6,5 +6,8 @@ public:
     virtual ~IGraphicsContext() = default;
     virtual void InitContext() = 0;
     virtual void SwapBuffers() = 0;
+    // 把上下文绑定到 / 解除于调用线程，用于在主线程与渲染线程之间移交
+    virtual void MakeCurrent() = 0;
+    virtual void ReleaseCurrent() = 0;
 };
 }
\ No newline at end of file
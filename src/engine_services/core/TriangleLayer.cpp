@@ -1,26 +1,29 @@
 #include "TriangleLayer.h"
 #include "engine_services/renderer/Renderer.h"
+#include "engine_services/renderer/VertexLayout.h"
 
 namespace GE {
 
+struct TriangleVertex {
+    Vec3 Position;
+};
+
 TriangleLayer::TriangleLayer() : Layer("TriangleLayer") {}
 
 void TriangleLayer::OnAttach() {
     // 定义三角形的顶点数据 (位置)
-    float vertices[3 * 3] = {
-        -0.5f, -0.5f, 0.0f,
-         0.5f, -0.5f, 0.0f,
-         0.0f,  0.5f, 0.0f
+    TriangleVertex vertices[3] = {
+        { Vec3(-0.5f, -0.5f, 0.0f) },
+        { Vec3( 0.5f, -0.5f, 0.0f) },
+        { Vec3( 0.0f,  0.5f, 0.0f) }
     };
 
     // 创建顶点缓冲
-    Ref<VertexBuffer> vertexBuffer = VertexBuffer::Create(vertices, sizeof(vertices));
+    Ref<VertexBuffer> vertexBuffer = VertexBuffer::Create(reinterpret_cast<float*>(vertices), sizeof(vertices));
 
-    // 设置缓冲布局
-    BufferLayout layout = {
-        { ShaderDataType::Float3, "a_Position" }
-    };
-    vertexBuffer->SetLayout(layout);
+    // 设置缓冲布局（由顶点结构体在编译期生成）
+    static constexpr BufferLayout s_Layout = MakeLayout<&TriangleVertex::Position>({ "a_Position" });
+    vertexBuffer->SetLayout(s_Layout);
 
     // 创建顶点数组并添加顶点缓冲
     m_VertexArray = VertexArray::Create();
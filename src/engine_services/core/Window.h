@@ -1,31 +1,41 @@
 #pragma once
 #include "core/Core.h"
 #include "core/events/Event.h"
+#include "GraphicsContext.h"
 #include <string>
 #include <functional>
+#include <utility>
 namespace GE {
 
 struct WindowProps {
     std::string m_Title;
     uint32_t m_Width;
     uint32_t m_Height;
+    // 不创建可见的系统窗口：Linux 上为 EGL 离屏上下文（HeadlessWindow），其他平台为隐藏的 GLFW 窗口
+    bool m_Headless;
     WindowProps(const std::string& title = "Grain Engine", 
-                uint32_t width = 1600, uint32_t height = 900)
-                : m_Title(title), m_Width(width), m_Height(height) {}
+                uint32_t width = 1600, uint32_t height = 900, bool headless = false)
+                : m_Title(title), m_Width(width), m_Height(height), m_Headless(headless) {}
 };
 
 class IWindow {
 public:
     using EventCallbackFn = std::function<void(Event&)>;
     virtual ~IWindow() = default;
+    // 处理窗口事件并交换缓冲区
     virtual void Update() = 0;
+    // 只处理窗口事件，交换缓冲区由 RenderThread 在持有上下文的线程上进行
+    virtual void PollEvents() = 0;
     virtual uint32_t GetWidth() const = 0;
     virtual uint32_t GetHeight() const = 0;
+    // 光标位置（窗口坐标，左上角为原点），取自最近一次处理的窗口事件，不查询系统
+    virtual std::pair<float, float> GetCursorPosition() const = 0;
 /**
  * @brief 获取底层的原生窗口句柄（GLFWwindow*）
  * @return 返回一个指向底层原生窗口对象的指针，调用者不应该删除此指针，其生命周期由窗口对象管理。
  */
     virtual void* GetNativeWindow() const = 0;
+    virtual IGraphicsContext* GetContext() const = 0;
     virtual void SetEventCallback(const EventCallbackFn& callback) = 0;
     virtual void SetVSync(bool enabled) = 0;
     virtual bool IsVSync() const = 0;
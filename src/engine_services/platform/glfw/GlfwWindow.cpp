@@ -4,6 +4,10 @@
 #include "core/events/MouseEvent.h"
 #include "core/events/ApplicationEvent.h"
 #include "engine_services/platform/opengl/OpenGLContext.h"
+#include "engine_services/renderer/RenderThread.h"
+#ifdef PLATFORM_LINUX
+    #include "engine_services/platform/headless/HeadlessWindow.h"
+#endif
 #include <GLFW/glfw3.h>
 
 namespace GE {
@@ -15,6 +19,11 @@ static void GLFWErrorCallback(int error, const char* description) {
 }
 
 Scope<IWindow> IWindow::Create(const WindowProps& props) {
+#ifdef PLATFORM_LINUX
+    if (props.m_Headless) {
+        return CreateScope<HeadlessWindow>(props);
+    }
+#endif
     return CreateScope<GlfwWindow>(props);
 }
 
@@ -41,6 +50,8 @@ void GlfwWindow::Init(const WindowProps& props) {
         glfwSetErrorCallback(GLFWErrorCallback);
     }
 
+    // 没有 EGL 的平台上，无窗口模式退化为隐藏的窗口
+    glfwWindowHint(GLFW_VISIBLE, props.m_Headless ? GLFW_FALSE : GLFW_TRUE);
     m_Window = glfwCreateWindow(static_cast<int>(props.m_Width), static_cast<int>(props.m_Height), m_Data.title.c_str(), nullptr, nullptr);
     if(!m_Window) {
         LOG_CRITIVAL_ENGINE("Failed to create GLFW window!");
@@ -53,6 +64,11 @@ void GlfwWindow::Init(const WindowProps& props) {
     
     glfwSetWindowUserPointer(m_Window, &m_Data);
     SetVSync(true);
+    // 之后由光标回调更新
+    double cursorX = 0.0, cursorY = 0.0;
+    glfwGetCursorPos(m_Window, &cursorX, &cursorY);
+    m_Data.cursorX = static_cast<float>(cursorX);
+    m_Data.cursorY = static_cast<float>(cursorY);
 
     glfwSetWindowCloseCallback(m_Window, [](GLFWwindow* window) {
         WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
@@ -113,6 +129,8 @@ void GlfwWindow::Init(const WindowProps& props) {
 
 	glfwSetCursorPosCallback(m_Window, [](GLFWwindow* window, double xPos, double yPos) {
 		WindowData& data = *(WindowData*)glfwGetWindowUserPointer(window);
+		data.cursorX = static_cast<float>(xPos);
+		data.cursorY = static_cast<float>(yPos);
 		MouseMovedEvent event(static_cast<float>(xPos), static_cast<float>(yPos));
 		data.eventCallback(event);
 	});
@@ -145,19 +163,21 @@ void GlfwWindow::Shutdown() {
 }
 
 void GlfwWindow::Update() {
-    glfwPollEvents();
+    PollEvents();
     if (m_Context) {
         m_Context->SwapBuffers();
     }
 }
 
+void GlfwWindow::PollEvents() {
+    glfwPollEvents();
+}
+
 void GlfwWindow::SetVSync(bool enabled) {
-    if(enabled) {
-        glfwSwapInterval(1);
-    }
-    else {
-        glfwSwapInterval(0);
-    }
+    // 交换间隔作用于当前上下文，需在持有上下文的线程上设置
+    RenderThread::Submit([enabled]() {
+        glfwSwapInterval(enabled ? 1 : 0);
+    });
     m_Data.VSync = enabled;
 }
 
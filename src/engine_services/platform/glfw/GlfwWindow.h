@@ -9,9 +9,12 @@ public:
     GlfwWindow(const WindowProps& props);
     ~GlfwWindow();
     void Update() override;
+    void PollEvents() override;
     inline uint32_t GetWidth() const override { return m_Data.width; }
     inline uint32_t GetHeight() const override { return m_Data.height; }
+    inline std::pair<float, float> GetCursorPosition() const override { return { m_Data.cursorX, m_Data.cursorY }; }
     inline void* GetNativeWindow() const override { return m_Window; }
+    inline IGraphicsContext* GetContext() const override { return m_Context.get(); }
     inline void SetEventCallback(const EventCallbackFn& callback) override { m_Data.eventCallback = callback;}
     void SetVSync(bool enabled) override;
     bool IsVSync() const override;
@@ -24,6 +27,7 @@ private:
         std::string title;
         uint32_t width, height;
         bool VSync;
+        float cursorX = 0.0f, cursorY = 0.0f;
         EventCallbackFn eventCallback;
     };
     WindowData m_Data;
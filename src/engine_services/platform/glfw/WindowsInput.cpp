@@ -8,21 +8,25 @@ Scope<Input> Input::s_Instance = CreateScope<WindowsInput>();
 
 bool WindowsInput::IsKeyPressedImpl(uint32_t keycode) {
 	auto window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
+	if (!window) {
+		return false; // 无窗口模式没有输入
+	}
 	auto state = glfwGetKey(window, keycode);
 	return state == GLFW_PRESS || state == GLFW_REPEAT;
 }
 
 bool WindowsInput::IsMouseButtonPressedImpl(int button) {
 	auto window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
+	if (!window) {
+		return false;
+	}
 	auto state = glfwGetMouseButton(window, button);
 	return state == GLFW_PRESS;
 }
 
 std::pair<float, float> WindowsInput::GetMousePositionImpl() {
-	auto window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
-	double xpos, ypos;
-	glfwGetCursorPos(window, &xpos, &ypos);
-	return { static_cast<float>(xpos), static_cast<float>(ypos) };
+	// 窗口在处理光标事件时已记录位置，不必每次调用 glfwGetCursorPos
+	return Application::Get().GetWindow().GetCursorPosition();
 }
 
 float WindowsInput::GetMouseXImpl() {
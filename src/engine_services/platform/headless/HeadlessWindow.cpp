@@ -0,0 +1,20 @@
+#include "HeadlessWindow.h"
+#include "core/Log.h"
+
+namespace GE {
+
+HeadlessWindow::HeadlessWindow(const WindowProps& props)
+	: m_Width(props.m_Width), m_Height(props.m_Height) {
+	LOG_INFO_ENGINE("Creating headless window {0} ({1}, {2})", props.m_Title, props.m_Width, props.m_Height);
+	m_Context = CreateScope<OpenGLHeadlessContext>(m_Width, m_Height);
+	m_Context->InitContext();
+	if (!m_Context->IsValid()) {
+		LOG_CRITIVAL_ENGINE("Failed to create headless window!");
+	}
+}
+
+void HeadlessWindow::Update() {
+	PollEvents();
+	m_Context->SwapBuffers();
+}
+}
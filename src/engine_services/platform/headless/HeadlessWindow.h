@@ -0,0 +1,36 @@
+#pragma once
+#include "engine_services/core/Window.h"
+#include "OpenGLHeadlessContext.h"
+
+// ---------------------------------------------------------------------
+// 类: HeadlessWindow
+// 作用: 没有系统窗口的 IWindow（仅 Linux）
+// 描述: WindowProps::m_Headless 为 true 时由 IWindow::Create 创建，持有一个 OpenGLHeadlessContext，
+//       尺寸固定为创建时的大小。没有任何窗口事件，GetNativeWindow 返回 nullptr，
+//       Application 据此不创建 ImGuiLayer，Input 的查询都返回未按下；程序由 Application::Close 结束。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class HeadlessWindow : public IWindow {
+public:
+	HeadlessWindow(const WindowProps& props);
+	~HeadlessWindow() = default;
+
+	void Update() override;
+	void PollEvents() override {}
+	inline uint32_t GetWidth() const override { return m_Width; }
+	inline uint32_t GetHeight() const override { return m_Height; }
+	inline std::pair<float, float> GetCursorPosition() const override { return { 0.0f, 0.0f }; }
+	inline void* GetNativeWindow() const override { return nullptr; }
+	inline IGraphicsContext* GetContext() const override { return m_Context.get(); }
+	inline void SetEventCallback(const EventCallbackFn&) override {}
+	// 没有显示器可以同步，只记录设置
+	inline void SetVSync(bool enabled) override { m_VSync = enabled; }
+	inline bool IsVSync() const override { return m_VSync; }
+private:
+	Scope<OpenGLHeadlessContext> m_Context;
+	uint32_t m_Width, m_Height;
+	bool m_VSync = false;
+};
+}
@@ -0,0 +1,200 @@
+#include "OpenGLHeadlessContext.h"
+#include "engine_services/platform/opengl/OpenGLContext.h"
+#include "core/Core.h"
+#include "core/Log.h"
+
+#include <glad/glad.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <cstring>
+#include <iterator>
+
+namespace GE {
+
+// 扩展列表中是否有完整的 name（避免 EGL_EXT_platform_device 匹配到 EGL_EXT_platform_device_xxx）
+static bool HasExtension(const char* extensions, const char* name) {
+	if (!extensions) {
+		return false;
+	}
+	const size_t length = std::strlen(name);
+	for (const char* found = std::strstr(extensions, name); found; found = std::strstr(found + length, name)) {
+		if ((found == extensions || found[-1] == ' ') && (found[length] == ' ' || found[length] == '\0')) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool InitializeDisplay(EGLDisplay display, const char* platform) {
+	if (display == EGL_NO_DISPLAY) {
+		return false;
+	}
+	EGLint major = 0, minor = 0;
+	if (!eglInitialize(display, &major, &minor)) {
+		LOG_WARN_ENGINE("EGL: failed to initialize {0} display (0x{1:x})", platform, eglGetError());
+		return false;
+	}
+	LOG_INFO_ENGINE("EGL {0}.{1} ({2}): {3}", major, minor, platform, eglQueryString(display, EGL_VENDOR));
+	return true;
+}
+
+OpenGLHeadlessContext::OpenGLHeadlessContext(uint32_t width, uint32_t height)
+	: m_Width(width), m_Height(height) {
+	ASSERT_ENGINE(width > 0 && height > 0, "Headless context size must be positive!");
+}
+
+OpenGLHeadlessContext::~OpenGLHeadlessContext() {
+	Destroy();
+}
+
+void OpenGLHeadlessContext::InitContext() {
+	if (!InitDisplay() || !CreateContext()) {
+		LOG_CRITIVAL_ENGINE("Failed to create headless OpenGL context!");
+		Destroy();
+		return;
+	}
+	MakeCurrent();
+	OpenGLContext::LoadFunctions((OpenGLContext::LoadProc)eglGetProcAddress);
+	if (!m_Surface) {
+		LOG_WARN_ENGINE("EGL: no pbuffer surface, rendering must target a Framebuffer");
+	}
+}
+
+bool OpenGLHeadlessContext::InitDisplay() {
+	// 客户端扩展（EGL_NO_DISPLAY 查询），不支持时返回 nullptr
+	const char* extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+	auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+	if (getPlatformDisplay && HasExtension(extensions, "EGL_EXT_platform_device")) {
+		// 直接选择设备，不经过任何窗口系统；Mesa 在没有 GPU 时也会列出软件设备
+		auto queryDevices = (PFNEGLQUERYDEVICESEXTPROC)eglGetProcAddress("eglQueryDevicesEXT");
+		EGLDeviceEXT device = nullptr;
+		EGLint count = 0;
+		if (queryDevices && queryDevices(1, &device, &count) && count > 0) {
+			EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, device, nullptr);
+			if (InitializeDisplay(display, "device")) {
+				m_Display = display;
+				return true;
+			}
+		}
+	}
+	if (getPlatformDisplay && HasExtension(extensions, "EGL_MESA_platform_surfaceless")) {
+		EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+		if (InitializeDisplay(display, "surfaceless")) {
+			m_Display = display;
+			return true;
+		}
+	}
+	// 旧的驱动：由 EGL 自己选择平台，没有显示器时可能失败
+	EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	if (InitializeDisplay(display, "default")) {
+		m_Display = display;
+		return true;
+	}
+	return false;
+}
+
+bool OpenGLHeadlessContext::CreateContext() {
+	if (!eglBindAPI(EGL_OPENGL_API)) {
+		LOG_ERROR_ENGINE("EGL: desktop OpenGL is not supported (0x{0:x})", eglGetError());
+		return false;
+	}
+
+	// 与窗口的默认帧缓冲一致：RGBA8 + D24S8
+	const EGLint pbufferConfigAttributes[] = {
+		EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+		EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+		EGL_DEPTH_SIZE, 24, EGL_STENCIL_SIZE, 8,
+		EGL_NONE
+	};
+	EGLConfig config = nullptr;
+	EGLint configCount = 0;
+	if (!eglChooseConfig(m_Display, pbufferConfigAttributes, &config, 1, &configCount) || configCount == 0) {
+		config = nullptr;
+		if (!HasExtension(eglQueryString(m_Display, EGL_EXTENSIONS), "EGL_KHR_surfaceless_context")) {
+			LOG_ERROR_ENGINE("EGL: display supports neither pbuffers nor surfaceless contexts");
+			return false;
+		}
+		// 不要求任何表面类型
+		const EGLint surfacelessConfigAttributes[] = {
+			EGL_SURFACE_TYPE, 0,
+			EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+			EGL_NONE
+		};
+		if (!eglChooseConfig(m_Display, surfacelessConfigAttributes, &config, 1, &configCount) || configCount == 0) {
+			LOG_ERROR_ENGINE("EGL: no OpenGL config (0x{0:x})", eglGetError());
+			return false;
+		}
+	} else {
+		const EGLint surfaceAttributes[] = {
+			EGL_WIDTH, static_cast<EGLint>(m_Width),
+			EGL_HEIGHT, static_cast<EGLint>(m_Height),
+			EGL_NONE
+		};
+		m_Surface = eglCreatePbufferSurface(m_Display, config, surfaceAttributes);
+		if (m_Surface == EGL_NO_SURFACE) {
+			LOG_WARN_ENGINE("EGL: failed to create {0}x{1} pbuffer (0x{2:x})", m_Width, m_Height, eglGetError());
+			m_Surface = nullptr;
+		}
+	}
+
+	// 从高到低尝试核心上下文，llvmpipe 目前最高为 4.5
+	static const EGLint versions[][2] = { { 4, 6 }, { 4, 5 }, { 4, 3 }, { 3, 3 } };
+	for (size_t i = 0; i < std::size(versions) && !m_Context; ++i) {
+		const EGLint contextAttributes[] = {
+			EGL_CONTEXT_MAJOR_VERSION, versions[i][0],
+			EGL_CONTEXT_MINOR_VERSION, versions[i][1],
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			EGL_NONE
+		};
+		EGLContext context = eglCreateContext(m_Display, config, EGL_NO_CONTEXT, contextAttributes);
+		if (context != EGL_NO_CONTEXT) {
+			m_Context = context;
+		}
+	}
+	if (!m_Context) {
+		LOG_ERROR_ENGINE("EGL: failed to create an OpenGL 3.3+ core context (0x{0:x})", eglGetError());
+		return false;
+	}
+	return true;
+}
+
+void OpenGLHeadlessContext::Destroy() {
+	if (!m_Display) {
+		return;
+	}
+	eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	if (m_Context) {
+		eglDestroyContext(m_Display, m_Context);
+		m_Context = nullptr;
+	}
+	if (m_Surface) {
+		eglDestroySurface(m_Display, m_Surface);
+		m_Surface = nullptr;
+	}
+	eglTerminate(m_Display);
+	m_Display = nullptr;
+}
+
+void OpenGLHeadlessContext::SwapBuffers() {
+	// pbuffer 没有后缓冲，eglSwapBuffers 不做任何事；只把本帧的命令提交给驱动
+	if (m_Context) {
+		glFlush();
+	}
+}
+
+void OpenGLHeadlessContext::MakeCurrent() {
+	if (m_Context) {
+		EGLSurface surface = m_Surface ? m_Surface : EGL_NO_SURFACE;
+		if (!eglMakeCurrent(m_Display, surface, surface, m_Context)) {
+			LOG_ERROR_ENGINE("EGL: eglMakeCurrent failed (0x{0:x})", eglGetError());
+		}
+	}
+}
+
+void OpenGLHeadlessContext::ReleaseCurrent() {
+	if (m_Display) {
+		eglMakeCurrent(m_Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	}
+}
+}
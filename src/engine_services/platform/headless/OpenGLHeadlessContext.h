@@ -0,0 +1,46 @@
+#pragma once
+#include "engine_services/core/GraphicsContext.h"
+#include <cstdint>
+
+// ---------------------------------------------------------------------
+// 类: OpenGLHeadlessContext
+// 作用: 不依赖窗口系统的 OpenGL 上下文（EGL，仅 Linux）
+// 描述: 用于没有显示器的构建服务器，配合 Mesa llvmpipe 可以完全用软件运行 OpenGL 渲染器。
+//       display 依次尝试 EGL_EXT_platform_device 的第一个设备、EGL_MESA_platform_surfaceless
+//       与 eglGetDisplay(EGL_DEFAULT_DISPLAY)，在第一个能初始化的 display 上创建 4.6 到 3.3 中最高的核心上下文。
+//       默认帧缓冲是与窗口同样大小的 pbuffer 表面，渲染器对帧缓冲 0 的绘制、视口与回读照常工作；
+//       display 不支持 pbuffer 时退化为无表面上下文（EGL_KHR_surfaceless_context），此时只能绘制到 Framebuffer。
+//       SwapBuffers 只提交命令，没有垂直同步。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class OpenGLHeadlessContext : public IGraphicsContext {
+public:
+	OpenGLHeadlessContext(uint32_t width, uint32_t height);
+	virtual ~OpenGLHeadlessContext();
+	OpenGLHeadlessContext(const OpenGLHeadlessContext&) = delete;
+	OpenGLHeadlessContext& operator=(const OpenGLHeadlessContext&) = delete;
+
+	virtual void InitContext() override;
+	virtual void SwapBuffers() override;
+	virtual void MakeCurrent() override;
+	virtual void ReleaseCurrent() override;
+
+	// InitContext 成功创建上下文后为 true
+	inline bool IsValid() const { return m_Context != nullptr; }
+	// 没有 pbuffer 表面时为 false，帧缓冲 0 不可用
+	inline bool HasDefaultFramebuffer() const { return m_Surface != nullptr; }
+private:
+	// 按上面的顺序取得并初始化 display，失败时返回 false
+	bool InitDisplay();
+	bool CreateContext();
+	void Destroy();
+private:
+	// EGLDisplay / EGLSurface / EGLContext 都是不透明指针，头文件中不引入 EGL
+	void* m_Display = nullptr;
+	void* m_Surface = nullptr;
+	void* m_Context = nullptr;
+	uint32_t m_Width, m_Height;
+};
+}
@@ -7,8 +7,12 @@
 #include <cstdio>
 #include "core/Log.h"
 #include "engine_services/core/Application.h"
+#include "engine_services/renderer/GpuProfiler.h"
+#include "engine_services/renderer/RendererStatistics.h"
+#include "engine_services/renderer/RenderThread.h"
 #include <filesystem>
 #include <chrono>
+#include <cfloat>
 
 namespace GE {
 
@@ -149,12 +153,121 @@ void ImGuiLayer::OnImGuiRender() {
 	ImGui::Begin("My Window");
     ImGui::Text("Hello, world!");
     ImGui::End();
+	if (m_ShowGpuProfiler) {
+		DrawGpuProfiler();
+	}
+	if (m_ShowRendererStatistics) {
+		DrawRendererStatistics();
+	}
+}
+
+// 按时间顺序（最早的在左）绘制历史中的某一项
+template<typename Getter>
+static void PlotStatistic(const char* label, Getter getter, int precision, const char* unit) {
+	const int count = static_cast<int>(RendererStatistics::GetHistoryCount());
+	if (count == 0) {
+		return;
+	}
+	char overlay[64];
+	snprintf(overlay, sizeof(overlay), "%.*f%s", precision, static_cast<double>(getter(RendererStatistics::GetFrame(0))), unit);
+	ImGui::PlotLines(label, [](void* data, int index) -> float {
+		const int historyCount = static_cast<int>(RendererStatistics::GetHistoryCount());
+		return (*static_cast<Getter*>(data))(RendererStatistics::GetFrame(static_cast<uint32_t>(historyCount - 1 - index)));
+	}, &getter, count, 0, overlay, 0.0f, FLT_MAX, ImVec2(0.0f, 50.0f));
+}
+
+void ImGuiLayer::DrawRendererStatistics() {
+	if (!ImGui::Begin("Renderer Statistics", &m_ShowRendererStatistics)) {
+		ImGui::End();
+		return;
+	}
+	const RendererFrameStatistics stats = RendererStatistics::GetFrame(0);
+	ImGui::Text("Frame %llu: %.2f ms (GPU %.2f ms)", static_cast<unsigned long long>(stats.FrameIndex),
+		static_cast<double>(stats.FrameTime), static_cast<double>(stats.GpuFrameTime));
+	ImGui::Text("Draw calls: %u (indirect commands: %u)", stats.DrawCalls, stats.IndirectCommands);
+	ImGui::Text("Vertices: %llu  Triangles: %llu", static_cast<unsigned long long>(stats.Vertices), static_cast<unsigned long long>(stats.Triangles));
+	ImGui::Text("Binds: shader %u, vertex array %u, texture %u, framebuffer %u",
+		stats.ShaderBinds, stats.VertexArrayBinds, stats.TextureBinds, stats.FramebufferBinds);
+	ImGui::Text("Buffer uploads: %u (%.1f KB, %u stalls)", stats.BufferUploads, static_cast<double>(stats.BufferUploadBytes) / 1024.0, stats.BufferStalls);
+	ImGui::Text("Texture uploads: %u (%.1f KB)", stats.TextureUploads, static_cast<double>(stats.TextureUploadBytes) / 1024.0);
+
+	PlotStatistic("Frame (ms)", [](const RendererFrameStatistics& frame) { return frame.FrameTime; }, 2, " ms");
+	PlotStatistic("GPU (ms)", [](const RendererFrameStatistics& frame) { return frame.GpuFrameTime; }, 2, " ms");
+	PlotStatistic("Draw calls", [](const RendererFrameStatistics& frame) { return static_cast<float>(frame.DrawCalls); }, 0, "");
+	PlotStatistic("Upload (KB)", [](const RendererFrameStatistics& frame) {
+		return static_cast<float>(static_cast<double>(frame.BufferUploadBytes + frame.TextureUploadBytes) / 1024.0);
+	}, 1, " KB");
+	ImGui::End();
+}
+
+void ImGuiLayer::DrawGpuProfiler() {
+	if (!ImGui::Begin("GPU Profiler", &m_ShowGpuProfiler)) {
+		ImGui::End();
+		return;
+	}
+	bool enabled = GpuProfiler::IsEnabled();
+	if (ImGui::Checkbox("Enabled", &enabled)) {
+		GpuProfiler::SetEnabled(enabled);
+	}
+	const GpuProfileFrame frame = GpuProfiler::GetLastFrame();
+	const float cpuTime = Application::Get().GetCpuFrameTime();
+	ImGui::Text("CPU: %.2f ms   GPU: %.2f ms (avg %.2f)", static_cast<double>(cpuTime),
+		static_cast<double>(frame.Milliseconds), static_cast<double>(frame.AverageMilliseconds));
+	// 两者中较大的一方决定帧时间
+	ImGui::Text("Bound: %s", frame.FrameIndex == 0 ? "-" : (frame.AverageMilliseconds > cpuTime ? "GPU" : "CPU"));
+
+	if (ImGui::BeginTable("GpuScopes", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp)) {
+		ImGui::TableSetupColumn("Scope");
+		ImGui::TableSetupColumn("ms");
+		ImGui::TableSetupColumn("avg ms");
+		ImGui::TableSetupColumn("count");
+		ImGui::TableHeadersRow();
+		for (const GpuProfileScope& scope : frame.Scopes) {
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			// Indent(0) 会使用默认缩进，顶层不缩进
+			const float indent = static_cast<float>(scope.Depth) * 12.0f;
+			if (indent > 0.0f) ImGui::Indent(indent);
+			ImGui::TextUnformatted(scope.Name.c_str());
+			if (indent > 0.0f) ImGui::Unindent(indent);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", static_cast<double>(scope.Milliseconds));
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", static_cast<double>(scope.AverageMilliseconds));
+			ImGui::TableNextColumn();
+			ImGui::Text("%u", scope.Count);
+		}
+		ImGui::EndTable();
+	}
+	ImGui::End();
 }
 
+// 多线程模式下渲染线程使用的绘制数据：ImGui 在下一帧会改写自己的 draw lists，这里持有它们的副本
+struct ImGuiDrawSnapshot {
+	ImDrawData DrawData;
+
+	~ImGuiDrawSnapshot() {
+		for (ImDrawList* drawList : DrawData.CmdLists) {
+			IM_DELETE(drawList);
+		}
+	}
+};
+
 //每帧开始时调用
 void ImGuiLayer::Begin() {
-	// 启动各个后端的帧更新
-	ImGui_ImplOpenGL3_NewFrame();
+	ImGuiIO& io = ImGui::GetIO();
+	// 多视口需要在持有上下文的线程上切换各个平台窗口的上下文，多线程渲染期间暂时关闭
+	if (RenderThread::IsMultiThreaded() && (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)) {
+		io.ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+		ImGui::DestroyPlatformWindows();
+		m_ViewportsSuspended = true;
+		LOG_INFO_ENGINE("ImGui multi-viewports are disabled while the render thread is running");
+	} else if (!RenderThread::IsMultiThreaded() && m_ViewportsSuspended) {
+		io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+		m_ViewportsSuspended = false;
+	}
+	// 启动各个后端的帧更新（OpenGL 后端可能创建设备对象，在渲染线程上执行）
+	RenderThread::Submit([]() { ImGui_ImplOpenGL3_NewFrame(); });
 	ImGui_ImplGlfw_NewFrame();
 	// 告诉 ImGui 开始新的一帧
 	ImGui::NewFrame();
@@ -173,7 +286,26 @@ void ImGuiLayer::End() {
 	
 	// 2. 执行实际的 OpenGL 渲染
 	// 将生成的 draw lists 转换为 OpenGL 命令绘制到屏幕上
-	ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+	ImDrawData* drawData = ImGui::GetDrawData();
+	if (!RenderThread::IsMultiThreaded()) {
+		ImGui_ImplOpenGL3_RenderDrawData(drawData);
+	} else {
+		// 字体等纹理的更新会读取并修改 ImGui 持有的纹理数据，同步执行
+		if (drawData->Textures) {
+			for (ImTextureData* texture : *drawData->Textures) {
+				if (texture->Status != ImTextureStatus_OK) {
+					RenderThread::Invoke([texture]() { ImGui_ImplOpenGL3_UpdateTexture(texture); });
+				}
+			}
+		}
+		Ref<ImGuiDrawSnapshot> snapshot = CreateRef<ImGuiDrawSnapshot>();
+		snapshot->DrawData = *drawData;
+		snapshot->DrawData.Textures = nullptr;
+		for (ImDrawList*& drawList : snapshot->DrawData.CmdLists) {
+			drawList = drawList->CloneOutput();
+		}
+		RenderThread::Submit([snapshot]() { ImGui_ImplOpenGL3_RenderDrawData(&snapshot->DrawData); });
+	}
 	// 3. 处理多视口 (Multi-Viewports)
 	if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) {
 		// 因为 Viewports 可能会创建新的原生 Win32/GLFW 窗口，
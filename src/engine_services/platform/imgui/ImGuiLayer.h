@@ -19,9 +19,20 @@ public:
     //渲染指令提交和多视口窗口更新
     void End();
     void BlockEvents(bool block) { m_BlockEvents = block; }
+    void ShowGpuProfiler(bool show) { m_ShowGpuProfiler = show; }
+    void ShowRendererStatistics(bool show) { m_ShowRendererStatistics = show; }
+private:
+    // GPU 每帧耗时与各作用域的耗时表
+    void DrawGpuProfiler();
+    // 最近一帧的渲染统计与历史曲线
+    void DrawRendererStatistics();
 private:
     float m_Time = 0.0f;
     bool m_BlockEvents = true;
+    bool m_ShowGpuProfiler = true;
+    bool m_ShowRendererStatistics = true;
+    // 多线程渲染期间暂时关闭的多视口，回到单线程后恢复
+    bool m_ViewportsSuspended = false;
     // 保存初始化时的 GLFW 窗口指针，用于在 OnDetach 恢复上下文
     void* m_Window = nullptr;
 };
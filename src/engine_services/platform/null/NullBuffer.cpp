@@ -0,0 +1,163 @@
+#include "NullBuffer.h"
+#include "engine_services/renderer/RendererStatistics.h"
+#include <cstring>
+
+namespace GE {
+
+static inline void CountUpload(uint64_t size) {
+	RendererFrameStatistics& stats = RendererStatistics::Current();
+	stats.BufferUploads++;
+	stats.BufferUploadBytes += size;
+}
+
+static inline void RecordBind(uint32_t id, bool bind, uint32_t binding = 0) {
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::BindBuffer, id, { binding }, bind ? 0 : 1));
+}
+
+static inline void RecordCreate(uint32_t id, NullBufferKind kind, uint32_t size, const void* data = nullptr, uint32_t dataSize = 0) {
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::CreateBuffer, id, { size }, static_cast<uint8_t>(kind)),
+		data, data ? dataSize : 0, true);
+}
+
+static inline void RecordData(uint32_t id, uint32_t offset, const void* data, uint32_t size) {
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::SetBufferData, id, { offset }), data, size, true);
+	CountUpload(size);
+}
+
+NullVertexBuffer::NullVertexBuffer(uint32_t size)
+	: m_Size(size) {
+	RecordCreate(m_ID, NullBufferKind::DynamicVertex, size);
+}
+
+NullVertexBuffer::NullVertexBuffer(float* vertices, uint32_t size)
+	: m_Size(size) {
+	RecordCreate(m_ID, NullBufferKind::Vertex, size, vertices, size);
+}
+
+void NullVertexBuffer::Bind() const {
+	RecordBind(m_ID, true);
+}
+
+void NullVertexBuffer::Unbind() const {
+	RecordBind(m_ID, false);
+}
+
+void NullVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+	ASSERT_ENGINE(static_cast<uint64_t>(offset) + size <= m_Size, "VertexBuffer::SetData out of range!");
+	RecordData(m_ID, offset, data, size);
+}
+
+void NullVertexBuffer::SetLayout(const BufferLayout& layout) {
+	m_Layout = layout;
+	std::vector<uint8_t> data;
+	SerializeBufferLayout(layout, data);
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::SetBufferLayout, m_ID), data.data(), static_cast<uint32_t>(data.size()));
+}
+
+NullIndexBuffer::NullIndexBuffer(uint32_t* indices, uint32_t count)
+	: m_Count(count) {
+	RecordCreate(m_ID, NullBufferKind::Index, count, indices, count * static_cast<uint32_t>(sizeof(uint32_t)));
+}
+
+void NullIndexBuffer::Bind() const {
+	RecordBind(m_ID, true);
+}
+
+void NullIndexBuffer::Unbind() const {
+	RecordBind(m_ID, false);
+}
+
+void NullIndexBuffer::SetData(const uint32_t* indices, uint32_t count, uint32_t offset) {
+	ASSERT_ENGINE(static_cast<uint64_t>(offset) + count <= m_Count, "IndexBuffer::SetData out of range!");
+	RecordData(m_ID, offset, indices, count * static_cast<uint32_t>(sizeof(uint32_t)));
+}
+
+NullIndirectBuffer::NullIndirectBuffer(uint32_t capacity)
+	: m_Capacity(capacity) {
+	RecordCreate(m_ID, NullBufferKind::Indirect, capacity);
+}
+
+void NullIndirectBuffer::Bind() const {
+	RecordBind(m_ID, true);
+}
+
+void NullIndirectBuffer::Unbind() const {
+	RecordBind(m_ID, false);
+}
+
+void NullIndirectBuffer::SetCommands(const DrawElementsIndirectCommand* commands, uint32_t count, uint32_t offset) {
+	ASSERT_ENGINE(static_cast<uint64_t>(offset) + count <= m_Capacity, "IndirectBuffer::SetCommands out of range!");
+	RecordData(m_ID, offset, commands, count * static_cast<uint32_t>(sizeof(DrawElementsIndirectCommand)));
+}
+
+NullStorageBuffer::NullStorageBuffer(uint32_t size)
+	: m_Size(size) {
+	RecordCreate(m_ID, NullBufferKind::Storage, size);
+}
+
+void NullStorageBuffer::Bind(uint32_t binding) const {
+	RecordBind(m_ID, true, binding);
+}
+
+void NullStorageBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+	ASSERT_ENGINE(static_cast<uint64_t>(offset) + size <= m_Size, "StorageBuffer::SetData out of range!");
+	RecordData(m_ID, offset, data, size);
+}
+
+struct SerializedLayoutHeader {
+	uint32_t ElementCount;
+	uint32_t Stride;
+};
+
+struct SerializedLayoutElement {
+	uint8_t Type;
+	uint8_t Normalized;
+	uint16_t NameLength;
+	uint32_t Offset;
+};
+
+void SerializeBufferLayout(const BufferLayout& layout, std::vector<uint8_t>& data) {
+	const auto append = [&data](const void* bytes, size_t size) {
+		const uint8_t* begin = static_cast<const uint8_t*>(bytes);
+		data.insert(data.end(), begin, begin + size);
+	};
+	const SerializedLayoutHeader header{ layout.GetElementCount(), layout.GetStride() };
+	append(&header, sizeof(header));
+	for (const BufferElement& element : layout) {
+		const size_t nameLength = std::strlen(element.Name);
+		const SerializedLayoutElement serialized{ static_cast<uint8_t>(element.Type), static_cast<uint8_t>(element.Normalized),
+			static_cast<uint16_t>(nameLength), static_cast<uint32_t>(element.Offset) };
+		append(&serialized, sizeof(serialized));
+		append(element.Name, nameLength);
+	}
+}
+
+BufferLayout DeserializeBufferLayout(const uint8_t* data, uint32_t size, std::deque<std::string>& names) {
+	SerializedLayoutHeader header;
+	if (size < sizeof(header)) {
+		return {};
+	}
+	std::memcpy(&header, data, sizeof(header));
+	std::array<BufferElement, BufferLayout::MaxElements> elements{};
+	uint32_t count = 0;
+	uint32_t position = sizeof(header);
+	for (uint32_t i = 0; i < header.ElementCount && count < BufferLayout::MaxElements; ++i) {
+		SerializedLayoutElement serialized;
+		if (position + sizeof(serialized) > size) {
+			break;
+		}
+		std::memcpy(&serialized, data + position, sizeof(serialized));
+		position += sizeof(serialized);
+		if (position + serialized.NameLength > size) {
+			break;
+		}
+		const std::string& name = names.emplace_back(reinterpret_cast<const char*>(data + position), serialized.NameLength);
+		position += serialized.NameLength;
+
+		BufferElement element(static_cast<ShaderDataType>(serialized.Type), name.c_str(), serialized.Normalized != 0);
+		element.Offset = serialized.Offset;
+		elements[count++] = element;
+	}
+	return BufferLayout(std::span<const BufferElement>(elements.data(), count), header.Stride);
+}
+}
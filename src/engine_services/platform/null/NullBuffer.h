@@ -0,0 +1,72 @@
+#pragma once
+#include "engine_services/renderer/Buffer.h"
+#include "NullRendererAPI.h"
+#include <deque>
+#include <string>
+
+// ---------------------------------------------------------------------
+// 类: NullVertexBuffer / NullIndexBuffer / NullIndirectBuffer / NullStorageBuffer
+// 作用: 空渲染后端的缓冲区
+// 描述: 只保存大小与布局，数据写入 NullCommandLog（按日志的设置保存内容或只记录大小）。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class NullVertexBuffer : public VertexBuffer, public NullResource {
+public:
+	// 动态顶点缓冲
+	NullVertexBuffer(uint32_t size);
+	NullVertexBuffer(float* vertices, uint32_t size);
+	virtual void Bind() const override;
+	virtual void Unbind() const override;
+	virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+	virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+	virtual void SetLayout(const BufferLayout& layout) override;
+	virtual uint32_t GetSize() const override { return m_Size; }
+private:
+	uint32_t m_Size;
+	BufferLayout m_Layout;
+};
+
+class NullIndexBuffer : public IndexBuffer, public NullResource {
+public:
+	NullIndexBuffer(uint32_t* indices, uint32_t count);
+	virtual void Bind() const override;
+	virtual void Unbind() const override;
+	virtual uint32_t GetCount() const override { return m_Count; }
+	virtual void SetData(const uint32_t* indices, uint32_t count, uint32_t offset = 0) override;
+private:
+	uint32_t m_Count;
+};
+
+class NullIndirectBuffer : public IndirectBuffer, public NullResource {
+public:
+	NullIndirectBuffer(uint32_t capacity);
+	virtual void Bind() const override;
+	virtual void Unbind() const override;
+	virtual void SetCommands(const DrawElementsIndirectCommand* commands, uint32_t count, uint32_t offset = 0) override;
+	virtual uint32_t GetCapacity() const override { return m_Capacity; }
+private:
+	uint32_t m_Capacity;
+};
+
+class NullStorageBuffer : public StorageBuffer, public NullResource {
+public:
+	NullStorageBuffer(uint32_t size);
+	virtual void Bind(uint32_t binding) const override;
+	virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+	virtual uint32_t GetSize() const override { return m_Size; }
+private:
+	uint32_t m_Size;
+};
+
+/**
+ * @brief BufferLayout 的序列化格式
+ *
+ * 头部为元素个数与步幅，之后每个元素依次为类型、是否归一化、名称长度、偏移与名称。
+ * 空后端录制 SetBufferLayout 时写入，回放时读出。
+ */
+void SerializeBufferLayout(const BufferLayout& layout, std::vector<uint8_t>& data);
+// names 保存读出的名称，须比 layout 及使用它的缓冲存活更久
+BufferLayout DeserializeBufferLayout(const uint8_t* data, uint32_t size, std::deque<std::string>& names);
+}
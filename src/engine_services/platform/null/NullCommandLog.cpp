@@ -0,0 +1,217 @@
+#include "NullCommandLog.h"
+#include "core/FileSystem.h"
+#include "core/Log.h"
+#include <cstring>
+
+namespace GE {
+
+// 文件格式：文件头，之后依次是命令、payload 与每帧结尾的下标
+struct NullCommandLogFileHeader {
+	uint32_t Magic = 0;
+	uint32_t Version = 0;
+	uint32_t CommandCount = 0;
+	uint32_t FrameCount = 0;
+	uint64_t PayloadSize = 0;
+};
+static constexpr uint32_t LogFileMagic = 0x4C4E4547; // "GENL"
+static constexpr uint32_t LogFileVersion = 1;
+
+const char* NullCommandTypeToString(NullCommandType type) {
+	switch (type) {
+		case NullCommandType::CreateBuffer:          return "CreateBuffer";
+		case NullCommandType::CreateVertexArray:     return "CreateVertexArray";
+		case NullCommandType::CreateShader:          return "CreateShader";
+		case NullCommandType::CreateTexture:         return "CreateTexture";
+		case NullCommandType::CreateFramebuffer:     return "CreateFramebuffer";
+		case NullCommandType::Destroy:               return "Destroy";
+		case NullCommandType::SetBufferLayout:       return "SetBufferLayout";
+		case NullCommandType::SetBufferData:         return "SetBufferData";
+		case NullCommandType::AddVertexBuffer:       return "AddVertexBuffer";
+		case NullCommandType::SetIndexBuffer:        return "SetIndexBuffer";
+		case NullCommandType::SetTextureData:        return "SetTextureData";
+		case NullCommandType::SetTextureSubData:     return "SetTextureSubData";
+		case NullCommandType::ResizeFramebuffer:     return "ResizeFramebuffer";
+		case NullCommandType::BindBuffer:            return "BindBuffer";
+		case NullCommandType::BindVertexArray:       return "BindVertexArray";
+		case NullCommandType::BindShader:            return "BindShader";
+		case NullCommandType::SetUniform:            return "SetUniform";
+		case NullCommandType::BindTexture:           return "BindTexture";
+		case NullCommandType::BindFramebuffer:       return "BindFramebuffer";
+		case NullCommandType::ResolveFramebuffer:    return "ResolveFramebuffer";
+		case NullCommandType::ClearAttachment:       return "ClearAttachment";
+		case NullCommandType::BindColorAttachment:   return "BindColorAttachment";
+		case NullCommandType::SetViewport:           return "SetViewport";
+		case NullCommandType::SetClearColor:         return "SetClearColor";
+		case NullCommandType::Clear:                 return "Clear";
+		case NullCommandType::DrawIndexed:           return "DrawIndexed";
+		case NullCommandType::DrawArrays:            return "DrawArrays";
+		case NullCommandType::DrawIndexedBaseVertex: return "DrawIndexedBaseVertex";
+		case NullCommandType::DrawIndexedIndirect:   return "DrawIndexedIndirect";
+		case NullCommandType::PushDebugGroup:        return "PushDebugGroup";
+		case NullCommandType::PopDebugGroup:         return "PopDebugGroup";
+		case NullCommandType::EndFrame:              return "EndFrame";
+		case NullCommandType::Count:                 break;
+	}
+	return "Unknown";
+}
+
+void NullCommandLog::Record(const NullCommand& command, const void* data, uint32_t size, bool optional) {
+	NullCommand& recorded = m_Commands.emplace_back(command);
+	recorded.PayloadSize = size;
+	recorded.PayloadOffset = NullCommand::NoPayload;
+	if (data && size && (m_CapturePayloads || !optional)) {
+		ASSERT_ENGINE(m_Payload.size() + size < NullCommand::NoPayload, "NullCommandLog payload exceeds 4 GB!");
+		recorded.PayloadOffset = static_cast<uint32_t>(m_Payload.size());
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		m_Payload.insert(m_Payload.end(), bytes, bytes + size);
+	}
+	const uint32_t type = static_cast<uint32_t>(command.Type);
+	m_Counts[type]++;
+	m_Bytes[type] += size;
+	if (command.Type == NullCommandType::EndFrame) {
+		m_FrameEnds.push_back(static_cast<uint32_t>(m_Commands.size() - 1));
+	}
+}
+
+void NullCommandLog::Record(const NullCommand& command, std::initializer_list<std::pair<const void*, uint32_t>> parts) {
+	uint32_t size = 0;
+	for (const auto& part : parts) {
+		size += part.second;
+	}
+	ASSERT_ENGINE(m_Payload.size() + size < NullCommand::NoPayload, "NullCommandLog payload exceeds 4 GB!");
+	const uint32_t offset = static_cast<uint32_t>(m_Payload.size());
+	for (const auto& part : parts) {
+		const uint8_t* bytes = static_cast<const uint8_t*>(part.first);
+		m_Payload.insert(m_Payload.end(), bytes, bytes + part.second);
+	}
+	NullCommand& recorded = m_Commands.emplace_back(command);
+	recorded.PayloadOffset = offset;
+	recorded.PayloadSize = size;
+	const uint32_t type = static_cast<uint32_t>(command.Type);
+	m_Counts[type]++;
+	m_Bytes[type] += size;
+}
+
+void NullCommandLog::Clear() {
+	m_Commands.clear();
+	m_Payload.clear();
+	m_FrameEnds.clear();
+	m_Counts.fill(0);
+	m_Bytes.fill(0);
+}
+
+const uint8_t* NullCommandLog::GetPayload(const NullCommand& command) const {
+	return command.HasPayload() ? m_Payload.data() + command.PayloadOffset : nullptr;
+}
+
+std::string_view NullCommandLog::GetString(const NullCommand& command, uint32_t offset, uint32_t length) const {
+	if (!command.HasPayload() || offset + length > command.PayloadSize) {
+		return {};
+	}
+	return std::string_view(reinterpret_cast<const char*>(m_Payload.data() + command.PayloadOffset + offset), length);
+}
+
+uint64_t NullCommandLog::GetTotalBytes() const {
+	uint64_t total = 0;
+	for (uint64_t bytes : m_Bytes) {
+		total += bytes;
+	}
+	return total;
+}
+
+void NullCommandLog::GetFrameRange(uint32_t frame, uint32_t& begin, uint32_t& end) const {
+	ASSERT_ENGINE(frame < m_FrameEnds.size(), "NullCommandLog frame index out of range!");
+	begin = frame == 0 ? 0 : m_FrameEnds[frame - 1] + 1;
+	end = m_FrameEnds[frame];
+}
+
+void NullCommandLog::LogSummary() const {
+	LOG_INFO_ENGINE("Null renderer log: {0} commands, {1} frames, {2:.2f} MB of call data, {3:.2f} MB stored",
+		m_Commands.size(), m_FrameEnds.size(), static_cast<double>(GetTotalBytes()) / (1024.0 * 1024.0),
+		static_cast<double>(GetStoredBytes()) / (1024.0 * 1024.0));
+	for (uint32_t type = 0; type < TypeCount; ++type) {
+		if (m_Counts[type]) {
+			LOG_INFO_ENGINE("  {0:<22} {1:>8} calls {2:>12} bytes",
+				NullCommandTypeToString(static_cast<NullCommandType>(type)), m_Counts[type], m_Bytes[type]);
+		}
+	}
+}
+
+bool NullCommandLog::Save(const std::filesystem::path& path) const {
+	NullCommandLogFileHeader header;
+	header.Magic = LogFileMagic;
+	header.Version = LogFileVersion;
+	header.CommandCount = static_cast<uint32_t>(m_Commands.size());
+	header.FrameCount = static_cast<uint32_t>(m_FrameEnds.size());
+	header.PayloadSize = m_Payload.size();
+
+	const uint64_t commandBytes = m_Commands.size() * sizeof(NullCommand);
+	const uint64_t frameBytes = m_FrameEnds.size() * sizeof(uint32_t);
+	Buffer file(sizeof(header) + commandBytes + m_Payload.size() + frameBytes);
+	uint8_t* cursor = file.Data;
+	std::memcpy(cursor, &header, sizeof(header));
+	cursor += sizeof(header);
+	if (commandBytes) {
+		std::memcpy(cursor, m_Commands.data(), commandBytes);
+		cursor += commandBytes;
+	}
+	if (!m_Payload.empty()) {
+		std::memcpy(cursor, m_Payload.data(), m_Payload.size());
+		cursor += m_Payload.size();
+	}
+	if (frameBytes) {
+		std::memcpy(cursor, m_FrameEnds.data(), frameBytes);
+	}
+	return FileSystem::WriteFileBinary(path, BufferView(file.Data, file.Size));
+}
+
+bool NullCommandLog::Load(const std::filesystem::path& path) {
+	Buffer file = FileSystem::ReadFileBinary(path);
+	NullCommandLogFileHeader header;
+	if (file.Size < sizeof(header)) {
+		LOG_ERROR_ENGINE("Could not read null renderer log '{0}'", path.string());
+		return false;
+	}
+	std::memcpy(&header, file.Data, sizeof(header));
+	const uint64_t commandBytes = static_cast<uint64_t>(header.CommandCount) * sizeof(NullCommand);
+	const uint64_t frameBytes = static_cast<uint64_t>(header.FrameCount) * sizeof(uint32_t);
+	if (header.Magic != LogFileMagic || header.Version != LogFileVersion
+		|| file.Size != sizeof(header) + commandBytes + header.PayloadSize + frameBytes) {
+		LOG_ERROR_ENGINE("'{0}' is not a valid null renderer log", path.string());
+		return false;
+	}
+
+	Clear();
+	const uint8_t* cursor = file.Data + sizeof(header);
+	m_Commands.resize(header.CommandCount);
+	if (commandBytes) {
+		std::memcpy(m_Commands.data(), cursor, commandBytes);
+	}
+	cursor += commandBytes;
+	m_Payload.assign(cursor, cursor + header.PayloadSize);
+	cursor += header.PayloadSize;
+	m_FrameEnds.resize(header.FrameCount);
+	if (frameBytes) {
+		std::memcpy(m_FrameEnds.data(), cursor, frameBytes);
+	}
+
+	for (const NullCommand& command : m_Commands) {
+		const uint32_t type = static_cast<uint32_t>(command.Type);
+		if (type >= TypeCount || (command.HasPayload() && static_cast<uint64_t>(command.PayloadOffset) + command.PayloadSize > m_Payload.size())) {
+			LOG_ERROR_ENGINE("'{0}' contains an invalid command", path.string());
+			Clear();
+			return false;
+		}
+		m_Counts[type]++;
+		m_Bytes[type] += command.PayloadSize;
+	}
+	for (uint32_t end : m_FrameEnds) {
+		if (end >= m_Commands.size() || m_Commands[end].Type != NullCommandType::EndFrame) {
+			LOG_ERROR_ENGINE("'{0}' contains an invalid frame boundary", path.string());
+			Clear();
+			return false;
+		}
+	}
+	return true;
+}
+}
@@ -0,0 +1,151 @@
+#pragma once
+#include "core/Core.h"
+#include <array>
+#include <filesystem>
+#include <initializer_list>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// ---------------------------------------------------------------------
+// 类: NullCommandLog
+// 作用: 空渲染后端录制的命令日志
+// 描述: NullRendererAPI 及其资源不调用任何图形 API，而是把每个调用记为一条定长的 NullCommand，
+//       变长的数据（缓冲与纹理内容、着色器源码、uniform 名称与值、调试分组名称）依次追加到 payload 中。
+//       资源以 ID 引用，ID 在进程内唯一且不复用，资源析构时记录 Destroy。
+//       同时按命令类型累计次数与数据字节数，基准测试据此比较引擎侧提交、排序与合批的开销；
+//       日志可以保存到文件，由 NullCommandReplayer 回放到真实后端，单独测量驱动开销。
+//
+//       缓冲与纹理的内容可以不保存（SetCapturePayloads(false)），此时只记录大小，
+//       回放时上传同样大小的零数据；着色器、uniform 等回放必需的数据总是保存。
+//       本身不加锁：由渲染线程录制，读取前需保证没有正在执行的渲染命令。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+enum class NullCommandType : uint8_t {
+	// 资源
+	CreateBuffer = 0,     // Small: NullBufferKind；Args[0]: 字节数（索引/间接缓冲为条数）；payload: 初始数据
+	CreateVertexArray,
+	CreateShader,         // Small: 0 文件路径 / 1 源码；Args: 名称、顶点、片元源码的长度
+	CreateTexture,        // Small: 0 Texture2D / 1 Texture2DArray；Args[0]: 层数；payload: TextureSpecification
+	CreateFramebuffer,    // payload: FramebufferSpecification
+	Destroy,
+	SetBufferLayout,      // payload: 序列化的 BufferLayout
+	SetBufferData,        // Args[0]: 偏移（字节，索引/间接缓冲为条数）
+	AddVertexBuffer,      // Args[0]: 顶点缓冲
+	SetIndexBuffer,       // Args[0]: 索引缓冲
+	SetTextureData,       // Small: mip 层；Args[0]: 层号，NullAllLayers 表示全部层
+	SetTextureSubData,    // Small: mip 层；Args: x, y, width, height
+	ResizeFramebuffer,    // Args: width, height
+	// 状态
+	BindBuffer,           // Small: 0 Bind / 1 Unbind；Args[0]: 存储缓冲的绑定点
+	BindVertexArray,      // Small: 0 Bind / 1 Unbind
+	BindShader,           // Small: 0 Bind / 1 Unbind
+	SetUniform,           // Small: NullUniformType；Args[0]: 名称长度，Args[1]: 元素个数；payload: 名称 + 值
+	BindTexture,          // Args[0]: 纹理单元
+	BindFramebuffer,      // Small: 0 Bind / 1 Unbind
+	ResolveFramebuffer,
+	ClearAttachment,      // Small: 0 Vec4 / 1 int；Args[0]: 附件，Args[1]: int 值；payload: Vec4 值
+	BindColorAttachment,  // Args: 附件, 纹理单元
+	SetViewport,          // Args: x, y, width, height
+	SetClearColor,        // Args: RGBA 的位模式
+	Clear,
+	// 绘制，Resource 为顶点数组
+	DrawIndexed,          // Args[0]: indexCount
+	DrawArrays,           // Args: vertexCount, firstVertex
+	DrawIndexedBaseVertex,// Args: indexCount, firstIndex, baseVertex
+	DrawIndexedIndirect,  // Args: 间接缓冲, drawCount, firstCommand
+	PushDebugGroup,       // payload: 名称
+	PopDebugGroup,
+	EndFrame,
+
+	Count
+};
+
+enum class NullBufferKind : uint8_t {
+	Vertex = 0, DynamicVertex, Index, Indirect, Storage
+};
+
+enum class NullUniformType : uint8_t {
+	Int = 0, IntArray, Float, Float2, Float4, Mat4
+};
+
+// SetTextureData 作用于纹理数组的全部层
+static constexpr uint32_t NullAllLayers = 0xFFFFFFFF;
+
+struct NullCommand {
+	NullCommandType Type = NullCommandType::Count;
+	uint8_t Small = 0;              // 含义见 NullCommandType
+	uint16_t Reserved = 0;
+	uint32_t Resource = 0;          // 命令作用的资源 ID，0 表示无
+	uint32_t Args[4]{};
+	uint32_t PayloadOffset = 0;     // NoPayload 表示数据未保存
+	uint32_t PayloadSize = 0;       // 调用携带的数据字节数（即使未保存）
+
+	static constexpr uint32_t NoPayload = 0xFFFFFFFF;
+
+	NullCommand() = default;
+	NullCommand(NullCommandType type, uint32_t resource = 0, std::initializer_list<uint32_t> args = {}, uint8_t small = 0)
+		: Type(type), Small(small), Resource(resource) {
+		uint32_t i = 0;
+		for (uint32_t arg : args) {
+			Args[i++] = arg;
+		}
+	}
+	inline bool HasPayload() const { return PayloadOffset != NoPayload; }
+};
+static_assert(sizeof(NullCommand) == 32, "NullCommand should stay compact");
+
+const char* NullCommandTypeToString(NullCommandType type);
+
+class NullCommandLog {
+public:
+	static constexpr uint32_t TypeCount = static_cast<uint32_t>(NullCommandType::Count);
+
+	/**
+	 * @brief 追加一条命令
+	 *
+	 * data 为命令携带的数据；optional 为 true 的数据（缓冲与纹理内容）在不保存内容时只记录大小。
+	 */
+	void Record(const NullCommand& command, const void* data = nullptr, uint32_t size = 0, bool optional = false);
+	// 数据由几段依次拼接而成（例如 uniform 的名称与值），总是保存
+	void Record(const NullCommand& command, std::initializer_list<std::pair<const void*, uint32_t>> parts);
+	// 清空命令与统计，保留内存
+	void Clear();
+
+	void SetCapturePayloads(bool capture) { m_CapturePayloads = capture; }
+	bool IsCapturingPayloads() const { return m_CapturePayloads; }
+
+	inline const std::vector<NullCommand>& GetCommands() const { return m_Commands; }
+	// 命令的数据，未保存时为 nullptr
+	const uint8_t* GetPayload(const NullCommand& command) const;
+	std::string_view GetString(const NullCommand& command, uint32_t offset, uint32_t length) const;
+
+	inline uint32_t GetCommandCount() const { return static_cast<uint32_t>(m_Commands.size()); }
+	inline uint32_t GetCount(NullCommandType type) const { return m_Counts[static_cast<uint32_t>(type)]; }
+	// 该类型命令携带的数据字节数（无论是否保存）
+	inline uint64_t GetBytes(NullCommandType type) const { return m_Bytes[static_cast<uint32_t>(type)]; }
+	uint64_t GetTotalBytes() const;
+	// 日志本身占用的字节数（命令 + 已保存的数据）
+	inline uint64_t GetStoredBytes() const { return m_Commands.size() * sizeof(NullCommand) + m_Payload.size(); }
+
+	// 已录制的完整帧数（EndFrame 的个数）
+	inline uint32_t GetFrameCount() const { return static_cast<uint32_t>(m_FrameEnds.size()); }
+	// 第 frame 帧的命令范围 [begin, end)，不含结尾的 EndFrame；第 0 帧包含之前创建资源的命令
+	void GetFrameRange(uint32_t frame, uint32_t& begin, uint32_t& end) const;
+
+	// 按类型输出次数与字节数
+	void LogSummary() const;
+
+	bool Save(const std::filesystem::path& path) const;
+	bool Load(const std::filesystem::path& path);
+private:
+	std::vector<NullCommand> m_Commands;
+	std::vector<uint8_t> m_Payload;
+	std::vector<uint32_t> m_FrameEnds;  // 每个 EndFrame 命令的下标
+	std::array<uint32_t, TypeCount> m_Counts{};
+	std::array<uint64_t, TypeCount> m_Bytes{};
+	bool m_CapturePayloads = true;
+};
+}
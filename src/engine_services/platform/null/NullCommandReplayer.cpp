@@ -0,0 +1,336 @@
+#include "NullCommandReplayer.h"
+#include "NullBuffer.h"
+#include "NullFramebuffer.h"
+#include "engine_services/renderer/RenderCommand.h"
+#include "core/Log.h"
+#include <algorithm>
+#include <cstring>
+
+namespace GE {
+
+template<typename T>
+static inline T ReadValue(const uint8_t* data) {
+	T value;
+	std::memcpy(&value, data, sizeof(T));
+	return value;
+}
+
+void NullCommandReplayer::Replay(const NullCommandLog& log) {
+	Replay(log, 0, log.GetCommandCount());
+}
+
+void NullCommandReplayer::ReplayFrame(const NullCommandLog& log, uint32_t frame) {
+	uint32_t begin = 0;
+	uint32_t end = 0;
+	log.GetFrameRange(frame, begin, end);
+	Replay(log, begin, end);
+}
+
+void NullCommandReplayer::Replay(const NullCommandLog& log, uint32_t begin, uint32_t end) {
+	ASSERT_ENGINE(RendererAPI::GetAPI() != RendererAPI::API::Null, "Null renderer logs must be replayed on a real backend!");
+	ASSERT_ENGINE(RenderThread::IsRenderThread(), "NullCommandReplayer must run on the render thread!");
+	const std::vector<NullCommand>& commands = log.GetCommands();
+	end = std::min<uint32_t>(end, static_cast<uint32_t>(commands.size()));
+	for (uint32_t i = begin; i < end; ++i) {
+		Execute(log, commands[i]);
+	}
+}
+
+void NullCommandReplayer::Reset() {
+	m_Resources.clear();
+	m_SkippedCommands = 0;
+}
+
+NullCommandReplayer::ReplayResource* NullCommandReplayer::Find(uint32_t id) {
+	auto it = m_Resources.find(id);
+	if (it == m_Resources.end()) {
+		m_SkippedCommands++;
+		return nullptr;
+	}
+	return &it->second;
+}
+
+const uint8_t* NullCommandReplayer::GetData(const NullCommandLog& log, const NullCommand& command) {
+	if (const uint8_t* payload = log.GetPayload(command)) {
+		return payload;
+	}
+	if (m_Zeros.size() < command.PayloadSize) {
+		m_Zeros.resize(command.PayloadSize);
+	}
+	return m_Zeros.data();
+}
+
+void NullCommandReplayer::Execute(const NullCommandLog& log, const NullCommand& command) {
+	RendererAPI& api = *RenderCommand::s_RendererAPI;
+	const uint32_t* args = command.Args;
+	const bool unbind = command.Small != 0;
+
+	switch (command.Type) {
+		case NullCommandType::CreateBuffer: {
+			ReplayResource& resource = m_Resources[command.Resource];
+			// 录制时有初始数据但未保存内容的，以零数据创建，上传量与录制时相同
+			const uint8_t* data = command.PayloadSize ? GetData(log, command) : nullptr;
+			switch (static_cast<NullBufferKind>(command.Small)) {
+				case NullBufferKind::Vertex:
+					resource.Vertices = VertexBuffer::Create(reinterpret_cast<float*>(const_cast<uint8_t*>(data)), args[0]);
+					break;
+				case NullBufferKind::DynamicVertex:
+					resource.Vertices = VertexBuffer::Create(args[0]);
+					break;
+				case NullBufferKind::Index:
+					resource.Indices = IndexBuffer::Create(reinterpret_cast<uint32_t*>(const_cast<uint8_t*>(data)), args[0]);
+					break;
+				case NullBufferKind::Indirect:
+					resource.Indirect = IndirectBuffer::Create(args[0]);
+					break;
+				case NullBufferKind::Storage:
+					resource.Storage = StorageBuffer::Create(args[0]);
+					break;
+			}
+			return;
+		}
+		case NullCommandType::CreateVertexArray:
+			m_Resources[command.Resource].Array = VertexArray::Create();
+			return;
+		case NullCommandType::CreateShader: {
+			ReplayResource& resource = m_Resources[command.Resource];
+			if (command.Small == 0) {
+				resource.Program = Shader::Create(std::string(log.GetString(command, 0, args[0])));
+			} else {
+				resource.Program = Shader::Create(std::string(log.GetString(command, 0, args[0])),
+					std::string(log.GetString(command, args[0], args[1])),
+					std::string(log.GetString(command, args[0] + args[1], args[2])));
+			}
+			return;
+		}
+		case NullCommandType::CreateTexture: {
+			const uint8_t* payload = log.GetPayload(command);
+			if (!payload || command.PayloadSize != sizeof(TextureSpecification)) {
+				m_SkippedCommands++;
+				return;
+			}
+			const TextureSpecification specification = ReadValue<TextureSpecification>(payload);
+			ReplayResource& resource = m_Resources[command.Resource];
+			if (command.Small == 0) {
+				resource.Texture = Texture2D::Create(specification);
+			} else {
+				resource.TextureArray = Texture2DArray::Create(specification, args[0]);
+			}
+			return;
+		}
+		case NullCommandType::CreateFramebuffer: {
+			const uint8_t* payload = log.GetPayload(command);
+			if (!payload) {
+				m_SkippedCommands++;
+				return;
+			}
+			m_Resources[command.Resource].Target = Framebuffer::Create(DeserializeFramebufferSpecification(payload, command.PayloadSize));
+			return;
+		}
+		case NullCommandType::Destroy:
+			m_Resources.erase(command.Resource);
+			return;
+		case NullCommandType::SetViewport:
+			api.SetViewport(args[0], args[1], args[2], args[3]);
+			return;
+		case NullCommandType::SetClearColor: {
+			Vec4 color;
+			std::memcpy(&color.r, &args[0], sizeof(float));
+			std::memcpy(&color.g, &args[1], sizeof(float));
+			std::memcpy(&color.b, &args[2], sizeof(float));
+			std::memcpy(&color.a, &args[3], sizeof(float));
+			api.SetClearColor(color);
+			return;
+		}
+		case NullCommandType::Clear:
+			api.Clear();
+			return;
+		case NullCommandType::PushDebugGroup:
+			m_Name.assign(log.GetString(command, 0, command.PayloadSize));
+			api.PushDebugGroup(m_Name.c_str());
+			return;
+		case NullCommandType::PopDebugGroup:
+			api.PopDebugGroup();
+			return;
+		case NullCommandType::EndFrame:
+		case NullCommandType::Count:
+			return;
+		default:
+			break;
+	}
+
+	// 以下命令都作用于一个已有的资源
+	ReplayResource* resource = Find(command.Resource);
+	if (!resource) {
+		return;
+	}
+	switch (command.Type) {
+		case NullCommandType::SetBufferLayout: {
+			const uint8_t* payload = log.GetPayload(command);
+			if (resource->Vertices && payload) {
+				resource->Vertices->SetLayout(DeserializeBufferLayout(payload, command.PayloadSize, m_LayoutNames));
+			}
+			break;
+		}
+		case NullCommandType::SetBufferData: {
+			const uint8_t* data = GetData(log, command);
+			const uint32_t size = command.PayloadSize;
+			if (resource->Vertices) {
+				resource->Vertices->SetData(data, size, args[0]);
+			} else if (resource->Indices) {
+				resource->Indices->SetData(reinterpret_cast<const uint32_t*>(data), size / sizeof(uint32_t), args[0]);
+			} else if (resource->Indirect) {
+				resource->Indirect->SetCommands(reinterpret_cast<const DrawElementsIndirectCommand*>(data),
+					size / sizeof(DrawElementsIndirectCommand), args[0]);
+			} else if (resource->Storage) {
+				resource->Storage->SetData(data, size, args[0]);
+			}
+			break;
+		}
+		case NullCommandType::AddVertexBuffer: {
+			ReplayResource* buffer = Find(args[0]);
+			if (resource->Array && buffer && buffer->Vertices) {
+				resource->Array->AddVertexBuffer(buffer->Vertices);
+			}
+			break;
+		}
+		case NullCommandType::SetIndexBuffer: {
+			ReplayResource* buffer = args[0] ? Find(args[0]) : nullptr;
+			if (resource->Array && buffer && buffer->Indices) {
+				resource->Array->SetIndexBuffer(buffer->Indices);
+			}
+			break;
+		}
+		case NullCommandType::SetTextureData: {
+			const uint8_t* data = GetData(log, command);
+			if (resource->Texture) {
+				resource->Texture->SetData(data, command.PayloadSize, command.Small);
+			} else if (resource->TextureArray) {
+				if (args[0] == NullAllLayers) {
+					resource->TextureArray->SetData(data, command.PayloadSize, command.Small);
+				} else {
+					resource->TextureArray->SetLayerData(data, command.PayloadSize, args[0], command.Small);
+				}
+			}
+			break;
+		}
+		case NullCommandType::SetTextureSubData: {
+			Buffer pixels = Buffer::Copy(GetData(log, command), command.PayloadSize);
+			if (resource->Texture) {
+				resource->Texture->SetSubData(std::move(pixels), args[0], args[1], args[2], args[3], command.Small);
+			} else if (resource->TextureArray) {
+				resource->TextureArray->SetSubData(std::move(pixels), args[0], args[1], args[2], args[3], command.Small);
+			}
+			break;
+		}
+		case NullCommandType::ResizeFramebuffer:
+			if (resource->Target) {
+				resource->Target->Resize(args[0], args[1]);
+			}
+			break;
+		case NullCommandType::BindBuffer:
+			if (resource->Vertices) {
+				unbind ? resource->Vertices->Unbind() : resource->Vertices->Bind();
+			} else if (resource->Indices) {
+				unbind ? resource->Indices->Unbind() : resource->Indices->Bind();
+			} else if (resource->Indirect) {
+				unbind ? resource->Indirect->Unbind() : resource->Indirect->Bind();
+			} else if (resource->Storage) {
+				resource->Storage->Bind(args[0]);
+			}
+			break;
+		case NullCommandType::BindVertexArray:
+			if (resource->Array) {
+				unbind ? resource->Array->Unbind() : resource->Array->Bind();
+			}
+			break;
+		case NullCommandType::BindShader:
+			if (resource->Program) {
+				unbind ? resource->Program->Unbind() : resource->Program->Bind();
+			}
+			break;
+		case NullCommandType::SetUniform: {
+			const uint8_t* payload = log.GetPayload(command);
+			if (!resource->Program || !payload) {
+				break;
+			}
+			const std::string name(log.GetString(command, 0, args[0]));
+			const uint8_t* value = payload + args[0];
+			switch (static_cast<NullUniformType>(command.Small)) {
+				case NullUniformType::Int:    resource->Program->SetInt(name, ReadValue<int>(value)); break;
+				case NullUniformType::Float:  resource->Program->SetFloat(name, ReadValue<float>(value)); break;
+				case NullUniformType::Float2: resource->Program->SetFloat2(name, ReadValue<Vec2>(value)); break;
+				case NullUniformType::Float4: resource->Program->SetFloat4(name, ReadValue<Vec4>(value)); break;
+				case NullUniformType::Mat4:   resource->Program->SetMat4(name, ReadValue<Mat4>(value)); break;
+				case NullUniformType::IntArray: {
+					std::vector<int> values(args[1]);
+					std::memcpy(values.data(), value, values.size() * sizeof(int));
+					resource->Program->SetIntArray(name, values.data(), args[1]);
+					break;
+				}
+			}
+			break;
+		}
+		case NullCommandType::BindTexture:
+			if (resource->Texture) {
+				resource->Texture->Bind(args[0]);
+			} else if (resource->TextureArray) {
+				resource->TextureArray->Bind(args[0]);
+			}
+			break;
+		case NullCommandType::BindFramebuffer:
+			if (resource->Target) {
+				unbind ? resource->Target->Unbind() : resource->Target->Bind();
+			}
+			break;
+		case NullCommandType::ResolveFramebuffer:
+			if (resource->Target) {
+				resource->Target->Resolve();
+			}
+			break;
+		case NullCommandType::ClearAttachment: {
+			if (!resource->Target) {
+				break;
+			}
+			if (command.Small == 0) {
+				const uint8_t* payload = log.GetPayload(command);
+				if (payload) {
+					resource->Target->ClearAttachment(args[0], ReadValue<Vec4>(payload));
+				}
+			} else {
+				resource->Target->ClearAttachment(args[0], static_cast<int>(args[1]));
+			}
+			break;
+		}
+		case NullCommandType::BindColorAttachment:
+			if (resource->Target) {
+				resource->Target->BindColorAttachment(args[0], args[1]);
+			}
+			break;
+		case NullCommandType::DrawIndexed:
+			if (resource->Array) {
+				api.DrawIndexed(resource->Array, args[0]);
+			}
+			break;
+		case NullCommandType::DrawArrays:
+			if (resource->Array) {
+				api.DrawArrays(resource->Array, args[0], args[1]);
+			}
+			break;
+		case NullCommandType::DrawIndexedBaseVertex:
+			if (resource->Array) {
+				api.DrawIndexedBaseVertex(resource->Array, args[0], args[1], static_cast<int32_t>(args[2]));
+			}
+			break;
+		case NullCommandType::DrawIndexedIndirect: {
+			ReplayResource* indirect = Find(args[0]);
+			if (resource->Array && indirect && indirect->Indirect) {
+				api.DrawIndexedIndirect(resource->Array, indirect->Indirect, args[1], args[2]);
+			}
+			break;
+		}
+		default:
+			break;
+	}
+}
+}
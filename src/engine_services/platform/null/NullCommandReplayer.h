@@ -0,0 +1,71 @@
+#pragma once
+#include "NullCommandLog.h"
+#include "engine_services/renderer/Buffer.h"
+#include "engine_services/renderer/Framebuffer.h"
+#include "engine_services/renderer/Shader.h"
+#include "engine_services/renderer/Texture.h"
+#include "engine_services/renderer/VertexArray.h"
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+// ---------------------------------------------------------------------
+// 类: NullCommandReplayer
+// 作用: 把 NullCommandLog 回放到当前的渲染后端
+// 描述: 按日志中的 ID 通过各资源的 Create 工厂创建真实资源，依次重放数据上传、绑定、uniform 与绘制，
+//       绘制直接调用 RenderCommand 持有的后端，与 Renderer 的回放路径一致。
+//       引擎侧的场景遍历、排序与合批都已在录制时完成，回放测得的只是驱动与 GPU 的开销。
+//
+//       资源在多次 Replay 之间保留，分帧取出的日志按顺序回放即可；引用了未知资源的命令被跳过并计数。
+//       日志中的 EndFrame 不回放，帧边界（RenderCommand::EndFrame、交换缓冲区）由调用者负责。
+//       必须在渲染线程上调用：单线程模式下即主线程，多线程模式下放在 RenderThread::Submit 的命令中。
+//       当前后端不能是 RendererAPI::API::Null。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class NullCommandReplayer {
+public:
+	NullCommandReplayer() = default;
+	~NullCommandReplayer() = default;
+	NullCommandReplayer(const NullCommandReplayer&) = delete;
+	NullCommandReplayer& operator=(const NullCommandReplayer&) = delete;
+
+	// 回放日志中的全部命令
+	void Replay(const NullCommandLog& log);
+	// 回放第 frame 帧（见 NullCommandLog::GetFrameRange）
+	void ReplayFrame(const NullCommandLog& log, uint32_t frame);
+	// 回放下标在 [begin, end) 中的命令
+	void Replay(const NullCommandLog& log, uint32_t begin, uint32_t end);
+	// 释放所有回放创建的资源
+	void Reset();
+
+	inline uint32_t GetResourceCount() const { return static_cast<uint32_t>(m_Resources.size()); }
+	// 因引用未知资源而跳过的命令数
+	inline uint32_t GetSkippedCommandCount() const { return m_SkippedCommands; }
+private:
+	struct ReplayResource {
+		Ref<VertexBuffer> Vertices;
+		Ref<IndexBuffer> Indices;
+		Ref<IndirectBuffer> Indirect;
+		Ref<StorageBuffer> Storage;
+		Ref<VertexArray> Array;
+		Ref<Shader> Program;
+		Ref<Texture2D> Texture;
+		Ref<Texture2DArray> TextureArray;
+		Ref<Framebuffer> Target;
+	};
+
+	// 命令引用的资源，不存在时计入跳过的命令并返回 nullptr
+	ReplayResource* Find(uint32_t id);
+	// 命令携带的数据；未保存内容时返回同样大小的零数据
+	const uint8_t* GetData(const NullCommandLog& log, const NullCommand& command);
+	void Execute(const NullCommandLog& log, const NullCommand& command);
+private:
+	std::unordered_map<uint32_t, ReplayResource> m_Resources;
+	std::deque<std::string> m_LayoutNames;  // 回放的 BufferLayout 引用的属性名称
+	std::vector<uint8_t> m_Zeros;
+	std::string m_Name;                     // uniform 与调试分组的名称
+	uint32_t m_SkippedCommands = 0;
+};
+}
@@ -0,0 +1,100 @@
+#include "NullFramebuffer.h"
+#include "engine_services/renderer/RendererStatistics.h"
+#include "core/Log.h"
+#include <cstring>
+
+namespace GE {
+
+NullFramebuffer::NullFramebuffer(const FramebufferSpecification& specification)
+	: m_Specification(specification) {
+	for (const FramebufferAttachmentSpecification& attachment : specification.Attachments) {
+		if (IsDepthFormat(attachment.Format)) {
+			m_HasDepth = true;
+		} else if (attachment.Format != FramebufferTextureFormat::None) {
+			m_ColorAttachmentCount++;
+		}
+	}
+	std::vector<uint8_t> data;
+	SerializeFramebufferSpecification(specification, data);
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::CreateFramebuffer, m_ID), data.data(), static_cast<uint32_t>(data.size()));
+}
+
+void NullFramebuffer::Bind() {
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::BindFramebuffer, m_ID));
+	RendererStatistics::Current().FramebufferBinds++;
+}
+
+void NullFramebuffer::Unbind() {
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::BindFramebuffer, m_ID, {}, 1));
+	RendererStatistics::Current().FramebufferBinds++;
+}
+
+void NullFramebuffer::Resize(uint32_t width, uint32_t height) {
+	if (width == 0 || height == 0 || width > MaxSize || height > MaxSize) {
+		LOG_WARN_ENGINE("Attempted to resize framebuffer to {0}, {1}", width, height);
+		return;
+	}
+	if (width == m_Specification.Width && height == m_Specification.Height) {
+		return;
+	}
+	m_Specification.Width = width;
+	m_Specification.Height = height;
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::ResizeFramebuffer, m_ID, { width, height }));
+}
+
+void NullFramebuffer::Resolve() {
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::ResolveFramebuffer, m_ID));
+}
+
+void NullFramebuffer::ClearAttachment(uint32_t attachmentIndex, const Vec4& value) {
+	ASSERT_ENGINE(attachmentIndex < m_ColorAttachmentCount, "Framebuffer attachment index out of range!");
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::ClearAttachment, m_ID, { attachmentIndex }, 0), &value, sizeof(value));
+}
+
+void NullFramebuffer::ClearAttachment(uint32_t attachmentIndex, int value) {
+	ASSERT_ENGINE(attachmentIndex < m_ColorAttachmentCount, "Framebuffer attachment index out of range!");
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::ClearAttachment, m_ID,
+		{ attachmentIndex, static_cast<uint32_t>(value) }, 1));
+}
+
+void NullFramebuffer::BindColorAttachment(uint32_t attachmentIndex, uint32_t slot) const {
+	ASSERT_ENGINE(attachmentIndex < m_ColorAttachmentCount, "Framebuffer attachment index out of range!");
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::BindColorAttachment, m_ID, { attachmentIndex, slot }));
+	RendererStatistics::Current().TextureBinds++;
+}
+
+uint32_t NullFramebuffer::GetColorAttachmentRendererID([[maybe_unused]] uint32_t attachmentIndex) const {
+	ASSERT_ENGINE(attachmentIndex < m_ColorAttachmentCount, "Framebuffer attachment index out of range!");
+	return m_ID;
+}
+
+void SerializeFramebufferSpecification(const FramebufferSpecification& specification, std::vector<uint8_t>& data) {
+	const uint32_t header[4] = { specification.Width, specification.Height, specification.Samples,
+		static_cast<uint32_t>(specification.Attachments.size()) };
+	data.resize(sizeof(header) + specification.Attachments.size() * 2);
+	std::memcpy(data.data(), header, sizeof(header));
+	uint8_t* attachment = data.data() + sizeof(header);
+	for (const FramebufferAttachmentSpecification& spec : specification.Attachments) {
+		*attachment++ = static_cast<uint8_t>(spec.Format);
+		*attachment++ = static_cast<uint8_t>(spec.Filter);
+	}
+}
+
+FramebufferSpecification DeserializeFramebufferSpecification(const uint8_t* data, uint32_t size) {
+	FramebufferSpecification specification;
+	uint32_t header[4];
+	if (size < sizeof(header)) {
+		return specification;
+	}
+	std::memcpy(header, data, sizeof(header));
+	specification.Width = header[0];
+	specification.Height = header[1];
+	specification.Samples = header[2];
+	const uint8_t* attachment = data + sizeof(header);
+	for (uint32_t i = 0; i < header[3] && sizeof(header) + (i + 1) * 2 <= size; ++i) {
+		specification.Attachments.emplace_back(static_cast<FramebufferTextureFormat>(attachment[0]), static_cast<TextureFilter>(attachment[1]));
+		attachment += 2;
+	}
+	return specification;
+}
+}
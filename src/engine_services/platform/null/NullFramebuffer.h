@@ -0,0 +1,42 @@
+#pragma once
+#include "engine_services/renderer/Framebuffer.h"
+#include "NullRendererAPI.h"
+
+// ---------------------------------------------------------------------
+// 类: NullFramebuffer
+// 作用: 空渲染后端的帧缓冲
+// 描述: 保存规格并随 Resize 更新尺寸，绑定、清除与解析记入 NullCommandLog。
+//       附件没有单独的对象，GetColorAttachmentRendererID 等返回帧缓冲的资源 ID（没有深度附件时深度为 0）。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class NullFramebuffer : public Framebuffer, public NullResource {
+public:
+	NullFramebuffer(const FramebufferSpecification& specification);
+
+	virtual void Bind() override;
+	virtual void Unbind() override;
+	virtual void Resize(uint32_t width, uint32_t height) override;
+	virtual void Resolve() override;
+	virtual void ClearAttachment(uint32_t attachmentIndex, const Vec4& value) override;
+	virtual void ClearAttachment(uint32_t attachmentIndex, int value) override;
+	virtual void BindColorAttachment(uint32_t attachmentIndex, uint32_t slot) const override;
+	virtual uint32_t GetColorAttachmentRendererID(uint32_t attachmentIndex = 0) const override;
+	virtual uint32_t GetDepthAttachmentRendererID() const override { return m_HasDepth ? m_ID : 0; }
+	virtual uint32_t GetColorAttachmentCount() const override { return m_ColorAttachmentCount; }
+	virtual const FramebufferSpecification& GetSpecification() const override { return m_Specification; }
+private:
+	FramebufferSpecification m_Specification;
+	uint32_t m_ColorAttachmentCount = 0;
+	bool m_HasDepth = false;
+};
+
+/**
+ * @brief FramebufferSpecification 的序列化格式
+ *
+ * 宽、高、采样数与附件个数，之后每个附件为格式与过滤方式各一个字节。
+ */
+void SerializeFramebufferSpecification(const FramebufferSpecification& specification, std::vector<uint8_t>& data);
+FramebufferSpecification DeserializeFramebufferSpecification(const uint8_t* data, uint32_t size);
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "engine_services/renderer/GpuReadback.h"
+
+// ---------------------------------------------------------------------
+// 类: NullGpuReadback
+// 作用: 空渲染后端的读回
+// 描述: 没有可读取的像素，读取请求按“没有空闲槽位”处理，总是返回无效句柄 0。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class NullGpuReadback : public GpuReadback {
+public:
+	virtual ReadbackHandle ReadColorAttachment(const Ref<Framebuffer>&, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t) override { return 0; }
+	virtual ReadbackHandle ReadBackbuffer(uint32_t, uint32_t, uint32_t, uint32_t) override { return 0; }
+	virtual void Update() override {}
+	virtual ReadbackStatus GetStatus(ReadbackHandle) const override { return ReadbackStatus::Invalid; }
+	virtual BufferView GetData(ReadbackHandle) const override { return {}; }
+	virtual void GetSize(ReadbackHandle, uint32_t& width, uint32_t& height, uint32_t& pixelSize) const override {
+		width = 0;
+		height = 0;
+		pixelSize = 0;
+	}
+	virtual void Release(ReadbackHandle) override {}
+};
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include "engine_services/renderer/GpuTimer.h"
+
+// ---------------------------------------------------------------------
+// 类: NullGpuTimer
+// 作用: 空渲染后端的 GPU 计时器
+// 描述: 没有 GPU，Begin / End 什么也不做，始终没有测量结果。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class NullGpuTimer : public GpuTimer {
+public:
+	virtual void Begin() override {}
+	virtual void End() override {}
+	virtual float GetMilliseconds() const override { return 0.0f; }
+	virtual bool HasResult() const override { return false; }
+};
+}
@@ -0,0 +1,106 @@
+#include "NullRendererAPI.h"
+#include "NullBuffer.h"
+#include "NullVertexArray.h"
+#include "engine_services/renderer/RendererStatistics.h"
+#include <cstring>
+#include <utility>
+
+namespace GE {
+
+static NullCommandLog s_Log;
+static uint32_t s_NextResourceID = 1;
+
+static inline void CountDraw(uint32_t vertexCount) {
+	RendererFrameStatistics& stats = RendererStatistics::Current();
+	stats.DrawCalls++;
+	stats.Vertices += vertexCount;
+	stats.Triangles += vertexCount / 3;
+}
+
+static inline uint32_t GetID(const Ref<VertexArray>& vertexArray) {
+	return static_cast<const NullVertexArray&>(*vertexArray).GetID();
+}
+
+static inline uint32_t FloatBits(float value) {
+	uint32_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+void NullRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+	s_Log.Record(NullCommand(NullCommandType::SetViewport, 0, { x, y, width, height }));
+}
+
+void NullRendererAPI::SetClearColor(const Vec4& color) {
+	s_Log.Record(NullCommand(NullCommandType::SetClearColor, 0,
+		{ FloatBits(color.r), FloatBits(color.g), FloatBits(color.b), FloatBits(color.a) }));
+}
+
+void NullRendererAPI::Clear() {
+	s_Log.Record(NullCommand(NullCommandType::Clear));
+}
+
+void NullRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount) {
+	s_Log.Record(NullCommand(NullCommandType::DrawIndexed, GetID(vertexArray), { indexCount }));
+	// 与 OpenGLRendererAPI 相同的计数方式
+	if (const Ref<IndexBuffer>& indexBuffer = vertexArray->GetIndexBuffer()) {
+		CountDraw(indexCount ? indexCount : indexBuffer->GetCount());
+		return;
+	}
+	const auto& vertexBuffers = vertexArray->GetVertexBuffers();
+	if (!vertexBuffers.empty()) {
+		const Ref<VertexBuffer>& buffer = vertexBuffers[0];
+		CountDraw(indexCount ? indexCount : buffer->GetSize() / buffer->GetLayout().GetStride());
+	}
+}
+
+void NullRendererAPI::DrawArrays(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex) {
+	s_Log.Record(NullCommand(NullCommandType::DrawArrays, GetID(vertexArray), { vertexCount, firstVertex }));
+	CountDraw(vertexCount);
+}
+
+void NullRendererAPI::DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t firstIndex, int32_t baseVertex) {
+	ASSERT_ENGINE(vertexArray->GetIndexBuffer(), "Base vertex draw requires an index buffer!");
+	s_Log.Record(NullCommand(NullCommandType::DrawIndexedBaseVertex, GetID(vertexArray),
+		{ indexCount, firstIndex, static_cast<uint32_t>(baseVertex) }));
+	CountDraw(indexCount);
+}
+
+void NullRendererAPI::DrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<IndirectBuffer>& indirectBuffer,
+	uint32_t drawCount, uint32_t firstCommand) {
+	ASSERT_ENGINE(vertexArray->GetIndexBuffer(), "Indirect indexed draw requires an index buffer!");
+	ASSERT_ENGINE(firstCommand + drawCount <= indirectBuffer->GetCapacity(), "Indirect draw range exceeds buffer capacity!");
+	const uint32_t indirectID = static_cast<const NullIndirectBuffer&>(*indirectBuffer).GetID();
+	s_Log.Record(NullCommand(NullCommandType::DrawIndexedIndirect, GetID(vertexArray), { indirectID, drawCount, firstCommand }));
+	RendererFrameStatistics& stats = RendererStatistics::Current();
+	stats.DrawCalls++;
+	stats.IndirectCommands += drawCount;
+}
+
+void NullRendererAPI::PushDebugGroup(const char* name) {
+	s_Log.Record(NullCommand(NullCommandType::PushDebugGroup), name, static_cast<uint32_t>(std::strlen(name)));
+}
+
+void NullRendererAPI::PopDebugGroup() {
+	s_Log.Record(NullCommand(NullCommandType::PopDebugGroup));
+}
+
+void NullRendererAPI::EndFrame() {
+	s_Log.Record(NullCommand(NullCommandType::EndFrame));
+}
+
+NullCommandLog& NullRendererAPI::GetLog() {
+	return s_Log;
+}
+
+void NullRendererAPI::TakeLog(NullCommandLog& log) {
+	const bool capture = s_Log.IsCapturingPayloads();
+	std::swap(s_Log, log);
+	s_Log.Clear();
+	s_Log.SetCapturePayloads(capture);
+}
+
+uint32_t NullRendererAPI::AllocateResourceID() {
+	return s_NextResourceID++;
+}
+}
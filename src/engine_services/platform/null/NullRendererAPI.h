@@ -0,0 +1,57 @@
+#pragma once
+#include "engine_services/renderer/RendererAPI.h"
+#include "NullCommandLog.h"
+
+// ---------------------------------------------------------------------
+// 类: NullRendererAPI
+// 作用: 只录制命令、不调用任何图形 API 的渲染后端
+// 描述: 用于把引擎侧的渲染开销与驱动开销分开测量：所有调用都被接受并记入 NullCommandLog，
+//       资源对象保存尺寸、布局与规格，查询接口返回与创建时一致的值，但不保存缓冲与纹理内容，
+//       提交、排序与合批的代码路径因此可以在没有 GPU 与图形上下文的情况下单独计时。
+//       RendererStatistics 的绘制与绑定计数与 OpenGL 后端一致。
+//
+//       录制的日志由 TakeLog 取出，可以保存到文件，之后由 NullCommandReplayer 在 OpenGL 后端上回放，
+//       此时测得的就只是驱动与 GPU 的开销。日志只在渲染线程上录制，取出前需保证没有正在执行的渲染命令
+//       （单线程模式，或先调用 RenderThread::Flush）。
+//       不支持 GPU 计时与读回：计时器没有结果，读回总是返回无效句柄。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class NullRendererAPI : public RendererAPI {
+public:
+	virtual void Init() override {}
+	virtual void Shutdown() override {}
+	virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+	virtual void SetClearColor(const Vec4& color) override;
+	virtual void Clear() override;
+	virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+	virtual void DrawArrays(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0) override;
+	virtual void DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t firstIndex, int32_t baseVertex) override;
+	virtual void DrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<IndirectBuffer>& indirectBuffer,
+		uint32_t drawCount, uint32_t firstCommand = 0) override;
+	virtual void PushDebugGroup(const char* name) override;
+	virtual void PopDebugGroup() override;
+	virtual void EndFrame() override;
+
+	// 正在录制的日志
+	static NullCommandLog& GetLog();
+	// 把已录制的命令交换到 log 中并开始新的录制；两个日志的内存都会被复用，是否保存数据的设置保持不变
+	static void TakeLog(NullCommandLog& log);
+	// 为新资源分配 ID，从 1 开始且不复用
+	static uint32_t AllocateResourceID();
+};
+
+// 空后端资源的公共部分：构造时分配 ID，析构时记录 Destroy
+class NullResource {
+public:
+	inline uint32_t GetID() const { return m_ID; }
+protected:
+	NullResource() : m_ID(NullRendererAPI::AllocateResourceID()) {}
+	~NullResource() { NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::Destroy, m_ID)); }
+	NullResource(const NullResource&) = delete;
+	NullResource& operator=(const NullResource&) = delete;
+
+	uint32_t m_ID;
+};
+}
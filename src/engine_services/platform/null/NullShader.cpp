@@ -0,0 +1,66 @@
+#include "NullShader.h"
+#include "engine_services/renderer/RendererStatistics.h"
+
+namespace GE {
+
+NullShader::NullShader(const std::string& filepath) {
+	// 与 OpenGLShader 相同：名称为文件名去掉扩展名
+	auto lastSlash = filepath.find_last_of("/\\");
+	lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+	auto lastDot = filepath.rfind('.');
+	auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
+	m_Name = filepath.substr(lastSlash, count);
+
+	const uint32_t pathLength = static_cast<uint32_t>(filepath.size());
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::CreateShader, m_ID, { pathLength }, 0),
+		{ { filepath.data(), pathLength } });
+}
+
+NullShader::NullShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
+	: m_Name(name) {
+	const uint32_t nameLength = static_cast<uint32_t>(name.size());
+	const uint32_t vertexLength = static_cast<uint32_t>(vertexSrc.size());
+	const uint32_t fragmentLength = static_cast<uint32_t>(fragmentSrc.size());
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::CreateShader, m_ID, { nameLength, vertexLength, fragmentLength }, 1),
+		{ { name.data(), nameLength }, { vertexSrc.data(), vertexLength }, { fragmentSrc.data(), fragmentLength } });
+}
+
+void NullShader::Bind() const {
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::BindShader, m_ID));
+	RendererStatistics::Current().ShaderBinds++;
+}
+
+void NullShader::Unbind() const {
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::BindShader, m_ID, {}, 1));
+}
+
+void NullShader::RecordUniform(NullUniformType type, const std::string& name, const void* value, uint32_t size, uint32_t count) const {
+	const uint32_t nameLength = static_cast<uint32_t>(name.size());
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::SetUniform, m_ID, { nameLength, count }, static_cast<uint8_t>(type)),
+		{ { name.data(), nameLength }, { value, size } });
+}
+
+void NullShader::SetInt(const std::string& name, int value) {
+	RecordUniform(NullUniformType::Int, name, &value, sizeof(value));
+}
+
+void NullShader::SetIntArray(const std::string& name, int* values, uint32_t count) {
+	RecordUniform(NullUniformType::IntArray, name, values, count * static_cast<uint32_t>(sizeof(int)), count);
+}
+
+void NullShader::SetFloat(const std::string& name, float value) {
+	RecordUniform(NullUniformType::Float, name, &value, sizeof(value));
+}
+
+void NullShader::SetFloat2(const std::string& name, const Vec2& value) {
+	RecordUniform(NullUniformType::Float2, name, &value, sizeof(value));
+}
+
+void NullShader::SetFloat4(const std::string& name, const Vec4& value) {
+	RecordUniform(NullUniformType::Float4, name, &value, sizeof(value));
+}
+
+void NullShader::SetMat4(const std::string& name, const Mat4& value) {
+	RecordUniform(NullUniformType::Mat4, name, &value, sizeof(value));
+}
+}
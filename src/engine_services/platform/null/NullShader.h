@@ -0,0 +1,33 @@
+#pragma once
+#include "engine_services/renderer/Shader.h"
+#include "NullRendererAPI.h"
+
+// ---------------------------------------------------------------------
+// 类: NullShader
+// 作用: 空渲染后端的着色器
+// 描述: 不编译源码，只记录创建参数（文件路径或源码）与 uniform 的名称和值，回放时据此创建真实的着色器。
+//       名称的推导方式与 OpenGLShader 相同。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class NullShader : public Shader, public NullResource {
+public:
+	NullShader(const std::string& filepath);
+	NullShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
+
+	virtual void Bind() const override;
+	virtual void Unbind() const override;
+	virtual void SetInt(const std::string& name, int value) override;
+	virtual void SetIntArray(const std::string& name, int* values, uint32_t count) override;
+	virtual void SetFloat(const std::string& name, float value) override;
+	virtual void SetFloat2(const std::string& name, const Vec2& value) override;
+	virtual void SetFloat4(const std::string& name, const Vec4& value) override;
+	virtual void SetMat4(const std::string& name, const Mat4& value) override;
+	virtual const std::string& GetName() const override { return m_Name; }
+private:
+	void RecordUniform(NullUniformType type, const std::string& name, const void* value, uint32_t size, uint32_t count = 1) const;
+private:
+	std::string m_Name;
+};
+}
@@ -0,0 +1,85 @@
+#include "NullTexture.h"
+#include "engine_services/renderer/RendererStatistics.h"
+#include <type_traits>
+
+namespace GE {
+
+static_assert(std::is_trivially_copyable_v<TextureSpecification>, "TextureSpecification is recorded as raw bytes");
+
+static inline uint32_t GetMipLevels(const TextureSpecification& specification) {
+	return specification.Mipmaps == MipmapMode::None ? 1 : CalculateMipLevelCount(specification.Width, specification.Height);
+}
+
+static void RecordCreate(uint32_t id, const TextureSpecification& specification, bool array, uint32_t layerCount) {
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::CreateTexture, id, { layerCount }, array ? 1 : 0),
+		&specification, sizeof(specification));
+}
+
+static void RecordData(uint32_t id, const void* data, uint64_t size, uint32_t mipLevel, uint32_t layer) {
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::SetTextureData, id, { layer }, static_cast<uint8_t>(mipLevel)),
+		data, static_cast<uint32_t>(size), true);
+	RendererFrameStatistics& stats = RendererStatistics::Current();
+	stats.TextureUploads++;
+	stats.TextureUploadBytes += size;
+}
+
+static void RecordSubData(uint32_t id, const Buffer& pixels, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t mipLevel) {
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::SetTextureSubData, id, { x, y, width, height }, static_cast<uint8_t>(mipLevel)),
+		pixels.Data, static_cast<uint32_t>(pixels.Size), true);
+	RendererFrameStatistics& stats = RendererStatistics::Current();
+	stats.TextureUploads++;
+	stats.TextureUploadBytes += pixels.Size;
+}
+
+static void RecordBind(uint32_t id, uint32_t slot) {
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::BindTexture, id, { slot }));
+	RendererStatistics::Current().TextureBinds++;
+}
+
+NullTexture2D::NullTexture2D(const TextureSpecification& specification)
+	: m_Specification(specification), m_MipLevels(GetMipLevels(specification)) {
+	RecordCreate(m_ID, specification, false, 1);
+}
+
+void NullTexture2D::SetData(const void* data, uint32_t size, uint32_t mipLevel) {
+	RecordData(m_ID, data, size, mipLevel, 0);
+}
+
+void NullTexture2D::SetData(Buffer&& pixels, uint32_t mipLevel) {
+	RecordData(m_ID, pixels.Data, pixels.Size, mipLevel, 0);
+}
+
+void NullTexture2D::SetSubData(Buffer&& pixels, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t mipLevel) {
+	RecordSubData(m_ID, pixels, x, y, width, height, mipLevel);
+}
+
+void NullTexture2D::Bind(uint32_t slot) const {
+	RecordBind(m_ID, slot);
+}
+
+NullTexture2DArray::NullTexture2DArray(const TextureSpecification& specification, uint32_t layerCount)
+	: m_Specification(specification), m_MipLevels(GetMipLevels(specification)), m_LayerCount(layerCount) {
+	RecordCreate(m_ID, specification, true, layerCount);
+}
+
+void NullTexture2DArray::SetData(const void* data, uint32_t size, uint32_t mipLevel) {
+	RecordData(m_ID, data, size, mipLevel, NullAllLayers);
+}
+
+void NullTexture2DArray::SetData(Buffer&& pixels, uint32_t mipLevel) {
+	RecordData(m_ID, pixels.Data, pixels.Size, mipLevel, NullAllLayers);
+}
+
+void NullTexture2DArray::SetSubData(Buffer&& pixels, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t mipLevel) {
+	RecordSubData(m_ID, pixels, x, y, width, height, mipLevel);
+}
+
+void NullTexture2DArray::SetLayerData(Buffer&& pixels, uint32_t layer, uint32_t mipLevel) {
+	ASSERT_ENGINE(layer < m_LayerCount, "Texture2DArray layer out of range!");
+	RecordData(m_ID, pixels.Data, pixels.Size, mipLevel, layer);
+}
+
+void NullTexture2DArray::Bind(uint32_t slot) const {
+	RecordBind(m_ID, slot);
+}
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "engine_services/renderer/Texture.h"
+#include "NullRendererAPI.h"
+
+// ---------------------------------------------------------------------
+// 类: NullTexture2D / NullTexture2DArray
+// 作用: 空渲染后端的纹理
+// 描述: 保存规格与 mip 层数，像素数据写入 NullCommandLog 后即丢弃，IsLoaded 总是为 true。
+//       GetRendererID 返回资源 ID；不支持无绑定纹理，GetBindlessHandle 返回 0。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class NullTexture2D : public Texture2D, public NullResource {
+public:
+	NullTexture2D(const TextureSpecification& specification);
+
+	virtual const TextureSpecification& GetSpecification() const override { return m_Specification; }
+	virtual uint32_t GetWidth() const override { return m_Specification.Width; }
+	virtual uint32_t GetHeight() const override { return m_Specification.Height; }
+	virtual uint32_t GetMipLevelCount() const override { return m_MipLevels; }
+	virtual uint32_t GetRendererID() const override { return m_ID; }
+
+	virtual void SetData(const void* data, uint32_t size, uint32_t mipLevel = 0) override;
+	virtual void SetData(Buffer&& pixels, uint32_t mipLevel = 0) override;
+	virtual void SetSubData(Buffer&& pixels, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t mipLevel = 0) override;
+	virtual bool IsLoaded() const override { return true; }
+
+	virtual void Bind(uint32_t slot = 0) const override;
+	virtual uint64_t GetBindlessHandle() const override { return 0; }
+
+	virtual bool operator==(const Texture& other) const override { return m_ID == other.GetRendererID(); }
+private:
+	TextureSpecification m_Specification;
+	uint32_t m_MipLevels;
+};
+
+class NullTexture2DArray : public Texture2DArray, public NullResource {
+public:
+	NullTexture2DArray(const TextureSpecification& specification, uint32_t layerCount);
+
+	virtual const TextureSpecification& GetSpecification() const override { return m_Specification; }
+	virtual uint32_t GetWidth() const override { return m_Specification.Width; }
+	virtual uint32_t GetHeight() const override { return m_Specification.Height; }
+	virtual uint32_t GetMipLevelCount() const override { return m_MipLevels; }
+	virtual uint32_t GetRendererID() const override { return m_ID; }
+	virtual uint32_t GetLayerCount() const override { return m_LayerCount; }
+
+	virtual void SetData(const void* data, uint32_t size, uint32_t mipLevel = 0) override;
+	virtual void SetData(Buffer&& pixels, uint32_t mipLevel = 0) override;
+	virtual void SetSubData(Buffer&& pixels, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t mipLevel = 0) override;
+	virtual void SetLayerData(Buffer&& pixels, uint32_t layer, uint32_t mipLevel = 0) override;
+	using Texture2DArray::SetLayerData;
+	virtual bool IsLoaded() const override { return true; }
+
+	virtual void Bind(uint32_t slot = 0) const override;
+	virtual uint64_t GetBindlessHandle() const override { return 0; }
+
+	virtual bool operator==(const Texture& other) const override { return m_ID == other.GetRendererID(); }
+private:
+	TextureSpecification m_Specification;
+	uint32_t m_MipLevels;
+	uint32_t m_LayerCount;
+};
+}
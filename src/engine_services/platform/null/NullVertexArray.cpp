@@ -0,0 +1,32 @@
+#include "NullVertexArray.h"
+#include "NullBuffer.h"
+#include "engine_services/renderer/RendererStatistics.h"
+
+namespace GE {
+
+NullVertexArray::NullVertexArray() {
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::CreateVertexArray, m_ID));
+}
+
+void NullVertexArray::Bind() const {
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::BindVertexArray, m_ID));
+	RendererStatistics::Current().VertexArrayBinds++;
+}
+
+void NullVertexArray::Unbind() const {
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::BindVertexArray, m_ID, {}, 1));
+}
+
+void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) {
+	ASSERT_ENGINE(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
+	const uint32_t bufferID = static_cast<const NullVertexBuffer&>(*vertexBuffer).GetID();
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::AddVertexBuffer, m_ID, { bufferID }));
+	m_VertexBuffers.push_back(vertexBuffer);
+}
+
+void NullVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) {
+	const uint32_t bufferID = indexBuffer ? static_cast<const NullIndexBuffer&>(*indexBuffer).GetID() : 0;
+	NullRendererAPI::GetLog().Record(NullCommand(NullCommandType::SetIndexBuffer, m_ID, { bufferID }));
+	m_IndexBuffer = indexBuffer;
+}
+}
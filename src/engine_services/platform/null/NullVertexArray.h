@@ -0,0 +1,26 @@
+#pragma once
+#include "engine_services/renderer/VertexArray.h"
+#include "NullRendererAPI.h"
+
+// ---------------------------------------------------------------------
+// 类: NullVertexArray
+// 作用: 空渲染后端的顶点数组
+// 描述: 持有顶点缓冲与索引缓冲的引用，绑定与组装记入 NullCommandLog。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class NullVertexArray : public VertexArray, public NullResource {
+public:
+	NullVertexArray();
+	virtual void Bind() const override;
+	virtual void Unbind() const override;
+	virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+	virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override;
+	virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
+	virtual const Ref<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
+private:
+	std::vector<Ref<VertexBuffer>> m_VertexBuffers;
+	Ref<IndexBuffer> m_IndexBuffer;
+};
+}
@@ -1,25 +1,180 @@
 #include "OpenGLBuffer.h"
+#include "OpenGLContext.h"
+#include "OpenGLDeletionQueue.h"
+#include "engine_services/renderer/RendererStatistics.h"
 #include <glad/glad.h>
 
 namespace GE {
 
+// 每段按 256 字节对齐，保证各段起始位置满足顶点/Uniform 数据的对齐要求
+static constexpr uint32_t s_StreamingRegionAlignment = 256;
+
+static inline void CountBufferUpload(uint64_t size) {
+	RendererFrameStatistics& stats = RendererStatistics::Current();
+	stats.BufferUploads++;
+	stats.BufferUploadBytes += size;
+}
+
+// GL 4.5 DSA：glCreateBuffers 立即创建对象，glNamedBufferStorage 分配不可变存储（DYNAMIC_STORAGE 允许 SubData 更新），
+// 全程不触碰任何绑定点。GL 3.3 回退：绑定到 target 后 glBufferData
+static uint32_t CreateBufferObject(GLenum target, GLsizeiptr size, const void* data, GLenum usage) {
+	if (data) {
+		CountBufferUpload(static_cast<uint64_t>(size));
+	}
+	uint32_t rendererID = 0;
+	if (OpenGLContext::GetCapabilities().DirectStateAccess) {
+		glCreateBuffers(1, &rendererID);
+		glNamedBufferStorage(rendererID, size, data, GL_DYNAMIC_STORAGE_BIT);
+		return rendererID;
+	}
+	glGenBuffers(1, &rendererID);
+	glBindBuffer(target, rendererID);
+	glBufferData(target, size, data, usage);
+	return rendererID;
+}
+
+static void UploadBufferData(uint32_t rendererID, GLenum target, GLintptr offset, GLsizeiptr size, const void* data) {
+	CountBufferUpload(static_cast<uint64_t>(size));
+	if (OpenGLContext::GetCapabilities().DirectStateAccess) {
+		glNamedBufferSubData(rendererID, offset, size, data);
+		return;
+	}
+	glBindBuffer(target, rendererID);
+	glBufferSubData(target, offset, size, data);
+}
+
+static inline uint32_t AlignStreamingSize(uint32_t size) {
+	return (size + s_StreamingRegionAlignment - 1) & ~(s_StreamingRegionAlignment - 1);
+}
+
+uint64_t OpenGLStreamingBuffer::s_Frame = 0;
+
+OpenGLStreamingBuffer::OpenGLStreamingBuffer(uint32_t target, uint32_t writeSize)
+	: m_Target(target), m_WriteSize(AlignStreamingSize(writeSize)), m_RegionSize(m_WriteSize * WritesPerRegion) {
+	const OpenGLCapabilities& caps = OpenGLContext::GetCapabilities();
+	// glBufferStorage / 持久映射从 GL 4.4 起为核心功能
+	if (caps.BufferStorage) {
+		const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		const GLsizeiptr totalSize = static_cast<GLsizeiptr>(m_RegionSize) * RegionCount;
+		if (caps.DirectStateAccess) {
+			glCreateBuffers(1, &m_RendererID);
+			glNamedBufferStorage(m_RendererID, totalSize, nullptr, flags);
+			m_MappedData = static_cast<uint8_t*>(glMapNamedBufferRange(m_RendererID, 0, totalSize, flags));
+		} else {
+			glGenBuffers(1, &m_RendererID);
+			glBindBuffer(m_Target, m_RendererID);
+			glBufferStorage(m_Target, totalSize, nullptr, flags);
+			m_MappedData = static_cast<uint8_t*>(glMapBufferRange(m_Target, 0, totalSize, flags));
+		}
+		m_Persistent = m_MappedData != nullptr;
+		if (!m_Persistent) {
+			// 不可变存储无法再用 glBufferData 重新分配，只能换一个新的 buffer 对象
+			LOG_WARN_ENGINE("Persistent buffer mapping failed, falling back to buffer orphaning");
+			glDeleteBuffers(1, &m_RendererID);
+			m_RendererID = 0;
+		}
+	}
+	if (!m_Persistent) {
+		glGenBuffers(1, &m_RendererID);
+		glBindBuffer(m_Target, m_RendererID);
+		glBufferData(m_Target, m_WriteSize, nullptr, GL_STREAM_DRAW);
+	}
+}
+
+OpenGLStreamingBuffer::~OpenGLStreamingBuffer() {
+	for (GLsync& fence : m_Fences) {
+		if (fence) {
+			glDeleteSync(fence);
+			fence = nullptr;
+		}
+	}
+	if (m_MappedData) {
+		if (OpenGLContext::GetCapabilities().DirectStateAccess) {
+			glUnmapNamedBuffer(m_RendererID);
+		} else {
+			glBindBuffer(m_Target, m_RendererID);
+			glUnmapBuffer(m_Target);
+		}
+		m_MappedData = nullptr;
+	}
+	OpenGLDeletionQueue::Enqueue(GLObjectType::Buffer, m_RendererID);
+}
+
+uint32_t OpenGLStreamingBuffer::Write(const void* data, uint32_t size) {
+	ASSERT_ENGINE(size <= m_WriteSize, "Streaming buffer write exceeds its size!");
+	CountBufferUpload(size);
+	if (!m_Persistent) {
+		// 孤立旧存储：驱动会为仍在使用中的旧数据保留副本，避免与 GPU 读取同步
+		glBindBuffer(m_Target, m_RendererID);
+		glBufferData(m_Target, m_WriteSize, nullptr, GL_STREAM_DRAW);
+		glBufferSubData(m_Target, 0, size, data);
+		return 0;
+	}
+	const uint32_t allocationSize = AlignStreamingSize(size);
+	if (m_WriteFrame != s_Frame || m_RegionOffset + allocationSize > m_RegionSize) {
+		NextRegion();
+	}
+	m_CurrentOffset = m_Region * m_RegionSize + m_RegionOffset;
+	m_RegionOffset += allocationSize;
+	memcpy(m_MappedData + m_CurrentOffset, data, size);
+	return m_CurrentOffset;
+}
+
+void OpenGLStreamingBuffer::NextRegion() {
+	// 此前提交的绘制都在引用当前段，插入栅栏以标记它何时可以被再次覆盖
+	if (m_RegionOffset > 0) {
+		m_Fences[m_Region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+	m_Region = (m_Region + 1) % RegionCount;
+	m_RegionOffset = 0;
+	m_WriteFrame = s_Frame;
+	WaitForRegion(m_Region);
+}
+
+void OpenGLStreamingBuffer::WaitForRegion(uint32_t region) {
+	GLsync& fence = m_Fences[region];
+	if (!fence) {
+		return;
+	}
+	// 先零超时轮询一次；GPU 尚未完成时再刷新命令队列并阻塞等待
+	GLbitfield waitFlags = 0;
+	GLuint64 timeout = 0;
+	while (true) {
+		GLenum result = glClientWaitSync(fence, waitFlags, timeout);
+		if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED) {
+			break;
+		}
+		if (result == GL_WAIT_FAILED) {
+			LOG_ERROR_ENGINE("glClientWaitSync failed on streaming buffer region {0}", region);
+			break;
+		}
+		if (!waitFlags) {
+			RendererStatistics::Current().BufferStalls++;
+		}
+		waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+		timeout = 1000000; // 1 ms
+	}
+	glDeleteSync(fence);
+	fence = nullptr;
+}
+
 OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size)
 	: m_Size(size) {
-	glGenBuffers(1, &m_RendererID);
-	glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
-	glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+	m_Streaming = CreateScope<OpenGLStreamingBuffer>(GL_ARRAY_BUFFER, size);
+	m_RendererID = m_Streaming->GetRendererID();
 }
 
 OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size)
 	: m_Size(size) {
 	// 创建并填充顶点缓冲区
-	glGenBuffers(1, &m_RendererID);
-	glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
-	glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
+	m_RendererID = CreateBufferObject(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
 }
 
 OpenGLVertexBuffer::~OpenGLVertexBuffer() {
-	glDeleteBuffers(1, &m_RendererID);
+	// 流式缓冲的 GL 对象由 OpenGLStreamingBuffer 自行释放
+	if (!m_Streaming) {
+		OpenGLDeletionQueue::Enqueue(GLObjectType::Buffer, m_RendererID);
+	}
 }
 
 void OpenGLVertexBuffer::Bind() const {
@@ -30,22 +185,25 @@ void OpenGLVertexBuffer::Unbind() const {
 	glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
-void OpenGLVertexBuffer::SetData(const void* data, uint32_t size) {
-	glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
-	glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+void OpenGLVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+	if (m_Streaming) {
+		ASSERT_ENGINE(offset == 0, "Streaming vertex buffers are rewritten as a whole!");
+		m_Streaming->Write(data, size);
+		return;
+	}
+	ASSERT_ENGINE(offset + size <= m_Size, "Vertex buffer write out of range!");
+	UploadBufferData(m_RendererID, GL_ARRAY_BUFFER, offset, size, data);
 }
 
 OpenGLIndexBuffer::OpenGLIndexBuffer(uint32_t* indices, uint32_t count)
 	: m_Count(count) {
 	// 创建并填充索引缓冲区
-	glGenBuffers(1, &m_RendererID);
-	// 注意: GL_ELEMENT_ARRAY_BUFFER 用于索引缓冲
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
+	// 注意: 回退路径会绑定到 GL_ELEMENT_ARRAY_BUFFER，这会改变当前 VAO 的索引缓冲绑定
+	m_RendererID = CreateBufferObject(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
 }
 
 OpenGLIndexBuffer::~OpenGLIndexBuffer() {
-	glDeleteBuffers(1, &m_RendererID);
+	OpenGLDeletionQueue::Enqueue(GLObjectType::Buffer, m_RendererID);
 }
 
 void OpenGLIndexBuffer::Bind() const {
@@ -55,4 +213,63 @@ void OpenGLIndexBuffer::Bind() const {
 void OpenGLIndexBuffer::Unbind() const {
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
-}
\ No newline at end of file
+
+void OpenGLIndexBuffer::SetData(const uint32_t* indices, uint32_t count, uint32_t offset) {
+	ASSERT_ENGINE(offset + count <= m_Count, "Index buffer write out of range!");
+	// 回退路径通过 GL_COPY_WRITE_BUFFER 上传，避免改动当前 VAO 记录的 GL_ELEMENT_ARRAY_BUFFER 绑定
+	UploadBufferData(m_RendererID, GL_COPY_WRITE_BUFFER, offset * sizeof(uint32_t), count * sizeof(uint32_t), indices);
+}
+
+OpenGLIndirectBuffer::OpenGLIndirectBuffer(uint32_t capacity)
+	: m_Capacity(capacity) {
+	if (OpenGLContext::GetCapabilities().MultiDrawIndirect) {
+		m_RendererID = CreateBufferObject(GL_DRAW_INDIRECT_BUFFER, capacity * sizeof(DrawElementsIndirectCommand), nullptr, GL_DYNAMIC_DRAW);
+	} else {
+		m_ShadowCommands.resize(capacity);
+	}
+}
+
+OpenGLIndirectBuffer::~OpenGLIndirectBuffer() {
+	OpenGLDeletionQueue::Enqueue(GLObjectType::Buffer, m_RendererID);
+}
+
+void OpenGLIndirectBuffer::Bind() const {
+	if (m_RendererID) {
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_RendererID);
+	}
+}
+
+void OpenGLIndirectBuffer::Unbind() const {
+	if (m_RendererID) {
+		glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+	}
+}
+
+void OpenGLIndirectBuffer::SetCommands(const DrawElementsIndirectCommand* commands, uint32_t count, uint32_t offset) {
+	ASSERT_ENGINE(offset + count <= m_Capacity, "Indirect command range exceeds buffer capacity!");
+	if (m_RendererID) {
+		UploadBufferData(m_RendererID, GL_DRAW_INDIRECT_BUFFER, offset * sizeof(DrawElementsIndirectCommand),
+			count * sizeof(DrawElementsIndirectCommand), commands);
+	} else {
+		std::copy(commands, commands + count, m_ShadowCommands.begin() + offset);
+	}
+}
+
+OpenGLStorageBuffer::OpenGLStorageBuffer(uint32_t size)
+	: m_Size(size) {
+	m_RendererID = CreateBufferObject(GL_SHADER_STORAGE_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
+}
+
+OpenGLStorageBuffer::~OpenGLStorageBuffer() {
+	OpenGLDeletionQueue::Enqueue(GLObjectType::Buffer, m_RendererID);
+}
+
+void OpenGLStorageBuffer::Bind(uint32_t binding) const {
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, m_RendererID);
+}
+
+void OpenGLStorageBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+	ASSERT_ENGINE(offset + size <= m_Size, "Storage buffer write out of range!");
+	UploadBufferData(m_RendererID, GL_SHADER_STORAGE_BUFFER, offset, size, data);
+}
+}
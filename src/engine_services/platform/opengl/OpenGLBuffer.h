@@ -1,30 +1,92 @@
 #pragma once
 #include "engine_services/renderer/Buffer.h"
 
+typedef struct __GLsync* GLsync;
+
 // ---------------------------------------------------------------------
 // 类: OpenGLVertexBuffer / OpenGLIndexBuffer
 // 作用: OpenGL 缓冲区的具体实现
 // 描述: 分别实现了 VertexBuffer 和 IndexBuffer 接口。
-//       内部维护了 OpenGL 的 Buffer ID (m_RendererID)，并调用 glGenBuffers, glBufferData 等 API。
+//       内部维护了 OpenGL 的 Buffer ID (m_RendererID)。GL 4.5 下使用 DSA (glCreateBuffers,
+//       glNamedBufferStorage, glNamedBufferSubData) 创建和更新，不改变任何绑定状态；
+//       GL 3.3 下回退到 glGenBuffers, glBufferData 等绑定后编辑的 API。
 // ---------------------------------------------------------------------
 
 namespace GE {
 
+// ---------------------------------------------------------------------
+// 类: OpenGLStreamingBuffer
+// 作用: 每帧都会重写的动态数据（精灵、粒子、UI 顶点）使用的流式缓冲区
+// 描述: GL 4.4+ 使用 glBufferStorage 创建持久映射 (PERSISTENT | COHERENT) 的存储，
+//       按 RegionCount 段做环形分配，每帧使用一段：同一帧内的多次写入在段内依次分配，
+//       进入新的一帧后才给上一段插入 glFenceSync 并切换到下一段，等待 GPU 用完该段后再覆盖。
+//       CPU 直接写入 GPU 可见内存，不再经过驱动的额外拷贝。一帧的写入超过段的容量时提前切换（可能等待 GPU）。
+//       GL 3.3 下退化为 glBufferData(nullptr) 孤立 (orphaning) 旧存储后再上传。
+// ---------------------------------------------------------------------
+class OpenGLStreamingBuffer {
+public:
+	// 三重缓冲：CPU 写第 N 段时，GPU 可能仍在读取前两段
+	static constexpr uint32_t RegionCount = 3;
+	// 每段可容纳的满尺寸写入次数
+	static constexpr uint32_t WritesPerRegion = 4;
+
+	// writeSize 为单次写入的最大字节数
+	OpenGLStreamingBuffer(uint32_t target, uint32_t writeSize);
+	~OpenGLStreamingBuffer();
+	OpenGLStreamingBuffer(const OpenGLStreamingBuffer&) = delete;
+	OpenGLStreamingBuffer& operator=(const OpenGLStreamingBuffer&) = delete;
+
+	// 在当前帧的段内分配并写入数据，返回写入位置在整个缓冲区中的字节偏移
+	uint32_t Write(const void* data, uint32_t size);
+
+	inline uint32_t GetRendererID() const { return m_RendererID; }
+	// 最近一次写入的字节偏移（孤立模式下恒为 0）
+	inline uint32_t GetCurrentOffset() const { return m_CurrentOffset; }
+	inline bool IsPersistent() const { return m_Persistent; }
+
+	// 帧结束时由 OpenGLRendererAPI::EndFrame 调用，之后的写入进入下一段
+	inline static void EndFrame() { s_Frame++; }
+private:
+	// 给当前段插入栅栏（若已写入），切换到下一段并等待 GPU 用完它
+	void NextRegion();
+	void WaitForRegion(uint32_t region);
+private:
+	uint32_t m_Target;
+	uint32_t m_RendererID = 0;
+	uint32_t m_WriteSize;
+	uint32_t m_RegionSize;
+	uint32_t m_Region = RegionCount - 1;
+	uint32_t m_RegionOffset = 0;  // 当前段内已分配的字节数
+	uint32_t m_CurrentOffset = 0;
+	uint64_t m_WriteFrame = ~0ull; // 当前段所属的帧
+	static uint64_t s_Frame;
+	bool m_Persistent = false;
+	uint8_t* m_MappedData = nullptr;
+	GLsync m_Fences[RegionCount] = {};
+};
+
 class OpenGLVertexBuffer : public VertexBuffer {
 public:
+	// 仅指定大小：创建动态缓冲，数据通过 SetData 以流式方式每帧更新
 	OpenGLVertexBuffer(uint32_t size);
 	OpenGLVertexBuffer(float* vertices, uint32_t size);
 	virtual ~OpenGLVertexBuffer();
 	virtual void Bind() const override;
 	virtual void Unbind() const override;
-	virtual void SetData(const void* data, uint32_t size) override;
+	virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
 	virtual const BufferLayout& GetLayout() const override { return m_Layout; }
 	virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
 	virtual uint32_t GetSize() const override { return m_Size; }
+
+	inline uint32_t GetRendererID() const { return m_RendererID; }
+	// 持久映射的流式缓冲每次 SetData 都写在新的位置，VAO 需要据此调整属性的绑定偏移
+	inline bool IsPersistentlyMapped() const { return m_Streaming && m_Streaming->IsPersistent(); }
+	inline uint32_t GetStreamingOffset() const { return m_Streaming ? m_Streaming->GetCurrentOffset() : 0; }
 private:
 	uint32_t m_RendererID;
 	BufferLayout m_Layout;
 	uint32_t m_Size;
+	Scope<OpenGLStreamingBuffer> m_Streaming;
 };
 
 class OpenGLIndexBuffer : public IndexBuffer {
@@ -34,8 +96,39 @@ public:
 	virtual void Bind() const override;
 	virtual void Unbind() const override;
 	virtual uint32_t GetCount() const override { return m_Count; }
+	virtual void SetData(const uint32_t* indices, uint32_t count, uint32_t offset = 0) override;
+
+	inline uint32_t GetRendererID() const { return m_RendererID; }
 private:
 	uint32_t m_RendererID;
 	uint32_t m_Count;
 };
-}
\ No newline at end of file
+
+class OpenGLIndirectBuffer : public IndirectBuffer {
+public:
+	OpenGLIndirectBuffer(uint32_t capacity);
+	virtual ~OpenGLIndirectBuffer();
+	virtual void Bind() const override;
+	virtual void Unbind() const override;
+	virtual void SetCommands(const DrawElementsIndirectCommand* commands, uint32_t count, uint32_t offset = 0) override;
+	virtual uint32_t GetCapacity() const override { return m_Capacity; }
+	// GL 4.3 以下没有 glMultiDrawElementsIndirect，需要 CPU 端副本逐条绘制
+	inline const std::vector<DrawElementsIndirectCommand>& GetShadowCommands() const { return m_ShadowCommands; }
+private:
+	uint32_t m_RendererID = 0;
+	uint32_t m_Capacity;
+	std::vector<DrawElementsIndirectCommand> m_ShadowCommands;
+};
+
+class OpenGLStorageBuffer : public StorageBuffer {
+public:
+	OpenGLStorageBuffer(uint32_t size);
+	virtual ~OpenGLStorageBuffer();
+	virtual void Bind(uint32_t binding) const override;
+	virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+	virtual uint32_t GetSize() const override { return m_Size; }
+private:
+	uint32_t m_RendererID = 0;
+	uint32_t m_Size;
+};
+}
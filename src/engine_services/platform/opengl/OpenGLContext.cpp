@@ -1,4 +1,5 @@
 #include "OpenGLContext.h"
+#include "OpenGLExtensions.h"
 #include "core/Core.h"
 #include "core/Log.h"
 #ifdef PLATFORM_WINDOWS
@@ -11,6 +12,8 @@
 
 namespace GE {
 
+OpenGLCapabilities OpenGLContext::s_Capabilities;
+
 OpenGLContext::OpenGLContext(GLFWwindow* windowHandle) : m_WindowHandle(windowHandle) {
 		ASSERT_ENGINE(windowHandle, "Window handle is null!")
 }
@@ -19,10 +22,15 @@ void OpenGLContext::InitContext() {
 	// 将当前上下文设置为此线程的主上下文
 	glfwMakeContextCurrent(m_WindowHandle);
 		
+	LoadFunctions((LoadProc)glfwGetProcAddress);
+}
+
+bool OpenGLContext::LoadFunctions(LoadProc loader) {
 	// 初始化 GLAD (加载 OpenGL 函数指针)
-	int status = gladLoadGLLoader((GLADloadproc)glfwGetProcAddress);
+	int status = gladLoadGLLoader((GLADloadproc)loader);
 	if (!status) {
 		LOG_ERROR_ENGINE("Failed to initialize Glad!");
+		return false;
 	}
 	//ASSERT_ENGINE(status, "Failed to initialize Glad!");
 
@@ -31,6 +39,26 @@ void OpenGLContext::InitContext() {
 	LOG_INFO_ENGINE("  Vendor: {0}", reinterpret_cast<const char*>(glGetString(GL_VENDOR)));
 	LOG_INFO_ENGINE("  Renderer: {0}", reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
 	LOG_INFO_ENGINE("  Version: {0}", reinterpret_cast<const char*>(glGetString(GL_VERSION)));
+
+	// 记录上下文版本，决定后续使用的代码路径
+	glGetIntegerv(GL_MAJOR_VERSION, &s_Capabilities.MajorVersion);
+	glGetIntegerv(GL_MINOR_VERSION, &s_Capabilities.MinorVersion);
+	s_Capabilities.DirectStateAccess = GLAD_GL_VERSION_4_5 != 0;
+	s_Capabilities.BufferStorage = GLAD_GL_VERSION_4_4 != 0;
+	s_Capabilities.MultiDrawIndirect = GLAD_GL_VERSION_4_3 != 0;
+	s_Capabilities.TextureStorage = GLAD_GL_VERSION_4_2 != 0;
+	s_Capabilities.BaseInstance = GLAD_GL_VERSION_4_2 != 0;
+	s_Capabilities.TextureAnisotropy = GLAD_GL_VERSION_4_6 != 0;
+	s_Capabilities.DebugGroups = GLAD_GL_VERSION_4_3 != 0;
+
+	OpenGLExtensions::Load(loader);
+	const OpenGLExtensionFunctions& extensions = OpenGLExtensions::Get();
+	s_Capabilities.BindlessTexture = extensions.GetTextureSamplerHandleARB && extensions.MakeTextureHandleResidentARB
+		&& extensions.MakeTextureHandleNonResidentARB && s_Capabilities.MultiDrawIndirect; // 句柄表存放在 SSBO 中
+	LOG_INFO_ENGINE("  Context: {0}.{1} (DSA: {2}, BufferStorage: {3}, MultiDrawIndirect: {4}, BindlessTexture: {5})",
+		s_Capabilities.MajorVersion, s_Capabilities.MinorVersion, s_Capabilities.DirectStateAccess,
+		s_Capabilities.BufferStorage, s_Capabilities.MultiDrawIndirect, s_Capabilities.BindlessTexture);
+	return true;
 }
 
 void OpenGLContext::SwapBuffers() {
@@ -38,4 +66,12 @@ void OpenGLContext::SwapBuffers() {
 	glfwSwapBuffers(m_WindowHandle);
 }
 
-}
\ No newline at end of file
+
+void OpenGLContext::MakeCurrent() {
+	glfwMakeContextCurrent(m_WindowHandle);
+}
+
+void OpenGLContext::ReleaseCurrent() {
+	glfwMakeContextCurrent(nullptr);
+}
+}
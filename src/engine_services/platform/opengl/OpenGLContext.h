@@ -5,12 +5,37 @@ struct GLFWwindow;
 
 namespace GE {
 
+// 运行时检测到的 OpenGL 能力，由 InitContext 根据上下文实际版本填写，
+// 各 OpenGL 类据此在 DSA / 持久映射等新路径与 GL 3.3 回退路径之间选择
+struct OpenGLCapabilities {
+    int MajorVersion = 0;
+    int MinorVersion = 0;
+    bool DirectStateAccess = false; // GL 4.5: glCreate*, glNamedBuffer*, glVertexArray*
+    bool BufferStorage = false;     // GL 4.4: glBufferStorage 与持久映射
+    bool MultiDrawIndirect = false; // GL 4.3: glMultiDrawElementsIndirect, SSBO
+    bool TextureStorage = false;    // GL 4.2: glTexStorage2D 不可变纹理存储
+    bool BaseInstance = false;      // GL 4.2: glDrawElementsInstancedBaseVertexBaseInstance
+    bool TextureAnisotropy = false; // GL 4.6: GL_TEXTURE_MAX_ANISOTROPY
+    bool BindlessTexture = false;   // GL_ARB_bindless_texture（扩展，见 OpenGLExtensions）
+    bool DebugGroups = false;       // GL 4.3: glPushDebugGroup / glObjectLabel
+};
+
 class OpenGLContext : public IGraphicsContext {
 public:
     OpenGLContext(GLFWwindow* windowHandle);
     virtual void InitContext() override;
     virtual void SwapBuffers() override;
+    virtual void MakeCurrent() override;
+    virtual void ReleaseCurrent() override;
+
+    inline static const OpenGLCapabilities& GetCapabilities() { return s_Capabilities; }
+
+    using LoadProc = void* (*)(const char* name);
+    // 通过 loader 加载 GL 与扩展函数并检测能力，需要当前线程上有 GL 上下文；
+    // 供其他创建 GL 上下文的方式（如 OpenGLHeadlessContext）共用
+    static bool LoadFunctions(LoadProc loader);
 private:
     GLFWwindow* m_WindowHandle;
+    static OpenGLCapabilities s_Capabilities;
 };
 }
\ No newline at end of file
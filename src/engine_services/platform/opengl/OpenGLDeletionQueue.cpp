@@ -0,0 +1,129 @@
+#include "OpenGLDeletionQueue.h"
+#include <glad/glad.h>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace GE {
+
+static constexpr uint32_t s_ObjectTypeCount = static_cast<uint32_t>(GLObjectType::Count);
+
+struct DeletionBatch {
+	std::vector<uint32_t> Objects[s_ObjectTypeCount];
+	GLsync Fence = nullptr;
+
+	bool IsEmpty() const {
+		for (const auto& objects : Objects) {
+			if (!objects.empty()) {
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+struct DeletionQueueData {
+	// 本帧入队的对象，任意线程写入
+	std::mutex PendingMutex;
+	DeletionBatch Pending;
+	// 以下只在渲染线程上访问
+	std::deque<DeletionBatch> InFlight;
+	std::vector<DeletionBatch> FreeBatches; // 复用已删除批次的容量
+	std::atomic<uint32_t> PendingCount{ 0 };
+};
+static DeletionQueueData s_Data;
+
+// 按类型批量删除；程序对象没有批量接口，逐个删除
+static void DeleteBatch(DeletionBatch& batch) {
+	uint32_t deleted = 0;
+	for (uint32_t type = 0; type < s_ObjectTypeCount; ++type) {
+		std::vector<uint32_t>& objects = batch.Objects[type];
+		if (objects.empty()) {
+			continue;
+		}
+		const GLsizei count = static_cast<GLsizei>(objects.size());
+		switch (static_cast<GLObjectType>(type)) {
+			case GLObjectType::Buffer:       glDeleteBuffers(count, objects.data()); break;
+			case GLObjectType::VertexArray:  glDeleteVertexArrays(count, objects.data()); break;
+			case GLObjectType::Texture:      glDeleteTextures(count, objects.data()); break;
+			case GLObjectType::Framebuffer:  glDeleteFramebuffers(count, objects.data()); break;
+			case GLObjectType::Renderbuffer: glDeleteRenderbuffers(count, objects.data()); break;
+			case GLObjectType::Program:
+				for (uint32_t program : objects) {
+					glDeleteProgram(program);
+				}
+				break;
+			default: break;
+		}
+		deleted += static_cast<uint32_t>(objects.size());
+		objects.clear();
+	}
+	if (batch.Fence) {
+		glDeleteSync(batch.Fence);
+		batch.Fence = nullptr;
+	}
+	s_Data.PendingCount.fetch_sub(deleted, std::memory_order_relaxed);
+}
+
+void OpenGLDeletionQueue::Enqueue(GLObjectType type, uint32_t id) {
+	Enqueue(type, &id, 1);
+}
+
+void OpenGLDeletionQueue::Enqueue(GLObjectType type, const uint32_t* ids, uint32_t count) {
+	std::lock_guard<std::mutex> lock(s_Data.PendingMutex);
+	std::vector<uint32_t>& objects = s_Data.Pending.Objects[static_cast<uint32_t>(type)];
+	for (uint32_t i = 0; i < count; ++i) {
+		if (ids[i]) {
+			objects.push_back(ids[i]);
+			s_Data.PendingCount.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+void OpenGLDeletionQueue::EndFrame() {
+	// 按提交顺序检查，前面的批次未完成时后面的也不会完成
+	while (!s_Data.InFlight.empty()) {
+		DeletionBatch& batch = s_Data.InFlight.front();
+		const GLenum result = glClientWaitSync(batch.Fence, 0, 0);
+		if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED) {
+			break;
+		}
+		DeleteBatch(batch);
+		s_Data.FreeBatches.push_back(std::move(batch));
+		s_Data.InFlight.pop_front();
+	}
+
+	DeletionBatch batch;
+	if (!s_Data.FreeBatches.empty()) {
+		batch = std::move(s_Data.FreeBatches.back());
+		s_Data.FreeBatches.pop_back();
+	}
+	{
+		std::lock_guard<std::mutex> lock(s_Data.PendingMutex);
+		if (s_Data.Pending.IsEmpty()) {
+			s_Data.FreeBatches.push_back(std::move(batch));
+			return;
+		}
+		std::swap(batch, s_Data.Pending);
+	}
+	// 栅栏位于本帧所有命令之后，触发时这些命令都已执行完毕
+	batch.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	s_Data.InFlight.push_back(std::move(batch));
+}
+
+void OpenGLDeletionQueue::Flush() {
+	glFinish();
+	for (DeletionBatch& batch : s_Data.InFlight) {
+		DeleteBatch(batch);
+	}
+	s_Data.InFlight.clear();
+	s_Data.FreeBatches.clear();
+	std::lock_guard<std::mutex> lock(s_Data.PendingMutex);
+	DeleteBatch(s_Data.Pending);
+}
+
+uint32_t OpenGLDeletionQueue::GetPendingCount() {
+	return s_Data.PendingCount.load(std::memory_order_relaxed);
+}
+}
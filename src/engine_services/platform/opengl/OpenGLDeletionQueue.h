@@ -0,0 +1,41 @@
+#pragma once
+#include "core/Core.h"
+#include <cstdint>
+
+// ---------------------------------------------------------------------
+// 类: OpenGLDeletionQueue
+// 作用: 延迟删除 GL 对象
+// 描述: 资源析构时不直接调用 glDelete*，而是把对象名放入队列：GPU 可能仍在执行引用它的命令，
+//       立即删除可能让驱动同步等待；析构也可能发生在不持有上下文的线程上。
+//       每帧结束时（渲染线程上）本帧入队的对象连同一个 glFenceSync 成为一批，
+//       之后某帧发现栅栏已经触发，才按类型批量删除这一批对象；轮询从不等待 GPU。
+//       Enqueue 可以在任意线程上调用。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+enum class GLObjectType : uint8_t {
+	Buffer = 0,
+	VertexArray,
+	Program,
+	Texture,
+	Framebuffer,
+	Renderbuffer,
+	Count
+};
+
+class OpenGLDeletionQueue {
+public:
+	// 对象名为 0 时忽略
+	static void Enqueue(GLObjectType type, uint32_t id);
+	static void Enqueue(GLObjectType type, const uint32_t* ids, uint32_t count);
+
+	// 由 OpenGLRendererAPI::EndFrame 调用：为本帧入队的对象插入栅栏，删除栅栏已触发的批次
+	static void EndFrame();
+	// 等待 GPU 执行完毕并删除全部排队的对象，在上下文销毁之前调用
+	static void Flush();
+
+	// 尚未删除的对象数量
+	static uint32_t GetPendingCount();
+};
+}
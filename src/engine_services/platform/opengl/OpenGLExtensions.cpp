@@ -0,0 +1,31 @@
+#include "OpenGLExtensions.h"
+#include <unordered_set>
+
+namespace GE {
+
+OpenGLExtensionFunctions OpenGLExtensions::s_Functions;
+static std::unordered_set<std::string> s_Extensions;
+
+void OpenGLExtensions::Load(LoadProc loader) {
+	s_Extensions.clear();
+	GLint count = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+	for (GLint i = 0; i < count; ++i) {
+		if (const GLubyte* name = glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i))) {
+			s_Extensions.insert(reinterpret_cast<const char*>(name));
+		}
+	}
+
+	s_Functions = OpenGLExtensionFunctions();
+	if (IsSupported("GL_ARB_bindless_texture")) {
+		s_Functions.GetTextureHandleARB = reinterpret_cast<PFNGLGETTEXTUREHANDLEARBPROC>(loader("glGetTextureHandleARB"));
+		s_Functions.GetTextureSamplerHandleARB = reinterpret_cast<PFNGLGETTEXTURESAMPLERHANDLEARBPROC>(loader("glGetTextureSamplerHandleARB"));
+		s_Functions.MakeTextureHandleResidentARB = reinterpret_cast<PFNGLMAKETEXTUREHANDLERESIDENTARBPROC>(loader("glMakeTextureHandleResidentARB"));
+		s_Functions.MakeTextureHandleNonResidentARB = reinterpret_cast<PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC>(loader("glMakeTextureHandleNonResidentARB"));
+	}
+}
+
+bool OpenGLExtensions::IsSupported(const std::string& extension) {
+	return s_Extensions.find(extension) != s_Extensions.end();
+}
+}
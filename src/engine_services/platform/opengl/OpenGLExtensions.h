@@ -0,0 +1,40 @@
+#pragma once
+#include <glad/glad.h>
+#include <string>
+
+// ---------------------------------------------------------------------
+// 类: OpenGLExtensions
+// 作用: OpenGL 扩展检测与扩展函数加载
+// 描述: glad 只生成了核心 4.6 的函数，没有任何扩展。这里按需手动声明用到的扩展函数，
+//       由 OpenGLContext::InitContext 在 glad 之后通过同一个加载器加载；
+//       扩展不存在或函数加载失败时对应的指针为 nullptr，调用前应先检查 OpenGLCapabilities。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+// GL_ARB_bindless_texture
+typedef GLuint64 (APIENTRYP PFNGLGETTEXTUREHANDLEARBPROC)(GLuint texture);
+typedef GLuint64 (APIENTRYP PFNGLGETTEXTURESAMPLERHANDLEARBPROC)(GLuint texture, GLuint sampler);
+typedef void (APIENTRYP PFNGLMAKETEXTUREHANDLERESIDENTARBPROC)(GLuint64 handle);
+typedef void (APIENTRYP PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)(GLuint64 handle);
+
+struct OpenGLExtensionFunctions {
+	PFNGLGETTEXTUREHANDLEARBPROC GetTextureHandleARB = nullptr;
+	PFNGLGETTEXTURESAMPLERHANDLEARBPROC GetTextureSamplerHandleARB = nullptr;
+	PFNGLMAKETEXTUREHANDLERESIDENTARBPROC MakeTextureHandleResidentARB = nullptr;
+	PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC MakeTextureHandleNonResidentARB = nullptr;
+};
+
+class OpenGLExtensions {
+public:
+	using LoadProc = void* (*)(const char* name);
+
+	// 读取扩展列表并加载扩展函数，需要当前线程上有 GL 上下文
+	static void Load(LoadProc loader);
+	static bool IsSupported(const std::string& extension);
+
+	inline static const OpenGLExtensionFunctions& Get() { return s_Functions; }
+private:
+	static OpenGLExtensionFunctions s_Functions;
+};
+}
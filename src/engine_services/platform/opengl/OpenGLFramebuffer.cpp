@@ -0,0 +1,358 @@
+#include "OpenGLFramebuffer.h"
+#include "OpenGLContext.h"
+#include "OpenGLDeletionQueue.h"
+#include "core/Log.h"
+#include "engine_services/renderer/RendererStatistics.h"
+#include <glad/glad.h>
+#include <algorithm>
+
+namespace GE {
+
+// ==================== 格式映射 ====================
+
+struct FramebufferFormatInfo {
+	GLenum InternalFormat;
+	GLenum DataFormat; // 仅 GL 4.2 以下逐层 glTexImage2D 分配时使用
+	GLenum DataType;
+	GLenum Attachment; // 深度格式的附着点
+};
+
+static FramebufferFormatInfo FramebufferFormatToOpenGL(FramebufferTextureFormat format) {
+	switch (format) {
+		case FramebufferTextureFormat::None:            break;
+		case FramebufferTextureFormat::RGBA8:           return { GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, 0 };
+		case FramebufferTextureFormat::RGBA16F:         return { GL_RGBA16F, GL_RGBA, GL_HALF_FLOAT, 0 };
+		case FramebufferTextureFormat::RGBA32F:         return { GL_RGBA32F, GL_RGBA, GL_FLOAT, 0 };
+		case FramebufferTextureFormat::RedInteger:      return { GL_R32I, GL_RED_INTEGER, GL_INT, 0 };
+		case FramebufferTextureFormat::Depth24Stencil8: return { GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, GL_DEPTH_STENCIL_ATTACHMENT };
+		case FramebufferTextureFormat::Depth32F:        return { GL_DEPTH_COMPONENT32F, GL_DEPTH_COMPONENT, GL_FLOAT, GL_DEPTH_ATTACHMENT };
+	}
+	ASSERT_ENGINE(false, "Unknown FramebufferTextureFormat!");
+	return { 0, 0, 0, 0 };
+}
+
+static uint32_t CreateAttachmentTexture(const FramebufferAttachmentSpecification& attachment, uint32_t width, uint32_t height) {
+	const FramebufferFormatInfo format = FramebufferFormatToOpenGL(attachment.Format);
+	// 整数纹理不能线性过滤
+	const bool linear = attachment.Filter == TextureFilter::Linear && attachment.Format != FramebufferTextureFormat::RedInteger;
+	const GLint filter = linear ? GL_LINEAR : GL_NEAREST;
+	const GLsizei textureWidth = static_cast<GLsizei>(width);
+	const GLsizei textureHeight = static_cast<GLsizei>(height);
+	const OpenGLCapabilities& caps = OpenGLContext::GetCapabilities();
+	uint32_t texture = 0;
+	if (caps.DirectStateAccess) {
+		glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+		glTextureStorage2D(texture, 1, format.InternalFormat, textureWidth, textureHeight);
+		glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, filter);
+		glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, filter);
+		glTextureParameteri(texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTextureParameteri(texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		return texture;
+	}
+	GLint previous = 0;
+	glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+	glGenTextures(1, &texture);
+	glBindTexture(GL_TEXTURE_2D, texture);
+	if (caps.TextureStorage) {
+		glTexStorage2D(GL_TEXTURE_2D, 1, format.InternalFormat, textureWidth, textureHeight);
+	} else {
+		glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(format.InternalFormat), textureWidth, textureHeight, 0, format.DataFormat, format.DataType, nullptr);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0);
+	}
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+	glBindTexture(GL_TEXTURE_2D, static_cast<GLuint>(previous));
+	return texture;
+}
+
+static uint32_t CreateAttachmentRenderbuffer(FramebufferTextureFormat format, uint32_t samples, uint32_t width, uint32_t height) {
+	const GLenum internalFormat = FramebufferFormatToOpenGL(format).InternalFormat;
+	const GLsizei sampleCount = static_cast<GLsizei>(samples);
+	const GLsizei bufferWidth = static_cast<GLsizei>(width);
+	const GLsizei bufferHeight = static_cast<GLsizei>(height);
+	uint32_t renderbuffer = 0;
+	if (OpenGLContext::GetCapabilities().DirectStateAccess) {
+		glCreateRenderbuffers(1, &renderbuffer);
+		glNamedRenderbufferStorageMultisample(renderbuffer, sampleCount, internalFormat, bufferWidth, bufferHeight);
+		return renderbuffer;
+	}
+	glGenRenderbuffers(1, &renderbuffer);
+	glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+	glRenderbufferStorageMultisample(GL_RENDERBUFFER, sampleCount, internalFormat, bufferWidth, bufferHeight);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+	return renderbuffer;
+}
+
+// 把附件挂到帧缓冲上，并设置绘制缓冲为 COLOR_ATTACHMENT0..N-1（没有颜色附件时为 GL_NONE）
+static void AttachAll(uint32_t framebuffer, const std::vector<uint32_t>& colors, uint32_t depth, GLenum depthAttachment, bool renderbuffers) {
+	std::vector<GLenum> drawBuffers;
+	drawBuffers.reserve(colors.size());
+	for (size_t i = 0; i < colors.size(); ++i) {
+		drawBuffers.push_back(GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i));
+	}
+	if (OpenGLContext::GetCapabilities().DirectStateAccess) {
+		for (size_t i = 0; i < colors.size(); ++i) {
+			if (renderbuffers) {
+				glNamedFramebufferRenderbuffer(framebuffer, drawBuffers[i], GL_RENDERBUFFER, colors[i]);
+			} else {
+				glNamedFramebufferTexture(framebuffer, drawBuffers[i], colors[i], 0);
+			}
+		}
+		if (depth) {
+			if (renderbuffers) {
+				glNamedFramebufferRenderbuffer(framebuffer, depthAttachment, GL_RENDERBUFFER, depth);
+			} else {
+				glNamedFramebufferTexture(framebuffer, depthAttachment, depth, 0);
+			}
+		}
+		if (drawBuffers.empty()) {
+			glNamedFramebufferDrawBuffer(framebuffer, GL_NONE);
+			glNamedFramebufferReadBuffer(framebuffer, GL_NONE);
+		} else {
+			glNamedFramebufferDrawBuffers(framebuffer, static_cast<GLsizei>(drawBuffers.size()), drawBuffers.data());
+		}
+		return;
+	}
+	for (size_t i = 0; i < colors.size(); ++i) {
+		if (renderbuffers) {
+			glFramebufferRenderbuffer(GL_FRAMEBUFFER, drawBuffers[i], GL_RENDERBUFFER, colors[i]);
+		} else {
+			glFramebufferTexture2D(GL_FRAMEBUFFER, drawBuffers[i], GL_TEXTURE_2D, colors[i], 0);
+		}
+	}
+	if (depth) {
+		if (renderbuffers) {
+			glFramebufferRenderbuffer(GL_FRAMEBUFFER, depthAttachment, GL_RENDERBUFFER, depth);
+		} else {
+			glFramebufferTexture2D(GL_FRAMEBUFFER, depthAttachment, GL_TEXTURE_2D, depth, 0);
+		}
+	}
+	if (drawBuffers.empty()) {
+		glDrawBuffer(GL_NONE);
+		glReadBuffer(GL_NONE);
+	} else {
+		glDrawBuffers(static_cast<GLsizei>(drawBuffers.size()), drawBuffers.data());
+	}
+}
+
+static bool CheckStatus(uint32_t framebuffer) {
+	const GLenum status = OpenGLContext::GetCapabilities().DirectStateAccess
+		? glCheckNamedFramebufferStatus(framebuffer, GL_FRAMEBUFFER)
+		: glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	if (status != GL_FRAMEBUFFER_COMPLETE) {
+		LOG_ERROR_ENGINE("Framebuffer is incomplete (status 0x{0:x})", status);
+		return false;
+	}
+	return true;
+}
+
+// ==================== OpenGLFramebuffer ====================
+
+OpenGLFramebuffer::OpenGLFramebuffer(const FramebufferSpecification& specification)
+	: m_Specification(specification) {
+	for (const FramebufferAttachmentSpecification& attachment : specification.Attachments) {
+		if (IsDepthFormat(attachment.Format)) {
+			ASSERT_ENGINE(m_DepthSpecification.Format == FramebufferTextureFormat::None, "Framebuffer can only have one depth attachment!");
+			m_DepthSpecification = attachment;
+		} else if (attachment.Format != FramebufferTextureFormat::None) {
+			m_ColorSpecifications.push_back(attachment);
+		}
+	}
+	Invalidate();
+}
+
+OpenGLFramebuffer::~OpenGLFramebuffer() {
+	Release();
+}
+
+void OpenGLFramebuffer::Release() {
+	// 调整尺寸时上一帧可能仍在采样旧的附件，经由删除队列等 GPU 用完再删除
+	OpenGLDeletionQueue::Enqueue(GLObjectType::Framebuffer, m_RendererID);
+	OpenGLDeletionQueue::Enqueue(GLObjectType::Framebuffer, m_ResolveRendererID);
+	OpenGLDeletionQueue::Enqueue(GLObjectType::Texture, m_ColorAttachments.data(), static_cast<uint32_t>(m_ColorAttachments.size()));
+	OpenGLDeletionQueue::Enqueue(GLObjectType::Texture, m_DepthAttachment);
+	OpenGLDeletionQueue::Enqueue(GLObjectType::Renderbuffer, m_ColorRenderbuffers.data(), static_cast<uint32_t>(m_ColorRenderbuffers.size()));
+	OpenGLDeletionQueue::Enqueue(GLObjectType::Renderbuffer, m_DepthRenderbuffer);
+	m_RendererID = m_ResolveRendererID = 0;
+	m_ColorAttachments.clear();
+	m_ColorRenderbuffers.clear();
+	m_DepthAttachment = m_DepthRenderbuffer = 0;
+}
+
+void OpenGLFramebuffer::Invalidate() {
+	Release();
+	const uint32_t width = m_Specification.Width;
+	const uint32_t height = m_Specification.Height;
+	ASSERT_ENGINE(width > 0 && height > 0, "Framebuffer size must be non-zero!");
+
+	GLint maxSamples = 1;
+	glGetIntegerv(GL_MAX_SAMPLES, &maxSamples);
+	m_Samples = std::clamp(m_Specification.Samples, 1u, static_cast<uint32_t>(maxSamples));
+	if (m_Samples != m_Specification.Samples) {
+		LOG_WARN_ENGINE("Framebuffer: {0}x MSAA is not supported, using {1}x", m_Specification.Samples, m_Samples);
+	}
+
+	// 单采样纹理：不使用多重采样时直接作为渲染目标，否则作为解析目标
+	for (const FramebufferAttachmentSpecification& attachment : m_ColorSpecifications) {
+		m_ColorAttachments.push_back(CreateAttachmentTexture(attachment, width, height));
+	}
+	const bool hasDepth = m_DepthSpecification.Format != FramebufferTextureFormat::None;
+	const GLenum depthAttachment = hasDepth ? FramebufferFormatToOpenGL(m_DepthSpecification.Format).Attachment : 0;
+	if (hasDepth) {
+		m_DepthAttachment = CreateAttachmentTexture(m_DepthSpecification, width, height);
+	}
+	if (IsMultisampled()) {
+		for (const FramebufferAttachmentSpecification& attachment : m_ColorSpecifications) {
+			m_ColorRenderbuffers.push_back(CreateAttachmentRenderbuffer(attachment.Format, m_Samples, width, height));
+		}
+		if (hasDepth) {
+			m_DepthRenderbuffer = CreateAttachmentRenderbuffer(m_DepthSpecification.Format, m_Samples, width, height);
+		}
+	}
+
+	if (OpenGLContext::GetCapabilities().DirectStateAccess) {
+		glCreateFramebuffers(1, &m_RendererID);
+		if (IsMultisampled()) {
+			glCreateFramebuffers(1, &m_ResolveRendererID);
+			AttachAll(m_RendererID, m_ColorRenderbuffers, m_DepthRenderbuffer, depthAttachment, true);
+			AttachAll(m_ResolveRendererID, m_ColorAttachments, m_DepthAttachment, depthAttachment, false);
+			CheckStatus(m_ResolveRendererID);
+		} else {
+			AttachAll(m_RendererID, m_ColorAttachments, m_DepthAttachment, depthAttachment, false);
+		}
+		CheckStatus(m_RendererID);
+		return;
+	}
+
+	GLint previous = 0;
+	glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous);
+	if (IsMultisampled()) {
+		glGenFramebuffers(1, &m_ResolveRendererID);
+		glBindFramebuffer(GL_FRAMEBUFFER, m_ResolveRendererID);
+		AttachAll(m_ResolveRendererID, m_ColorAttachments, m_DepthAttachment, depthAttachment, false);
+		CheckStatus(m_ResolveRendererID);
+	}
+	glGenFramebuffers(1, &m_RendererID);
+	glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+	if (IsMultisampled()) {
+		AttachAll(m_RendererID, m_ColorRenderbuffers, m_DepthRenderbuffer, depthAttachment, true);
+	} else {
+		AttachAll(m_RendererID, m_ColorAttachments, m_DepthAttachment, depthAttachment, false);
+	}
+	CheckStatus(m_RendererID);
+	glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previous));
+}
+
+void OpenGLFramebuffer::Bind() {
+	glBindFramebuffer(GL_FRAMEBUFFER, m_RendererID);
+	glViewport(0, 0, static_cast<GLsizei>(m_Specification.Width), static_cast<GLsizei>(m_Specification.Height));
+	RendererStatistics::Current().FramebufferBinds++;
+}
+
+void OpenGLFramebuffer::Unbind() {
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	RendererStatistics::Current().FramebufferBinds++;
+}
+
+void OpenGLFramebuffer::Resize(uint32_t width, uint32_t height) {
+	if (width == 0 || height == 0 || width > MaxSize || height > MaxSize) {
+		LOG_WARN_ENGINE("Attempted to resize framebuffer to {0}, {1}", width, height);
+		return;
+	}
+	if (width == m_Specification.Width && height == m_Specification.Height) {
+		return;
+	}
+	m_Specification.Width = width;
+	m_Specification.Height = height;
+	Invalidate();
+}
+
+void OpenGLFramebuffer::Resolve() {
+	if (!IsMultisampled()) {
+		return;
+	}
+	const GLint width = static_cast<GLint>(m_Specification.Width);
+	const GLint height = static_cast<GLint>(m_Specification.Height);
+	const GLbitfield depthMask = m_DepthSpecification.Format == FramebufferTextureFormat::Depth24Stencil8
+		? GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT : GL_DEPTH_BUFFER_BIT;
+	// 颜色附件逐个解析；整数与深度附件只能用 GL_NEAREST（取其中一个样本）
+	if (OpenGLContext::GetCapabilities().DirectStateAccess) {
+		for (size_t i = 0; i < m_ColorAttachments.size(); ++i) {
+			const GLenum attachment = GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i);
+			glNamedFramebufferReadBuffer(m_RendererID, attachment);
+			glNamedFramebufferDrawBuffer(m_ResolveRendererID, attachment);
+			glBlitNamedFramebuffer(m_RendererID, m_ResolveRendererID, 0, 0, width, height, 0, 0, width, height,
+				GL_COLOR_BUFFER_BIT, GL_NEAREST);
+		}
+		if (m_DepthAttachment) {
+			glBlitNamedFramebuffer(m_RendererID, m_ResolveRendererID, 0, 0, width, height, 0, 0, width, height,
+				depthMask, GL_NEAREST);
+		}
+		return;
+	}
+	GLint previousRead = 0, previousDraw = 0;
+	glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousRead);
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previousDraw);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, m_RendererID);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_ResolveRendererID);
+	for (size_t i = 0; i < m_ColorAttachments.size(); ++i) {
+		const GLenum attachment = GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i);
+		glReadBuffer(attachment);
+		glDrawBuffer(attachment);
+		glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+	}
+	if (m_DepthAttachment) {
+		glBlitFramebuffer(0, 0, width, height, 0, 0, width, height, depthMask, GL_NEAREST);
+	}
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(previousRead));
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, static_cast<GLuint>(previousDraw));
+}
+
+void OpenGLFramebuffer::ClearAttachment(uint32_t attachmentIndex, const Vec4& value) {
+	ASSERT_ENGINE(attachmentIndex < m_ColorAttachments.size(), "Framebuffer attachment index out of range!");
+	const GLfloat color[4] = { value.r, value.g, value.b, value.a };
+	if (OpenGLContext::GetCapabilities().DirectStateAccess) {
+		glClearNamedFramebufferfv(m_RendererID, GL_COLOR, static_cast<GLint>(attachmentIndex), color);
+		return;
+	}
+	GLint previous = 0;
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previous);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_RendererID);
+	glClearBufferfv(GL_COLOR, static_cast<GLint>(attachmentIndex), color);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, static_cast<GLuint>(previous));
+}
+
+void OpenGLFramebuffer::ClearAttachment(uint32_t attachmentIndex, int value) {
+	ASSERT_ENGINE(attachmentIndex < m_ColorAttachments.size(), "Framebuffer attachment index out of range!");
+	const GLint values[4] = { value, value, value, value };
+	if (OpenGLContext::GetCapabilities().DirectStateAccess) {
+		glClearNamedFramebufferiv(m_RendererID, GL_COLOR, static_cast<GLint>(attachmentIndex), values);
+		return;
+	}
+	GLint previous = 0;
+	glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &previous);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_RendererID);
+	glClearBufferiv(GL_COLOR, static_cast<GLint>(attachmentIndex), values);
+	glBindFramebuffer(GL_DRAW_FRAMEBUFFER, static_cast<GLuint>(previous));
+}
+
+void OpenGLFramebuffer::BindColorAttachment(uint32_t attachmentIndex, uint32_t slot) const {
+	const uint32_t texture = GetColorAttachmentRendererID(attachmentIndex);
+	if (OpenGLContext::GetCapabilities().DirectStateAccess) {
+		glBindTextureUnit(slot, texture);
+	} else {
+		glActiveTexture(GL_TEXTURE0 + slot);
+		glBindTexture(GL_TEXTURE_2D, texture);
+	}
+	RendererStatistics::Current().TextureBinds++;
+	// 其他纹理可能在该单元上留下了采样器对象，它会覆盖附件纹理自身的参数
+	glBindSampler(slot, 0);
+}
+
+uint32_t OpenGLFramebuffer::GetColorAttachmentRendererID(uint32_t attachmentIndex) const {
+	ASSERT_ENGINE(attachmentIndex < m_ColorAttachments.size(), "Framebuffer attachment index out of range!");
+	return m_ColorAttachments[attachmentIndex];
+}
+}
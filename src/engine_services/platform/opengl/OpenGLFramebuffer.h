@@ -0,0 +1,58 @@
+#pragma once
+#include "engine_services/renderer/Framebuffer.h"
+
+// ---------------------------------------------------------------------
+// 类: OpenGLFramebuffer
+// 作用: OpenGL 帧缓冲实现
+// 描述: 每个附件都有一张不可变存储的单采样纹理，纹理参数（过滤、ClampToEdge）直接设在纹理上，
+//       绑定为纹理时解除该单元上的采样器对象。Samples > 1 时另建一个帧缓冲，
+//       附件为多重采样渲染缓冲 (glRenderbufferStorageMultisample)，Resolve 用 glBlitFramebuffer
+//       逐个附件解析到纹理所在的帧缓冲。GL 4.5 下使用 DSA，否则绑定后编辑并在结束后恢复原来的绑定。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class OpenGLFramebuffer : public Framebuffer {
+public:
+	OpenGLFramebuffer(const FramebufferSpecification& specification);
+	virtual ~OpenGLFramebuffer();
+
+	virtual void Bind() override;
+	virtual void Unbind() override;
+
+	virtual void Resize(uint32_t width, uint32_t height) override;
+	virtual void Resolve() override;
+
+	virtual void ClearAttachment(uint32_t attachmentIndex, const Vec4& value) override;
+	virtual void ClearAttachment(uint32_t attachmentIndex, int value) override;
+
+	virtual void BindColorAttachment(uint32_t attachmentIndex, uint32_t slot) const override;
+	virtual uint32_t GetColorAttachmentRendererID(uint32_t attachmentIndex = 0) const override;
+	virtual uint32_t GetDepthAttachmentRendererID() const override { return m_DepthAttachment; }
+	virtual uint32_t GetColorAttachmentCount() const override { return static_cast<uint32_t>(m_ColorAttachments.size()); }
+
+	virtual const FramebufferSpecification& GetSpecification() const override { return m_Specification; }
+
+	// 渲染目标的帧缓冲对象：多重采样时为多重采样帧缓冲，否则即纹理所在的帧缓冲
+	inline uint32_t GetRendererID() const { return m_RendererID; }
+	// 解析后（可读取）的帧缓冲对象
+	inline uint32_t GetResolvedRendererID() const { return m_ResolveRendererID ? m_ResolveRendererID : m_RendererID; }
+private:
+	// 按当前规格重新创建所有对象
+	void Invalidate();
+	void Release();
+	inline bool IsMultisampled() const { return m_Samples > 1; }
+private:
+	FramebufferSpecification m_Specification;
+	std::vector<FramebufferAttachmentSpecification> m_ColorSpecifications;
+	FramebufferAttachmentSpecification m_DepthSpecification;
+	uint32_t m_Samples = 1;          // 按 GL_MAX_SAMPLES 限制后的实际采样数
+
+	uint32_t m_RendererID = 0;
+	uint32_t m_ResolveRendererID = 0;
+	std::vector<uint32_t> m_ColorAttachments; // 单采样纹理
+	uint32_t m_DepthAttachment = 0;
+	std::vector<uint32_t> m_ColorRenderbuffers; // 多重采样渲染缓冲
+	uint32_t m_DepthRenderbuffer = 0;
+};
+}
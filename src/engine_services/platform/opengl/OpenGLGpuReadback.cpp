@@ -0,0 +1,254 @@
+#include "OpenGLGpuReadback.h"
+#include "OpenGLContext.h"
+#include "OpenGLDeletionQueue.h"
+#include "OpenGLFramebuffer.h"
+#include "engine_services/renderer/RenderThread.h"
+#include "core/Log.h"
+#include <glad/glad.h>
+#include <algorithm>
+
+namespace GE {
+
+struct ReadbackFormat {
+	GLenum Format;
+	GLenum Type;
+	uint32_t PixelSize;
+};
+
+static bool ReadbackFormatFromAttachment(FramebufferTextureFormat format, ReadbackFormat& result) {
+	switch (format) {
+		case FramebufferTextureFormat::RGBA8:      result = { GL_RGBA, GL_UNSIGNED_BYTE, 4 }; return true;
+		case FramebufferTextureFormat::RGBA16F:    result = { GL_RGBA, GL_HALF_FLOAT, 8 }; return true;
+		case FramebufferTextureFormat::RGBA32F:    result = { GL_RGBA, GL_FLOAT, 16 }; return true;
+		case FramebufferTextureFormat::RedInteger: result = { GL_RED_INTEGER, GL_INT, 4 }; return true;
+		default: break;
+	}
+	return false;
+}
+
+// 第 colorIndex 个颜色附件的格式（规格中深度附件可以出现在任意位置）
+static FramebufferTextureFormat GetColorAttachmentFormat(const FramebufferSpecification& specification, uint32_t colorIndex) {
+	for (const FramebufferAttachmentSpecification& attachment : specification.Attachments) {
+		if (attachment.Format == FramebufferTextureFormat::None || IsDepthFormat(attachment.Format)) {
+			continue;
+		}
+		if (colorIndex-- == 0) {
+			return attachment.Format;
+		}
+	}
+	return FramebufferTextureFormat::None;
+}
+
+// 把区域截断到 [0, limitWidth) x [0, limitHeight)，区域为空时返回 false
+static bool ClampRegion(uint32_t limitWidth, uint32_t limitHeight, uint32_t x, uint32_t y, uint32_t& width, uint32_t& height) {
+	if (x >= limitWidth || y >= limitHeight) {
+		return false;
+	}
+	width = std::min(width, limitWidth - x);
+	height = std::min(height, limitHeight - y);
+	return width > 0 && height > 0;
+}
+
+OpenGLGpuReadback::~OpenGLGpuReadback() {
+	for (Slot& slot : m_Slots) {
+		if (slot.Fence) {
+			glDeleteSync(slot.Fence);
+		}
+		if (slot.MappedData) {
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.BufferID);
+			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		}
+		OpenGLDeletionQueue::Enqueue(GLObjectType::Buffer, slot.BufferID);
+	}
+}
+
+uint32_t OpenGLGpuReadback::AcquireSlot(uint32_t width, uint32_t height, uint32_t pixelSize) {
+	for (uint32_t i = 0; i < MaxReadbacks; ++i) {
+		Slot& slot = m_Slots[i];
+		if (slot.State.load(std::memory_order_acquire) != SlotState::Free) {
+			continue;
+		}
+		slot.Width = width;
+		slot.Height = height;
+		slot.PixelSize = pixelSize;
+		slot.Size = static_cast<uint64_t>(width) * height * pixelSize;
+		slot.State.store(SlotState::Pending, std::memory_order_release);
+		return i;
+	}
+	LOG_WARN_ENGINE("GpuReadback: all {0} readback slots are in use, request dropped", MaxReadbacks);
+	return MaxReadbacks;
+}
+
+const OpenGLGpuReadback::Slot* OpenGLGpuReadback::GetSlot(ReadbackHandle handle) const {
+	if (handle == 0 || handle > MaxReadbacks) {
+		return nullptr;
+	}
+	return &m_Slots[handle - 1];
+}
+
+void OpenGLGpuReadback::EnsureCapacity(Slot& slot, uint64_t size) {
+	if (slot.Capacity >= size) {
+		return;
+	}
+	if (slot.BufferID) {
+		if (slot.MappedData) {
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.BufferID);
+			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+			slot.MappedData = nullptr;
+		}
+		OpenGLDeletionQueue::Enqueue(GLObjectType::Buffer, slot.BufferID);
+	}
+	glGenBuffers(1, &slot.BufferID);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.BufferID);
+	slot.Capacity = size;
+	slot.Persistent = false;
+	if (OpenGLContext::GetCapabilities().BufferStorage) {
+		// 读回的数据由 CPU 读取，CLIENT_STORAGE 提示驱动把存储放在系统内存中
+		const GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, flags | GL_CLIENT_STORAGE_BIT);
+		slot.MappedData = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(size), flags);
+		slot.Persistent = slot.MappedData != nullptr;
+	}
+	if (!slot.Persistent) {
+		if (OpenGLContext::GetCapabilities().BufferStorage) {
+			// 不可变存储映射失败，换一个普通的缓冲对象
+			glDeleteBuffers(1, &slot.BufferID);
+			glGenBuffers(1, &slot.BufferID);
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.BufferID);
+		}
+		glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_READ);
+	}
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+void OpenGLGpuReadback::IssueRead(Slot& slot, uint32_t framebuffer, uint32_t readBuffer, uint32_t x, uint32_t y,
+	uint32_t format, uint32_t type) {
+	EnsureCapacity(slot, slot.Size);
+	GLint previousFramebuffer = 0;
+	glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousFramebuffer);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+	glReadBuffer(readBuffer);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.BufferID);
+	// 行之间不留对齐填充
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	// 目标是 PBO，glReadPixels 只录制拷贝，不等待 GPU
+	glReadPixels(static_cast<GLint>(x), static_cast<GLint>(y), static_cast<GLsizei>(slot.Width), static_cast<GLsizei>(slot.Height),
+		format, type, nullptr);
+	glPixelStorei(GL_PACK_ALIGNMENT, 4);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, static_cast<GLuint>(previousFramebuffer));
+	slot.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+ReadbackHandle OpenGLGpuReadback::ReadColorAttachment(const Ref<Framebuffer>& framebuffer, uint32_t attachmentIndex,
+	uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+	const FramebufferSpecification& specification = framebuffer->GetSpecification();
+	ReadbackFormat format;
+	if (!ReadbackFormatFromAttachment(GetColorAttachmentFormat(specification, attachmentIndex), format)) {
+		LOG_ERROR_ENGINE("GpuReadback: color attachment {0} cannot be read back", attachmentIndex);
+		return 0;
+	}
+	if (!ClampRegion(specification.Width, specification.Height, x, y, width, height)) {
+		return 0;
+	}
+	const uint32_t index = AcquireSlot(width, height, format.PixelSize);
+	if (index == MaxReadbacks) {
+		return 0;
+	}
+	RenderThread::Submit([this, index, framebuffer, attachmentIndex, x, y, format]() {
+		// 对象 ID 在执行时读取，期间的 Resize 不影响
+		const uint32_t readFramebuffer = static_cast<const OpenGLFramebuffer&>(*framebuffer).GetResolvedRendererID();
+		IssueRead(m_Slots[index], readFramebuffer, GL_COLOR_ATTACHMENT0 + attachmentIndex, x, y, format.Format, format.Type);
+	});
+	return index + 1;
+}
+
+ReadbackHandle OpenGLGpuReadback::ReadBackbuffer(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+	if (width == 0 || height == 0) {
+		return 0;
+	}
+	const uint32_t index = AcquireSlot(width, height, 4);
+	if (index == MaxReadbacks) {
+		return 0;
+	}
+	RenderThread::Submit([this, index, x, y]() {
+		IssueRead(m_Slots[index], 0, GL_BACK, x, y, GL_RGBA, GL_UNSIGNED_BYTE);
+	});
+	return index + 1;
+}
+
+void OpenGLGpuReadback::Update() {
+	RenderThread::Submit([this]() {
+		for (Slot& slot : m_Slots) {
+			if (!slot.Fence) {
+				continue;
+			}
+			const GLenum result = glClientWaitSync(slot.Fence, 0, 0);
+			if (result != GL_ALREADY_SIGNALED && result != GL_CONDITION_SATISFIED) {
+				continue;
+			}
+			glDeleteSync(slot.Fence);
+			slot.Fence = nullptr;
+			if (!slot.Persistent) {
+				glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.BufferID);
+				slot.MappedData = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(slot.Size), GL_MAP_READ_BIT);
+				glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+			}
+			// 主线程释放后状态为 Releasing，不再改回 Ready
+			SlotState expected = SlotState::Pending;
+			slot.State.compare_exchange_strong(expected, SlotState::Ready, std::memory_order_release);
+		}
+	});
+}
+
+ReadbackStatus OpenGLGpuReadback::GetStatus(ReadbackHandle handle) const {
+	const Slot* slot = GetSlot(handle);
+	if (!slot) {
+		return ReadbackStatus::Invalid;
+	}
+	switch (slot->State.load(std::memory_order_acquire)) {
+		case SlotState::Pending: return ReadbackStatus::Pending;
+		case SlotState::Ready:   return ReadbackStatus::Ready;
+		default:                 return ReadbackStatus::Invalid;
+	}
+}
+
+BufferView OpenGLGpuReadback::GetData(ReadbackHandle handle) const {
+	const Slot* slot = GetSlot(handle);
+	if (!slot || slot->State.load(std::memory_order_acquire) != SlotState::Ready) {
+		return {};
+	}
+	return BufferView(slot->MappedData, slot->Size);
+}
+
+void OpenGLGpuReadback::GetSize(ReadbackHandle handle, uint32_t& width, uint32_t& height, uint32_t& pixelSize) const {
+	const Slot* slot = GetSlot(handle);
+	width = slot ? slot->Width : 0;
+	height = slot ? slot->Height : 0;
+	pixelSize = slot ? slot->PixelSize : 0;
+}
+
+void OpenGLGpuReadback::Release(ReadbackHandle handle) {
+	if (GetStatus(handle) == ReadbackStatus::Invalid) {
+		return;
+	}
+	const uint32_t index = handle - 1;
+	m_Slots[index].State.store(SlotState::Releasing, std::memory_order_release);
+	RenderThread::Submit([this, index]() {
+		Slot& slot = m_Slots[index];
+		// 尚未完成的读取不必等待：之后复用这个缓冲的读取排在它后面
+		if (slot.Fence) {
+			glDeleteSync(slot.Fence);
+			slot.Fence = nullptr;
+		}
+		if (slot.MappedData && !slot.Persistent) {
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.BufferID);
+			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+			slot.MappedData = nullptr;
+		}
+		slot.State.store(SlotState::Free, std::memory_order_release);
+	});
+}
+}
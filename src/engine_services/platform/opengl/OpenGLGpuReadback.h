@@ -0,0 +1,66 @@
+#pragma once
+#include "engine_services/renderer/GpuReadback.h"
+#include <atomic>
+
+typedef struct __GLsync* GLsync;
+
+// ---------------------------------------------------------------------
+// 类: OpenGLGpuReadback
+// 作用: 基于 PBO 与栅栏的异步读回
+// 描述: 每个槽位一个 GL_PIXEL_PACK_BUFFER，容量按需增长。glReadPixels 写入 PBO 时立即返回，
+//       随后插入 glFenceSync；Update 零超时轮询栅栏，触发后映射缓冲。
+//       GL 4.4 下使用持久映射（创建时映射一次，之后不再映射/解除映射），否则触发后 glMapBufferRange，
+//       Release 时解除映射。槽位状态是原子的：主线程分配与释放，渲染线程推进到 Ready。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class OpenGLGpuReadback : public GpuReadback {
+public:
+	OpenGLGpuReadback() = default;
+	virtual ~OpenGLGpuReadback();
+
+	virtual ReadbackHandle ReadColorAttachment(const Ref<Framebuffer>& framebuffer, uint32_t attachmentIndex,
+		uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+	virtual ReadbackHandle ReadBackbuffer(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+
+	virtual void Update() override;
+
+	virtual ReadbackStatus GetStatus(ReadbackHandle handle) const override;
+	virtual BufferView GetData(ReadbackHandle handle) const override;
+	virtual void GetSize(ReadbackHandle handle, uint32_t& width, uint32_t& height, uint32_t& pixelSize) const override;
+	virtual void Release(ReadbackHandle handle) override;
+private:
+	enum class SlotState : uint8_t {
+		Free = 0,
+		Pending,   // 读取命令已录制，等待栅栏
+		Ready,     // 已映射，可读
+		Releasing  // 主线程已释放，等待渲染线程回收
+	};
+	struct Slot {
+		std::atomic<SlotState> State{ SlotState::Free };
+		// 分配时在主线程上写入
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t PixelSize = 0;
+		uint64_t Size = 0;
+		// 以下只在渲染线程上写入
+		uint32_t BufferID = 0;
+		uint64_t Capacity = 0;
+		bool Persistent = false;
+		void* MappedData = nullptr;
+		GLsync Fence = nullptr;
+	};
+
+	// 分配一个空闲槽位并记录区域，返回下标；没有空闲槽位时返回 MaxReadbacks
+	uint32_t AcquireSlot(uint32_t width, uint32_t height, uint32_t pixelSize);
+	const Slot* GetSlot(ReadbackHandle handle) const;
+	// 渲染线程：确保槽位的 PBO 至少有 size 字节
+	void EnsureCapacity(Slot& slot, uint64_t size);
+	// 渲染线程：从 framebuffer 的 readBuffer 读取到槽位的 PBO 并插入栅栏
+	void IssueRead(Slot& slot, uint32_t framebuffer, uint32_t readBuffer, uint32_t x, uint32_t y,
+		uint32_t format, uint32_t type);
+private:
+	Slot m_Slots[MaxReadbacks];
+};
+}
@@ -0,0 +1,96 @@
+#include "OpenGLGpuTimer.h"
+#include <glad/glad.h>
+#include <algorithm>
+
+namespace GE {
+
+OpenGLGpuTimer::OpenGLGpuTimer() {
+	glGenQueries(QueryLatency * 2, m_Queries);
+}
+
+OpenGLGpuTimer::~OpenGLGpuTimer() {
+	glDeleteQueries(QueryLatency * 2, m_Queries);
+}
+
+void OpenGLGpuTimer::Begin() {
+	Poll();
+	// 槽位的结果仍未读出说明 GPU 落后太多，跳过本次测量而不是等待
+	m_Active = !m_Pending[m_Slot];
+	if (m_Active) {
+		glQueryCounter(m_Queries[m_Slot * 2], GL_TIMESTAMP);
+	}
+}
+
+void OpenGLGpuTimer::End() {
+	if (!m_Active) {
+		return;
+	}
+	glQueryCounter(m_Queries[m_Slot * 2 + 1], GL_TIMESTAMP);
+	m_Pending[m_Slot] = true;
+	m_Slot = (m_Slot + 1) % QueryLatency;
+	m_Active = false;
+}
+
+void OpenGLGpuTimer::Poll() {
+	// m_Slot 之后的槽位是最早提交的
+	for (uint32_t i = 0; i < QueryLatency; ++i) {
+		const uint32_t slot = (m_Slot + i) % QueryLatency;
+		if (!m_Pending[slot]) {
+			continue;
+		}
+		GLint available = 0;
+		glGetQueryObjectiv(m_Queries[slot * 2 + 1], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available) {
+			break;
+		}
+		GLuint64 begin = 0, end = 0;
+		glGetQueryObjectui64v(m_Queries[slot * 2], GL_QUERY_RESULT, &begin);
+		glGetQueryObjectui64v(m_Queries[slot * 2 + 1], GL_QUERY_RESULT, &end);
+		m_Milliseconds = static_cast<float>(static_cast<double>(end - begin) / 1000000.0);
+		m_HasResult = true;
+		m_Pending[slot] = false;
+	}
+}
+
+OpenGLGpuTimestampPool::OpenGLGpuTimestampPool(uint32_t batchCount)
+	: m_Queries(batchCount) {
+}
+
+OpenGLGpuTimestampPool::~OpenGLGpuTimestampPool() {
+	for (const std::vector<uint32_t>& queries : m_Queries) {
+		if (!queries.empty()) {
+			glDeleteQueries(static_cast<GLsizei>(queries.size()), queries.data());
+		}
+	}
+}
+
+void OpenGLGpuTimestampPool::Write(uint32_t batch, uint32_t index) {
+	std::vector<uint32_t>& queries = m_Queries[batch];
+	if (index >= queries.size()) {
+		// 每次至少翻倍，作用域数量稳定后不再生成新查询
+		const size_t oldSize = queries.size();
+		const size_t newSize = std::max<size_t>(index + 1, std::max<size_t>(oldSize * 2, 32));
+		queries.resize(newSize);
+		glGenQueries(static_cast<GLsizei>(newSize - oldSize), queries.data() + oldSize);
+	}
+	glQueryCounter(queries[index], GL_TIMESTAMP);
+}
+
+bool OpenGLGpuTimestampPool::IsAvailable(uint32_t batch, uint32_t count) const {
+	if (count == 0) {
+		return true;
+	}
+	GLint available = 0;
+	glGetQueryObjectiv(m_Queries[batch][count - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+	return available != 0;
+}
+
+void OpenGLGpuTimestampPool::Read(uint32_t batch, uint32_t count, uint64_t* nanoseconds) const {
+	const std::vector<uint32_t>& queries = m_Queries[batch];
+	for (uint32_t i = 0; i < count; ++i) {
+		GLuint64 value = 0;
+		glGetQueryObjectui64v(queries[i], GL_QUERY_RESULT, &value);
+		nanoseconds[i] = value;
+	}
+}
+}
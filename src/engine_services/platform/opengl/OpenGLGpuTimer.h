@@ -0,0 +1,59 @@
+#pragma once
+#include "engine_services/renderer/GpuTimer.h"
+#include "engine_services/renderer/GpuProfiler.h"
+#include <atomic>
+#include <vector>
+
+// ---------------------------------------------------------------------
+// 类: OpenGLGpuTimer
+// 作用: 基于时间戳查询 (glQueryCounter GL_TIMESTAMP) 的 GPU 计时器
+// 描述: 使用时间戳而不是 GL_TIME_ELAPSED，多个计时器的区间可以嵌套或交叠。
+//       查询成对放在 QueryLatency 个槽位的环中，GPU 落后超过 QueryLatency 帧时跳过本次测量。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class OpenGLGpuTimer : public GpuTimer {
+public:
+	// GPU 通常落后 CPU 1~3 帧
+	static constexpr uint32_t QueryLatency = 4;
+
+	OpenGLGpuTimer();
+	virtual ~OpenGLGpuTimer();
+
+	virtual void Begin() override;
+	virtual void End() override;
+
+	virtual float GetMilliseconds() const override { return m_Milliseconds; }
+	virtual bool HasResult() const override { return m_HasResult; }
+private:
+	// 按提交顺序读取已完成的槽位；在 Begin 中调用，复用槽位前先取出它的结果
+	void Poll();
+private:
+	uint32_t m_Queries[QueryLatency * 2] = {}; // 每个槽位一对：开始、结束
+	bool m_Pending[QueryLatency] = {};
+	uint32_t m_Slot = 0;
+	bool m_Active = false;   // 本次 Begin 写入了查询
+	// 在渲染线程上写入，可以在其他线程上读取
+	std::atomic<float> m_Milliseconds{ 0.0f };
+	std::atomic<bool> m_HasResult{ false };
+};
+
+// ---------------------------------------------------------------------
+// 类: OpenGLGpuTimestampPool
+// 作用: GpuProfiler 使用的时间戳查询池
+// 描述: 每个批次一组 GL_TIMESTAMP 查询，写入超出现有数量时按需再生成。
+//       时间戳按提交顺序完成，批次的最后一个可读即全部可读。
+// ---------------------------------------------------------------------
+class OpenGLGpuTimestampPool : public GpuTimestampPool {
+public:
+	OpenGLGpuTimestampPool(uint32_t batchCount);
+	virtual ~OpenGLGpuTimestampPool();
+
+	virtual void Write(uint32_t batch, uint32_t index) override;
+	virtual bool IsAvailable(uint32_t batch, uint32_t count) const override;
+	virtual void Read(uint32_t batch, uint32_t count, uint64_t* nanoseconds) const override;
+private:
+	std::vector<std::vector<uint32_t>> m_Queries;
+};
+}
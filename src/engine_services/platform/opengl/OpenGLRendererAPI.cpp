@@ -1,4 +1,10 @@
 #include "engine_services/platform/opengl/OpenGLRendererAPI.h"
+#include "engine_services/platform/opengl/OpenGLBuffer.h"
+#include "engine_services/platform/opengl/OpenGLContext.h"
+#include "engine_services/platform/opengl/OpenGLDeletionQueue.h"
+#include "engine_services/platform/opengl/OpenGLTexture.h"
+#include "engine_services/platform/opengl/OpenGLVertexArray.h"
+#include "engine_services/renderer/RendererStatistics.h"
 
 #include <glad/glad.h>
 
@@ -8,6 +14,18 @@
 // ---------------------------------------------------------------------
 namespace GE {
 
+static inline void CountDraw(uint32_t vertexCount) {
+	RendererFrameStatistics& stats = RendererStatistics::Current();
+	stats.DrawCalls++;
+	stats.Vertices += vertexCount;
+	stats.Triangles += vertexCount / 3;
+}
+
+// 流式顶点缓冲在 Bind 之后可能又写到了新的位置
+static inline void UpdateStreamingOffsets(const Ref<VertexArray>& vertexArray) {
+	static_cast<const OpenGLVertexArray&>(*vertexArray).UpdateStreamingOffsets();
+}
+
 void OpenGLRendererAPI::Init() {
 	// 开启混合模式 (Alpha Blending)
 	glEnable(GL_BLEND);
@@ -17,8 +35,15 @@ void OpenGLRendererAPI::Init() {
 	// glEnable(GL_DEPTH_TEST); // 暂时禁用深度测试以调试三角形绘制
 }
 
+void OpenGLRendererAPI::Shutdown() {
+	// 纹理模块持有的 GL 对象
+	OpenGLTexture2D::Shutdown();
+	// 删除队列中尚未到期的对象
+	OpenGLDeletionQueue::Flush();
+}
+
 void OpenGLRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
-	glViewport(x, y, width, height);
+	glViewport(static_cast<GLint>(x), static_cast<GLint>(y), static_cast<GLsizei>(width), static_cast<GLsizei>(height));
 }
 
 void OpenGLRendererAPI::SetClearColor(const Vec4& color) {
@@ -31,9 +56,11 @@ void OpenGLRendererAPI::Clear() {
 }
 
 void OpenGLRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount) {
+	UpdateStreamingOffsets(vertexArray);
 	if (vertexArray->GetIndexBuffer()) {
 		uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
-		glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+		glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(count), GL_UNSIGNED_INT, nullptr);
+		CountDraw(count);
 	} else {
 		// 如果没有索引缓冲区，使用顶点缓冲区的大小计算顶点数量
 		const auto& vertexBuffers = vertexArray->GetVertexBuffers();
@@ -42,8 +69,80 @@ void OpenGLRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_
 			const auto& layout = buffer->GetLayout();
 			uint32_t vertexCount = buffer->GetSize() / layout.GetStride();
 			uint32_t count = indexCount ? indexCount : vertexCount;
-			glDrawArrays(GL_TRIANGLES, 0, count);
+			glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(count));
+			CountDraw(count);
 		}
 	}
 }
+
+void OpenGLRendererAPI::DrawArrays(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex) {
+	// 全屏三角形等调用方不会自己绑定顶点数组（可能只是空 VAO）
+	vertexArray->Bind();
+	glDrawArrays(GL_TRIANGLES, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount));
+	CountDraw(vertexCount);
+}
+
+void OpenGLRendererAPI::DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t firstIndex, int32_t baseVertex) {
+	ASSERT_ENGINE(vertexArray->GetIndexBuffer(), "Base vertex draw requires an index buffer!");
+	UpdateStreamingOffsets(vertexArray);
+	const void* indices = reinterpret_cast<const void*>(static_cast<uintptr_t>(firstIndex) * sizeof(uint32_t));
+	glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, indices, baseVertex);
+	CountDraw(indexCount);
+}
+
+void OpenGLRendererAPI::DrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<IndirectBuffer>& indirectBuffer,
+	uint32_t drawCount, uint32_t firstCommand) {
+	ASSERT_ENGINE(vertexArray->GetIndexBuffer(), "Indirect indexed draw requires an index buffer!");
+	ASSERT_ENGINE(firstCommand + drawCount <= indirectBuffer->GetCapacity(), "Indirect draw range exceeds buffer capacity!");
+	UpdateStreamingOffsets(vertexArray);
+	if (OpenGLContext::GetCapabilities().MultiDrawIndirect) {
+		indirectBuffer->Bind();
+		const void* offset = reinterpret_cast<const void*>(static_cast<uintptr_t>(firstCommand) * sizeof(DrawElementsIndirectCommand));
+		glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, offset, static_cast<GLsizei>(drawCount), 0);
+		RendererFrameStatistics& stats = RendererStatistics::Current();
+		stats.DrawCalls++;
+		stats.IndirectCommands += drawCount;
+		return;
+	}
+	// GL 3.3 回退路径：按 CPU 端副本逐条绘制（此时着色器无法使用 gl_DrawID）。
+	// BaseInstance 需要 GL 4.2，更低的版本上逐实例属性总是从第 0 个实例开始读取
+	const bool baseInstance = OpenGLContext::GetCapabilities().BaseInstance;
+	const auto& commands = static_cast<const OpenGLIndirectBuffer&>(*indirectBuffer).GetShadowCommands();
+	for (uint32_t i = firstCommand; i < firstCommand + drawCount; ++i) {
+		const DrawElementsIndirectCommand& command = commands[i];
+		const void* indices = reinterpret_cast<const void*>(static_cast<uintptr_t>(command.FirstIndex) * sizeof(uint32_t));
+		const GLsizei count = static_cast<GLsizei>(command.Count);
+		const GLsizei instanceCount = static_cast<GLsizei>(command.InstanceCount);
+		if (baseInstance) {
+			glDrawElementsInstancedBaseVertexBaseInstance(GL_TRIANGLES, count, GL_UNSIGNED_INT, indices,
+				instanceCount, command.BaseVertex, command.BaseInstance);
+		} else {
+			ASSERT_ENGINE(command.BaseInstance == 0, "BaseInstance requires OpenGL 4.2!");
+			glDrawElementsInstancedBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_INT, indices, instanceCount, command.BaseVertex);
+		}
+		CountDraw(command.Count * command.InstanceCount);
+	}
+}
+
+void OpenGLRendererAPI::PushDebugGroup(const char* name) {
+	// GL 4.3 以下没有调试分组，标记只是辅助信息，直接忽略
+	if (OpenGLContext::GetCapabilities().DebugGroups) {
+		glPushDebugGroup(GL_DEBUG_SOURCE_APPLICATION, 0, -1, name);
+	}
+}
+
+void OpenGLRendererAPI::PopDebugGroup() {
+	if (OpenGLContext::GetCapabilities().DebugGroups) {
+		glPopDebugGroup();
+	}
+}
+
+void OpenGLRendererAPI::EndFrame() {
+	// 按每帧预算把排队的纹理数据写入 PBO 并提交
+	OpenGLTexture2D::ProcessUploads();
+	// 本帧析构的对象等 GPU 执行完本帧之后再删除
+	OpenGLDeletionQueue::EndFrame();
+	// 之后的流式缓冲写入进入下一段
+	OpenGLStreamingBuffer::EndFrame();
+}
 }
\ No newline at end of file
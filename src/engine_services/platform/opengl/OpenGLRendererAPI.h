@@ -5,9 +5,17 @@ namespace GE {
 class OpenGLRendererAPI : public RendererAPI {
 public:
 	virtual void Init() override;
+	virtual void Shutdown() override;
 	virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
 	virtual void SetClearColor(const Vec4& color) override;
 	virtual void Clear() override;
 	virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+	virtual void DrawArrays(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0) override;
+	virtual void DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t firstIndex, int32_t baseVertex) override;
+	virtual void DrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<IndirectBuffer>& indirectBuffer,
+		uint32_t drawCount, uint32_t firstCommand = 0) override;
+	virtual void PushDebugGroup(const char* name) override;
+	virtual void PopDebugGroup() override;
+	virtual void EndFrame() override;
 };
 }
@@ -2,6 +2,8 @@
 #include "core/FileSystem.h"
 #include "core/Core.h"
 #include "core/Log.h"
+#include "OpenGLDeletionQueue.h"
+#include "engine_services/renderer/RendererStatistics.h"
 #include <vector>
 #include <fstream>
 #include <glad/glad.h>
@@ -36,7 +38,7 @@ OpenGLShader::OpenGLShader(const std::string& name, const std::string& vertexSrc
 }
 
 OpenGLShader::~OpenGLShader() {
-	glDeleteProgram(m_RendererID);
+	OpenGLDeletionQueue::Enqueue(GLObjectType::Program, m_RendererID);
 }
 
 std::string OpenGLShader::ReadFile(const std::string& filepath) {
@@ -123,6 +125,7 @@ void OpenGLShader::Compile(const std::unordered_map<GLenum, std::string>& shader
 
 void OpenGLShader::Bind() const {
 	glUseProgram(m_RendererID);
+	RendererStatistics::Current().ShaderBinds++;
 }
 
 void OpenGLShader::Unbind() const {
@@ -137,6 +140,14 @@ void OpenGLShader::SetIntArray(const std::string& name, int* values, uint32_t co
 	UploadUniformIntArray(name, values, count);
 }
 
+void OpenGLShader::SetFloat(const std::string& name, float value) {
+	UploadUniformFloat(name, value);
+}
+
+void OpenGLShader::SetFloat2(const std::string& name, const Vec2& value) {
+	UploadUniformFloat2(name, value);
+}
+
 void OpenGLShader::SetFloat4(const std::string& name, const Vec4& value) {
 	UploadUniformFloat4(name, value);
 }
@@ -145,44 +156,55 @@ void OpenGLShader::SetMat4(const std::string& name, const Mat4& value) {
 	UploadUniformMat4(name, value);
 }
 
-void OpenGLShader::UploadUniformInt(const std::string& name, int value) {
+int OpenGLShader::GetUniformLocation(const std::string& name) const {
+	auto it = m_UniformLocationCache.find(name);
+	if (it != m_UniformLocationCache.end()) {
+		return it->second;
+	}
+	// 不存在的 Uniform（-1）同样缓存，glUniform* 会忽略它
 	GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+	m_UniformLocationCache.emplace(name, location);
+	return location;
+}
+
+void OpenGLShader::UploadUniformInt(const std::string& name, int value) {
+	GLint location = GetUniformLocation(name);
 	glUniform1i(location, value);
 }
 
 void OpenGLShader::UploadUniformIntArray(const std::string& name, int* values, uint32_t count) {
-	GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+	GLint location = GetUniformLocation(name);
 	glUniform1iv(location, count, values);
 }
 
 void OpenGLShader::UploadUniformFloat(const std::string& name, float value) {
-	GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+	GLint location = GetUniformLocation(name);
 	glUniform1f(location, value);
 }
 
 void OpenGLShader::UploadUniformFloat2(const std::string& name, const Vec2& value) {
-	GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+	GLint location = GetUniformLocation(name);
 	glUniform2f(location, value.x, value.y);
 }
 
 
 void OpenGLShader::UploadUniformFloat3(const std::string& name, const Vec3& value) {
-	GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+	GLint location = GetUniformLocation(name);
 	glUniform3f(location, value.x, value.y, value.z);
 }
 
 void OpenGLShader::UploadUniformFloat4(const std::string& name, const Vec4& value) {
-	GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+	GLint location = GetUniformLocation(name);
 	glUniform4f(location, value.x, value.y, value.z, value.w);
 }
 
 void OpenGLShader::UploadUniformMat3(const std::string& name, const Mat3& matrix) {
-	GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+	GLint location = GetUniformLocation(name);
 	glUniformMatrix3fv(location, 1, GL_FALSE, GE::ValuePtr(matrix));
 }
 
 void OpenGLShader::UploadUniformMat4(const std::string& name, const Mat4& matrix) {
-	GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+	GLint location = GetUniformLocation(name);
 	glUniformMatrix4fv(location, 1, GL_FALSE, GE::ValuePtr(matrix));
 }
 }
\ No newline at end of file
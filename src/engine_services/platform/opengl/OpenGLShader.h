@@ -17,6 +17,8 @@ public:
 	virtual void Unbind() const override;
 	virtual void SetInt(const std::string& name, int value) override;
 	virtual void SetIntArray(const std::string& name, int* values, uint32_t count) override;
+	virtual void SetFloat(const std::string& name, float value) override;
+	virtual void SetFloat2(const std::string& name, const Vec2& value) override;
 	virtual void SetFloat4(const std::string& name, const Vec4& value) override;
 	virtual void SetMat4(const std::string& name, const Mat4& value) override;
 	virtual const std::string& GetName() const override { return m_Name; }
@@ -34,8 +36,11 @@ private:
 	std::string ReadFile(const std::string& filepath);
 	std::unordered_map<GLenum, std::string> PreProcess(const std::string& source);
 	void Compile(const std::unordered_map<GLenum, std::string>& shaderSources);
+	// 首次查询后缓存 Uniform 位置，逐次绘制设置 Uniform 时不再调用 glGetUniformLocation
+	int GetUniformLocation(const std::string& name) const;
 private:
 	uint32_t m_RendererID;
 	std::string m_Name;
+	mutable std::unordered_map<std::string, int> m_UniformLocationCache;
 };
 }
\ No newline at end of file
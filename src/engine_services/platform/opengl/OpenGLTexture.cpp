@@ -0,0 +1,568 @@
+#include "OpenGLTexture.h"
+#include "OpenGLContext.h"
+#include "OpenGLDeletionQueue.h"
+#include "engine_services/renderer/RendererStatistics.h"
+#include "OpenGLExtensions.h"
+#include "core/ImageDecoder.h"
+#include "core/Log.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace GE {
+
+// ==================== 格式映射 ====================
+
+struct TextureFormatInfo {
+	GLenum InternalFormat;
+	GLenum DataFormat;
+	GLenum DataType;
+};
+
+static TextureFormatInfo ImageFormatToOpenGL(ImageFormat format) {
+	switch (format) {
+		case ImageFormat::R8:           return { GL_R8, GL_RED, GL_UNSIGNED_BYTE };
+		case ImageFormat::RG8:          return { GL_RG8, GL_RG, GL_UNSIGNED_BYTE };
+		case ImageFormat::RGB8:         return { GL_RGB8, GL_RGB, GL_UNSIGNED_BYTE };
+		case ImageFormat::RGBA8:        return { GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE };
+		case ImageFormat::SRGB8:        return { GL_SRGB8, GL_RGB, GL_UNSIGNED_BYTE };
+		case ImageFormat::SRGB8_Alpha8: return { GL_SRGB8_ALPHA8, GL_RGBA, GL_UNSIGNED_BYTE };
+		case ImageFormat::RGBA16F:      return { GL_RGBA16F, GL_RGBA, GL_HALF_FLOAT };
+		case ImageFormat::RGBA32F:      return { GL_RGBA32F, GL_RGBA, GL_FLOAT };
+		case ImageFormat::None:         break;
+	}
+	ASSERT_ENGINE(false, "Unknown ImageFormat!");
+	return { 0, 0, 0 };
+}
+
+// ==================== 上传队列 ====================
+
+// 每帧最多写入 PBO 的字节数；超出的上传顺延到后续帧，避免一次加载大量纹理时卡顿
+static constexpr uint32_t s_UploadRegionSize = 16 * 1024 * 1024;
+// 与流式顶点缓冲相同的三重缓冲：CPU 写第 N 段时 GPU 可能仍在读取前两段
+static constexpr uint32_t s_UploadRegionCount = 3;
+// PBO 偏移需满足像素数据类型的对齐
+static constexpr uint32_t s_UploadAlignment = 16;
+
+struct PendingTextureUpload {
+	OpenGLTextureBase* Texture;
+	OpenGLTextureRegion Region; // 目标区域，整层上传时为整层大小
+	Buffer Pixels;
+};
+
+struct TextureUploadRegion {
+	GLsync Fence = nullptr;
+	std::vector<OpenGLTextureBase*> Textures; // 本段内提交了上传的纹理（每次上传一项）
+};
+
+struct TextureUploaderData {
+	uint32_t PixelBufferID = 0;
+	uint8_t* MappedData = nullptr; // GL 4.4+ 持久映射；否则每帧孤立并重新映射
+	bool Persistent = false;
+	uint32_t Region = 0;
+	TextureUploadRegion Regions[s_UploadRegionCount];
+	std::mutex QueueMutex; // Queue 可由主线程追加，由渲染线程取出
+	std::deque<PendingTextureUpload> Queue;
+	std::vector<PendingTextureUpload> Batch;
+};
+static TextureUploaderData s_Uploader;
+
+// 这些对象都属于 GL 上下文，由 Shutdown 释放，不能留到静态析构时（上下文已经销毁）
+static Scope<OpenGLTexture2D> s_Placeholder;
+static Scope<OpenGLTexture2DArray> s_ArrayPlaceholder;
+static std::unordered_map<uint32_t, uint32_t> s_SamplerCache;
+
+static void InitUploader() {
+	if (OpenGLContext::GetCapabilities().BufferStorage) {
+		const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		const GLsizeiptr totalSize = static_cast<GLsizeiptr>(s_UploadRegionSize) * s_UploadRegionCount;
+		glGenBuffers(1, &s_Uploader.PixelBufferID);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, s_Uploader.PixelBufferID);
+		glBufferStorage(GL_PIXEL_UNPACK_BUFFER, totalSize, nullptr, flags);
+		s_Uploader.MappedData = static_cast<uint8_t*>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, totalSize, flags));
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		s_Uploader.Persistent = s_Uploader.MappedData != nullptr;
+		if (s_Uploader.Persistent) {
+			return;
+		}
+		LOG_WARN_ENGINE("Persistent pixel buffer mapping failed, falling back to buffer orphaning");
+		glDeleteBuffers(1, &s_Uploader.PixelBufferID);
+	}
+	glGenBuffers(1, &s_Uploader.PixelBufferID);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, s_Uploader.PixelBufferID);
+	glBufferData(GL_PIXEL_UNPACK_BUFFER, s_UploadRegionSize, nullptr, GL_STREAM_DRAW);
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+static bool WaitForFence(GLsync fence, bool block) {
+	GLbitfield waitFlags = 0;
+	GLuint64 timeout = 0;
+	while (true) {
+		GLenum result = glClientWaitSync(fence, waitFlags, timeout);
+		if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED) {
+			return true;
+		}
+		if (result == GL_WAIT_FAILED) {
+			LOG_ERROR_ENGINE("glClientWaitSync failed on texture upload region");
+			return true;
+		}
+		if (!block) {
+			return false;
+		}
+		waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+		timeout = 1000000; // 1 ms
+	}
+}
+
+// ==================== OpenGLTextureBase ====================
+
+OpenGLTextureBase::OpenGLTextureBase(uint32_t target, const TextureSpecification& specification, uint32_t layerCount)
+	: m_Specification(specification), m_Target(target), m_LayerCount(layerCount) {
+	ASSERT_ENGINE(specification.Width > 0 && specification.Height > 0, "Texture size must be non-zero!");
+	ASSERT_ENGINE(layerCount > 0, "Texture layer count must be non-zero!");
+	const TextureFormatInfo format = ImageFormatToOpenGL(specification.Format);
+	m_InternalFormat = format.InternalFormat;
+	m_DataFormat = format.DataFormat;
+	m_DataType = format.DataType;
+
+	if (m_Specification.Mipmaps == MipmapMode::CPU && format.DataType != GL_UNSIGNED_BYTE) {
+		LOG_WARN_ENGINE("CPU mip generation only supports 8-bit formats, using GPU generation instead");
+		m_Specification.Mipmaps = MipmapMode::GPU;
+	}
+	m_MipLevels = m_Specification.Mipmaps == MipmapMode::None ? 1 : CalculateMipLevelCount(specification.Width, specification.Height);
+
+	const OpenGLCapabilities& caps = OpenGLContext::GetCapabilities();
+	const bool array = target == GL_TEXTURE_2D_ARRAY;
+	const GLsizei levels = static_cast<GLsizei>(m_MipLevels);
+	const GLsizei width = static_cast<GLsizei>(specification.Width);
+	const GLsizei height = static_cast<GLsizei>(specification.Height);
+	const GLsizei layers = static_cast<GLsizei>(layerCount);
+	if (caps.DirectStateAccess) {
+		glCreateTextures(target, 1, &m_RendererID);
+		if (array) {
+			glTextureStorage3D(m_RendererID, levels, m_InternalFormat, width, height, layers);
+		} else {
+			glTextureStorage2D(m_RendererID, levels, m_InternalFormat, width, height);
+		}
+	} else {
+		glGenTextures(1, &m_RendererID);
+		glBindTexture(target, m_RendererID);
+		if (caps.TextureStorage) {
+			if (array) {
+				glTexStorage3D(target, levels, m_InternalFormat, width, height, layers);
+			} else {
+				glTexStorage2D(target, levels, m_InternalFormat, width, height);
+			}
+		} else {
+			for (uint32_t level = 0; level < m_MipLevels; ++level) {
+				const GLsizei mipWidth = static_cast<GLsizei>(GetMipWidth(level));
+				const GLsizei mipHeight = static_cast<GLsizei>(GetMipHeight(level));
+				if (array) {
+					glTexImage3D(target, static_cast<GLint>(level), static_cast<GLint>(m_InternalFormat), mipWidth, mipHeight, layers,
+						0, m_DataFormat, m_DataType, nullptr);
+				} else {
+					glTexImage2D(target, static_cast<GLint>(level), static_cast<GLint>(m_InternalFormat), mipWidth, mipHeight,
+						0, m_DataFormat, m_DataType, nullptr);
+				}
+			}
+			glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, levels - 1);
+		}
+	}
+	m_SamplerID = GetSampler(m_Specification.Sampler, m_MipLevels > 1);
+}
+
+OpenGLTextureBase::~OpenGLTextureBase() {
+	// 撤销尚未完成的上传，防止上传队列访问已销毁的纹理
+	if (m_PendingUploads > 0) {
+		std::lock_guard<std::mutex> lock(s_Uploader.QueueMutex);
+		auto& queue = s_Uploader.Queue;
+		queue.erase(std::remove_if(queue.begin(), queue.end(),
+			[this](const PendingTextureUpload& upload) { return upload.Texture == this; }), queue.end());
+		for (auto& region : s_Uploader.Regions) {
+			auto& textures = region.Textures;
+			textures.erase(std::remove(textures.begin(), textures.end(), this), textures.end());
+		}
+	}
+	// 常驻的句柄必须先撤销，否则驱动会一直保留纹理
+	if (m_BindlessHandle) {
+		OpenGLExtensions::Get().MakeTextureHandleNonResidentARB(m_BindlessHandle);
+	}
+	OpenGLDeletionQueue::Enqueue(GLObjectType::Texture, m_RendererID);
+}
+
+uint32_t OpenGLTextureBase::GetMipWidth(uint32_t mipLevel) const {
+	return std::max(1u, m_Specification.Width >> mipLevel);
+}
+
+uint32_t OpenGLTextureBase::GetMipHeight(uint32_t mipLevel) const {
+	return std::max(1u, m_Specification.Height >> mipLevel);
+}
+
+uint32_t OpenGLTextureBase::GetMipSize(uint32_t mipLevel) const {
+	return GetMipWidth(mipLevel) * GetMipHeight(mipLevel) * ImageFormatBytesPerPixel(m_Specification.Format);
+}
+
+void OpenGLTextureBase::SubmitLevel(Buffer&& pixels, uint32_t mipLevel, uint32_t layer, uint32_t layerCount) {
+	ASSERT_ENGINE(mipLevel < m_MipLevels, "Texture mip level out of range!");
+	ASSERT_ENGINE(layer + layerCount <= m_LayerCount, "Texture layer out of range!");
+	const uint32_t layerSize = GetMipSize(mipLevel);
+	ASSERT_ENGINE(pixels.Size == static_cast<uint64_t>(layerSize) * layerCount, "Texture data must cover the entire mip level!");
+	if (mipLevel != 0 || m_Specification.Mipmaps != MipmapMode::CPU) {
+		EnqueueUpload(std::move(pixels), { mipLevel, 0, 0, GetMipWidth(mipLevel), GetMipHeight(mipLevel), layer, layerCount });
+		return;
+	}
+	// CPU 生成整条 mip 链：每层由上一层缩小得到，数组的每一层分别生成
+	const uint32_t channels = ImageFormatBytesPerPixel(m_Specification.Format);
+	const bool srgb = m_Specification.Format == ImageFormat::SRGB8 || m_Specification.Format == ImageFormat::SRGB8_Alpha8;
+	for (uint32_t i = 0; i < layerCount; ++i) {
+		Buffer level = layerCount == 1 ? std::move(pixels) : Buffer::Copy(pixels.Data + static_cast<size_t>(i) * layerSize, layerSize);
+		for (uint32_t mip = 0; mip < m_MipLevels; ++mip) {
+			Buffer next;
+			if (mip + 1 < m_MipLevels) {
+				next = ImageDecoder::Downsample(level.Data, GetMipWidth(mip), GetMipHeight(mip), channels, srgb);
+			}
+			EnqueueUpload(std::move(level), { mip, 0, 0, GetMipWidth(mip), GetMipHeight(mip), layer + i, 1 });
+			level = std::move(next);
+		}
+	}
+}
+
+void OpenGLTextureBase::SubmitRegion(Buffer&& pixels, const OpenGLTextureRegion& region) {
+	ASSERT_ENGINE(region.MipLevel < m_MipLevels, "Texture mip level out of range!");
+	ASSERT_ENGINE(region.X + region.Width <= GetMipWidth(region.MipLevel) && region.Y + region.Height <= GetMipHeight(region.MipLevel),
+		"Texture region out of range!");
+	ASSERT_ENGINE(region.Layer + region.LayerCount <= m_LayerCount, "Texture layer out of range!");
+	ASSERT_ENGINE(pixels.Size == static_cast<uint64_t>(region.Width) * region.Height * region.LayerCount
+		* ImageFormatBytesPerPixel(m_Specification.Format), "Texture data must cover the entire region!");
+	if (region.Width == 0 || region.Height == 0 || region.LayerCount == 0) {
+		return;
+	}
+	EnqueueUpload(std::move(pixels), region);
+}
+
+void OpenGLTextureBase::EnqueueUpload(Buffer&& pixels, const OpenGLTextureRegion& region) {
+	m_HasData = true;
+	m_PendingUploads++;
+	std::lock_guard<std::mutex> lock(s_Uploader.QueueMutex);
+	s_Uploader.Queue.push_back({ this, region, std::move(pixels) });
+}
+
+void OpenGLTextureBase::IssueUpload(const OpenGLTextureRegion& region, const void* pixels) {
+	// GPU 生成 mip 推迟到本批上传全部提交之后，同一纹理的多次更新只生成一次
+	m_MipsDirty = m_MipsDirty || (region.MipLevel == 0 && m_Specification.Mipmaps == MipmapMode::GPU && m_MipLevels > 1);
+	const bool array = m_Target == GL_TEXTURE_2D_ARRAY;
+	// 像素数据都是紧密排列的：宽度不是 4 的倍数的 RGB8 等格式，每行不能按默认的 4 字节对齐读取
+	glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+	RendererFrameStatistics& stats = RendererStatistics::Current();
+	stats.TextureUploads++;
+	stats.TextureUploadBytes += static_cast<uint64_t>(region.Width) * region.Height * region.LayerCount
+		* ImageFormatBytesPerPixel(m_Specification.Format);
+	const GLint level = static_cast<GLint>(region.MipLevel);
+	const GLint x = static_cast<GLint>(region.X);
+	const GLint y = static_cast<GLint>(region.Y);
+	const GLint layer = static_cast<GLint>(region.Layer);
+	const GLsizei width = static_cast<GLsizei>(region.Width);
+	const GLsizei height = static_cast<GLsizei>(region.Height);
+	const GLsizei layers = static_cast<GLsizei>(region.LayerCount);
+	if (OpenGLContext::GetCapabilities().DirectStateAccess) {
+		if (array) {
+			glTextureSubImage3D(m_RendererID, level, x, y, layer, width, height, layers, m_DataFormat, m_DataType, pixels);
+		} else {
+			glTextureSubImage2D(m_RendererID, level, x, y, width, height, m_DataFormat, m_DataType, pixels);
+		}
+		return;
+	}
+	glBindTexture(m_Target, m_RendererID);
+	if (array) {
+		glTexSubImage3D(m_Target, level, x, y, layer, width, height, layers, m_DataFormat, m_DataType, pixels);
+	} else {
+		glTexSubImage2D(m_Target, level, x, y, width, height, m_DataFormat, m_DataType, pixels);
+	}
+}
+
+void OpenGLTextureBase::GenerateMipmaps() {
+	if (!m_MipsDirty) {
+		return;
+	}
+	m_MipsDirty = false;
+	if (OpenGLContext::GetCapabilities().DirectStateAccess) {
+		glGenerateTextureMipmap(m_RendererID);
+	} else {
+		glBindTexture(m_Target, m_RendererID);
+		glGenerateMipmap(m_Target);
+	}
+}
+
+void OpenGLTextureBase::BindUnit(uint32_t slot) const {
+	// 首次提交的数据仍在传输中时绑定占位纹理，采样状态仍使用本纹理的
+	const uint32_t rendererID = m_Resident ? m_RendererID : GetPlaceholder(m_Target).m_RendererID;
+	if (OpenGLContext::GetCapabilities().DirectStateAccess) {
+		glBindTextureUnit(slot, rendererID);
+	} else {
+		glActiveTexture(GL_TEXTURE0 + slot);
+		glBindTexture(m_Target, rendererID);
+	}
+	glBindSampler(slot, m_SamplerID);
+	RendererStatistics::Current().TextureBinds++;
+}
+
+uint64_t OpenGLTextureBase::GetHandle() const {
+	if (!OpenGLContext::GetCapabilities().BindlessTexture) {
+		return 0;
+	}
+	if (!m_Resident) {
+		return GetPlaceholder(m_Target).GetHandle();
+	}
+	// 句柄创建后纹理与采样器的状态都不能再修改，因此在数据到达后才创建
+	if (!m_BindlessHandle) {
+		const OpenGLExtensionFunctions& ext = OpenGLExtensions::Get();
+		m_BindlessHandle = ext.GetTextureSamplerHandleARB(m_RendererID, m_SamplerID);
+		ext.MakeTextureHandleResidentARB(m_BindlessHandle);
+	}
+	return m_BindlessHandle;
+}
+
+void OpenGLTextureBase::ProcessUploads() {
+	auto& uploader = s_Uploader;
+	// 1. 回收 GPU 已完成的区段（零超时轮询，不阻塞）
+	auto retire = [](TextureUploadRegion& region) {
+		for (OpenGLTextureBase* texture : region.Textures) {
+			texture->m_PendingUploads--;
+			texture->m_Resident = texture->m_Resident || texture->m_PendingUploads == 0;
+		}
+		region.Textures.clear();
+		glDeleteSync(region.Fence);
+		region.Fence = nullptr;
+	};
+	for (auto& region : uploader.Regions) {
+		if (region.Fence && WaitForFence(region.Fence, false)) {
+			retire(region);
+		}
+	}
+	std::unique_lock<std::mutex> queueLock(uploader.QueueMutex);
+	if (uploader.Queue.empty()) {
+		return;
+	}
+	if (!uploader.PixelBufferID) {
+		InitUploader();
+	}
+
+	// 2. 切换到下一段；持久映射时必须等 GPU 读完该段才能覆盖（通常在三帧前就已完成）
+	uploader.Region = (uploader.Region + 1) % s_UploadRegionCount;
+	TextureUploadRegion& region = uploader.Regions[uploader.Region];
+	if (region.Fence) {
+		WaitForFence(region.Fence, true);
+		retire(region);
+	}
+
+	// 3. 按预算取出本帧的上传；单个超出整段大小的上传直接从客户端内存提交
+	uploader.Batch.clear();
+	uint32_t usedSize = 0;
+	while (!uploader.Queue.empty()) {
+		PendingTextureUpload& upload = uploader.Queue.front();
+		const uint64_t alignedSize = (upload.Pixels.Size + s_UploadAlignment - 1) & ~static_cast<uint64_t>(s_UploadAlignment - 1);
+		if (alignedSize > s_UploadRegionSize) {
+			if (!uploader.Batch.empty()) {
+				break;
+			}
+			upload.Texture->IssueUpload(upload.Region, upload.Pixels.Data);
+			upload.Texture->GenerateMipmaps();
+			region.Textures.push_back(upload.Texture);
+			uploader.Queue.pop_front();
+			break;
+		}
+		if (usedSize + alignedSize > s_UploadRegionSize) {
+			break;
+		}
+		usedSize += static_cast<uint32_t>(alignedSize);
+		uploader.Batch.push_back(std::move(upload));
+		uploader.Queue.pop_front();
+	}
+	queueLock.unlock();
+
+	if (!uploader.Batch.empty()) {
+		// 4. 把像素数据写入 PBO
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, uploader.PixelBufferID);
+		uint8_t* mapped = nullptr;
+		uintptr_t baseOffset = 0;
+		if (uploader.Persistent) {
+			baseOffset = static_cast<uintptr_t>(uploader.Region) * s_UploadRegionSize;
+			mapped = uploader.MappedData + baseOffset;
+		} else {
+			// 孤立旧存储后再映射，驱动会为仍在传输的数据保留副本
+			glBufferData(GL_PIXEL_UNPACK_BUFFER, s_UploadRegionSize, nullptr, GL_STREAM_DRAW);
+			mapped = static_cast<uint8_t*>(glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, usedSize,
+				GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+		}
+		uint32_t offset = 0;
+		std::vector<uint32_t> offsets;
+		offsets.reserve(uploader.Batch.size());
+		for (const PendingTextureUpload& upload : uploader.Batch) {
+			if (mapped) {
+				memcpy(mapped + offset, upload.Pixels.Data, upload.Pixels.Size);
+			}
+			offsets.push_back(offset);
+			offset += (static_cast<uint32_t>(upload.Pixels.Size) + s_UploadAlignment - 1) & ~(s_UploadAlignment - 1);
+		}
+		if (!uploader.Persistent) {
+			glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+		}
+
+		// 5. 以 PBO 偏移提交 glTexSubImage2D/3D，调用立即返回，传输由驱动异步完成
+		for (size_t i = 0; i < uploader.Batch.size(); ++i) {
+			const PendingTextureUpload& upload = uploader.Batch[i];
+			upload.Texture->IssueUpload(upload.Region, reinterpret_cast<const void*>(baseOffset + offsets[i]));
+			region.Textures.push_back(upload.Texture);
+		}
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		for (const PendingTextureUpload& upload : uploader.Batch) {
+			upload.Texture->GenerateMipmaps();
+		}
+		uploader.Batch.clear();
+	}
+
+	// 6. 栅栏完成即表示本段的上传都已到达 GPU，对应纹理可以正常采样
+	region.Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void OpenGLTextureBase::Shutdown() {
+	auto& uploader = s_Uploader;
+	{
+		std::lock_guard<std::mutex> lock(uploader.QueueMutex);
+		uploader.Queue.clear();
+	}
+	uploader.Batch.clear();
+	for (auto& region : uploader.Regions) {
+		if (region.Fence) {
+			glDeleteSync(region.Fence);
+			region.Fence = nullptr;
+		}
+		region.Textures.clear();
+	}
+	if (uploader.PixelBufferID) {
+		if (uploader.MappedData) {
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, uploader.PixelBufferID);
+			glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+			uploader.MappedData = nullptr;
+		}
+		glDeleteBuffers(1, &uploader.PixelBufferID);
+		uploader.PixelBufferID = 0;
+		uploader.Persistent = false;
+	}
+	// 占位纹理析构时进入删除队列，随后由 OpenGLRendererAPI::Shutdown 一并删除
+	s_Placeholder.reset();
+	s_ArrayPlaceholder.reset();
+	for (const auto& [key, samplerID] : s_SamplerCache) {
+		glDeleteSamplers(1, &samplerID);
+	}
+	s_SamplerCache.clear();
+}
+
+const OpenGLTextureBase& OpenGLTextureBase::GetPlaceholder(uint32_t target) {
+	// 中性灰，加载完成前后的切换不会太突兀；1x1 的数据直接同步上传
+	static const uint8_t s_Gray[4] = { 128, 128, 128, 255 };
+	TextureSpecification specification;
+	specification.Mipmaps = MipmapMode::None;
+	OpenGLTextureBase* placeholder = nullptr;
+	if (target == GL_TEXTURE_2D_ARRAY) {
+		if (s_ArrayPlaceholder) {
+			return *s_ArrayPlaceholder;
+		}
+		s_ArrayPlaceholder = CreateScope<OpenGLTexture2DArray>(specification, 1);
+		placeholder = s_ArrayPlaceholder.get();
+	} else {
+		if (s_Placeholder) {
+			return *s_Placeholder;
+		}
+		s_Placeholder = CreateScope<OpenGLTexture2D>(specification);
+		placeholder = s_Placeholder.get();
+	}
+	placeholder->IssueUpload({ 0, 0, 0, 1, 1, 0, 1 }, s_Gray);
+	placeholder->m_HasData = true;
+	placeholder->m_Resident = true;
+	return *placeholder;
+}
+
+uint32_t OpenGLTextureBase::GetSampler(const SamplerSpecification& sampler, bool mipmapped) {
+	const uint32_t anisotropy = std::clamp(sampler.MaxAnisotropy, 1u, 16u);
+	const uint32_t key = static_cast<uint32_t>(sampler.MinFilter)
+		| (static_cast<uint32_t>(sampler.MagFilter) << 1)
+		| (static_cast<uint32_t>(sampler.WrapS) << 2)
+		| (static_cast<uint32_t>(sampler.WrapT) << 4)
+		| ((mipmapped ? 1u : 0u) << 6)
+		| (anisotropy << 7);
+	auto it = s_SamplerCache.find(key);
+	if (it != s_SamplerCache.end()) {
+		return it->second;
+	}
+
+	auto toGLWrap = [](TextureWrap wrap) -> GLint {
+		switch (wrap) {
+			case TextureWrap::Repeat:         return GL_REPEAT;
+			case TextureWrap::MirroredRepeat: return GL_MIRRORED_REPEAT;
+			case TextureWrap::ClampToEdge:    return GL_CLAMP_TO_EDGE;
+		}
+		return GL_REPEAT;
+	};
+	GLint minFilter = sampler.MinFilter == TextureFilter::Linear ? GL_LINEAR : GL_NEAREST;
+	if (mipmapped) {
+		minFilter = sampler.MinFilter == TextureFilter::Linear ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_NEAREST;
+	}
+
+	uint32_t samplerID = 0;
+	glGenSamplers(1, &samplerID);
+	glSamplerParameteri(samplerID, GL_TEXTURE_MIN_FILTER, minFilter);
+	glSamplerParameteri(samplerID, GL_TEXTURE_MAG_FILTER, sampler.MagFilter == TextureFilter::Linear ? GL_LINEAR : GL_NEAREST);
+	glSamplerParameteri(samplerID, GL_TEXTURE_WRAP_S, toGLWrap(sampler.WrapS));
+	glSamplerParameteri(samplerID, GL_TEXTURE_WRAP_T, toGLWrap(sampler.WrapT));
+	if (anisotropy > 1 && OpenGLContext::GetCapabilities().TextureAnisotropy) {
+		glSamplerParameterf(samplerID, GL_TEXTURE_MAX_ANISOTROPY, static_cast<float>(anisotropy));
+	}
+	s_SamplerCache[key] = samplerID;
+	return samplerID;
+}
+
+// ==================== OpenGLTexture2D ====================
+
+OpenGLTexture2D::OpenGLTexture2D(const TextureSpecification& specification)
+	: OpenGLTextureBase(GL_TEXTURE_2D, specification, 1) {
+}
+
+void OpenGLTexture2D::SetData(const void* data, uint32_t size, uint32_t mipLevel) {
+	SetData(Buffer::Copy(data, size), mipLevel);
+}
+
+void OpenGLTexture2D::SetData(Buffer&& pixels, uint32_t mipLevel) {
+	SubmitLevel(std::move(pixels), mipLevel, 0, 1);
+}
+
+void OpenGLTexture2D::SetSubData(Buffer&& pixels, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t mipLevel) {
+	SubmitRegion(std::move(pixels), { mipLevel, x, y, width, height, 0, 1 });
+}
+
+// ==================== OpenGLTexture2DArray ====================
+
+OpenGLTexture2DArray::OpenGLTexture2DArray(const TextureSpecification& specification, uint32_t layerCount)
+	: OpenGLTextureBase(GL_TEXTURE_2D_ARRAY, specification, layerCount) {
+}
+
+void OpenGLTexture2DArray::SetData(const void* data, uint32_t size, uint32_t mipLevel) {
+	SetData(Buffer::Copy(data, size), mipLevel);
+}
+
+void OpenGLTexture2DArray::SetData(Buffer&& pixels, uint32_t mipLevel) {
+	SubmitLevel(std::move(pixels), mipLevel, 0, m_LayerCount);
+}
+
+void OpenGLTexture2DArray::SetSubData(Buffer&& pixels, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t mipLevel) {
+	SubmitRegion(std::move(pixels), { mipLevel, x, y, width, height, 0, m_LayerCount });
+}
+
+void OpenGLTexture2DArray::SetLayerData(Buffer&& pixels, uint32_t layer, uint32_t mipLevel) {
+	SubmitLevel(std::move(pixels), mipLevel, layer, 1);
+}
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include "engine_services/renderer/Texture.h"
+#include <atomic>
+
+// ---------------------------------------------------------------------
+// 类: OpenGLTexture2D / OpenGLTexture2DArray
+// 作用: OpenGL 二维纹理与二维纹理数组实现
+// 描述: 创建时用 glTexStorage2D/3D 分配不可变存储（GL 4.2 以下回退为逐层 glTexImage2D/3D）。
+//       SetData 只把像素数据放入上传队列；ProcessUploads 每帧把不超过预算的数据拷贝进
+//       像素缓冲对象 (PBO) 的环形区段，再以 PBO 偏移调用 glTexSubImage2D/3D，
+//       传输由驱动异步完成，不阻塞 CPU。每帧的区段以栅栏标记，栅栏完成后纹理才视为已加载，
+//       首次提交的数据到达之前 Bind 会改为绑定一个 1x1 的占位纹理；SetSubData 只更新其中一个矩形区域。
+//       采样状态由按 SamplerSpecification 缓存的采样器对象 (glGenSamplers) 提供。
+//       两种纹理的存储、上传、占位与无绑定句柄逻辑都在公共基类 OpenGLTextureBase 中。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+// 一次上传的目标：mip 层中的矩形区域与层范围（二维纹理只有第 0 层）
+struct OpenGLTextureRegion {
+	uint32_t MipLevel = 0;
+	uint32_t X = 0, Y = 0;
+	uint32_t Width = 0, Height = 0;
+	uint32_t Layer = 0, LayerCount = 1;
+};
+
+class OpenGLTextureBase {
+public:
+	// 每帧调用一次（OpenGLRendererAPI::EndFrame）：回收 GPU 已完成的上传，并按预算提交排队的上传
+	static void ProcessUploads();
+	// 释放上传缓冲、占位纹理与采样器缓存，需要在 GL 上下文销毁之前调用（OpenGLRendererAPI::Shutdown）
+	static void Shutdown();
+protected:
+	// target 为 GL_TEXTURE_2D 或 GL_TEXTURE_2D_ARRAY
+	OpenGLTextureBase(uint32_t target, const TextureSpecification& specification, uint32_t layerCount);
+	~OpenGLTextureBase();
+
+	uint32_t GetMipWidth(uint32_t mipLevel) const;
+	uint32_t GetMipHeight(uint32_t mipLevel) const;
+	// 一层中第 mipLevel 层的字节数
+	uint32_t GetMipSize(uint32_t mipLevel) const;
+
+	// 提交 [layer, layer + layerCount) 各层第 mipLevel 层的完整数据（按层依次排列）；
+	// CPU 生成 mip 时第 0 层的数据会顺带生成整条 mip 链
+	void SubmitLevel(Buffer&& pixels, uint32_t mipLevel, uint32_t layer, uint32_t layerCount);
+	void SubmitRegion(Buffer&& pixels, const OpenGLTextureRegion& region);
+
+	void BindUnit(uint32_t slot) const;
+	uint64_t GetHandle() const;
+	inline bool IsUploadComplete() const { return m_HasData && m_PendingUploads == 0; }
+private:
+	void EnqueueUpload(Buffer&& pixels, const OpenGLTextureRegion& region);
+	// pixels 为 PBO 内的偏移（PBO 已绑定时）或客户端内存指针
+	void IssueUpload(const OpenGLTextureRegion& region, const void* pixels);
+	void GenerateMipmaps();
+
+	static const OpenGLTextureBase& GetPlaceholder(uint32_t target);
+	static uint32_t GetSampler(const SamplerSpecification& sampler, bool mipmapped);
+protected:
+	TextureSpecification m_Specification;
+	uint32_t m_Target = 0;
+	uint32_t m_RendererID = 0;
+	uint32_t m_SamplerID = 0;
+	uint32_t m_MipLevels = 1;
+	uint32_t m_LayerCount = 1;
+private:
+	uint32_t m_InternalFormat = 0;
+	uint32_t m_DataFormat = 0;
+	uint32_t m_DataType = 0;
+	// 以下三项由提交数据的线程与渲染线程共同访问（见 RenderThread）
+	std::atomic<uint32_t> m_PendingUploads{ 0 }; // 已排队或仍在传输中的上传数量
+	std::atomic<bool> m_HasData{ false };
+	std::atomic<bool> m_Resident{ false };       // 首次提交的数据已全部到达 GPU
+	bool m_MipsDirty = false;      // 第 0 层已更新，等本批上传提交后在 GPU 上重新生成 mip
+	mutable uint64_t m_BindlessHandle = 0;
+};
+
+class OpenGLTexture2D : public Texture2D, public OpenGLTextureBase {
+public:
+	OpenGLTexture2D(const TextureSpecification& specification);
+	virtual ~OpenGLTexture2D() = default;
+
+	virtual const TextureSpecification& GetSpecification() const override { return m_Specification; }
+	virtual uint32_t GetWidth() const override { return m_Specification.Width; }
+	virtual uint32_t GetHeight() const override { return m_Specification.Height; }
+	virtual uint32_t GetMipLevelCount() const override { return m_MipLevels; }
+	virtual uint32_t GetRendererID() const override { return m_RendererID; }
+
+	virtual void SetData(const void* data, uint32_t size, uint32_t mipLevel = 0) override;
+	virtual void SetData(Buffer&& pixels, uint32_t mipLevel = 0) override;
+	virtual void SetSubData(Buffer&& pixels, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t mipLevel = 0) override;
+	virtual bool IsLoaded() const override { return IsUploadComplete(); }
+
+	virtual void Bind(uint32_t slot = 0) const override { BindUnit(slot); }
+	virtual uint64_t GetBindlessHandle() const override { return GetHandle(); }
+
+	virtual bool operator==(const Texture& other) const override { return m_RendererID == other.GetRendererID(); }
+};
+
+class OpenGLTexture2DArray : public Texture2DArray, public OpenGLTextureBase {
+public:
+	OpenGLTexture2DArray(const TextureSpecification& specification, uint32_t layerCount);
+	virtual ~OpenGLTexture2DArray() = default;
+
+	virtual const TextureSpecification& GetSpecification() const override { return m_Specification; }
+	virtual uint32_t GetWidth() const override { return m_Specification.Width; }
+	virtual uint32_t GetHeight() const override { return m_Specification.Height; }
+	virtual uint32_t GetMipLevelCount() const override { return m_MipLevels; }
+	virtual uint32_t GetRendererID() const override { return m_RendererID; }
+	virtual uint32_t GetLayerCount() const override { return m_LayerCount; }
+
+	virtual void SetData(const void* data, uint32_t size, uint32_t mipLevel = 0) override;
+	virtual void SetData(Buffer&& pixels, uint32_t mipLevel = 0) override;
+	virtual void SetSubData(Buffer&& pixels, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t mipLevel = 0) override;
+	using Texture2DArray::SetLayerData;
+	virtual void SetLayerData(Buffer&& pixels, uint32_t layer, uint32_t mipLevel = 0) override;
+	virtual bool IsLoaded() const override { return IsUploadComplete(); }
+
+	virtual void Bind(uint32_t slot = 0) const override { BindUnit(slot); }
+	virtual uint64_t GetBindlessHandle() const override { return GetHandle(); }
+
+	virtual bool operator==(const Texture& other) const override { return m_RendererID == other.GetRendererID(); }
+};
+}
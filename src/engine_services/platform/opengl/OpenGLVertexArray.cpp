@@ -1,65 +1,185 @@
 #include "OpenGLVertexArray.h"
+#include "OpenGLBuffer.h"
+#include "OpenGLContext.h"
+#include "OpenGLDeletionQueue.h"
+#include "engine_services/renderer/RendererStatistics.h"
 #include <glad/glad.h>
+#include <iterator>
 
 namespace GE {
 
-static GLenum ShaderDataTypeToOpenGLBaseType(ShaderDataType type) {
-	switch (type) {
-		case ShaderDataType::Float:    return GL_FLOAT;
-		case ShaderDataType::Float2:   return GL_FLOAT;
-		case ShaderDataType::Float3:   return GL_FLOAT;
-		case ShaderDataType::Float4:   return GL_FLOAT;
-		case ShaderDataType::Mat3:     return GL_FLOAT;
-		case ShaderDataType::Mat4:     return GL_FLOAT;
-		case ShaderDataType::Int:      return GL_INT;
-		case ShaderDataType::Int2:     return GL_INT;
-		case ShaderDataType::Int3:     return GL_INT;
-		case ShaderDataType::Int4:     return GL_INT;
-		case ShaderDataType::Bool:     return GL_BOOL;
-	}
-	ASSERT_ENGINE(false, "Unknown ShaderDataType!");
-	return 0;
+// 每种 ShaderDataType 对应的 GL 顶点属性格式，按枚举值索引；
+// 设置 VAO 时对 BufferLayout 中的每个元素直接查表，不再逐个 switch
+struct AttributeFormat {
+	GLenum BaseType;
+	GLint ComponentCount; // 每个属性位置的分量数
+	uint32_t SlotCount;   // 矩阵属性按列占用多个连续的属性位置
+	bool Integer;         // 整数属性必须走 glVertexAttribIPointer，否则会被转换成 float
+	bool Normalized;      // *Norm 类型无论 BufferElement::Normalized 如何都归一化
+};
+
+static constexpr AttributeFormat s_AttributeFormats[] = {
+	{ 0,                              0, 0, false, false }, // None
+	{ GL_FLOAT,                       1, 1, false, false }, // Float
+	{ GL_FLOAT,                       2, 1, false, false }, // Float2
+	{ GL_FLOAT,                       3, 1, false, false }, // Float3
+	{ GL_FLOAT,                       4, 1, false, false }, // Float4
+	{ GL_FLOAT,                       3, 3, false, false }, // Mat3
+	{ GL_FLOAT,                       4, 4, false, false }, // Mat4
+	{ GL_INT,                         1, 1, true,  false }, // Int
+	{ GL_INT,                         2, 1, true,  false }, // Int2
+	{ GL_INT,                         3, 1, true,  false }, // Int3
+	{ GL_INT,                         4, 1, true,  false }, // Int4
+	{ GL_UNSIGNED_BYTE,               1, 1, true,  false }, // Bool（GL_BOOL 不是合法的顶点属性类型）
+	{ GL_HALF_FLOAT,                  2, 1, false, false }, // Half2
+	{ GL_HALF_FLOAT,                  4, 1, false, false }, // Half4
+	{ GL_UNSIGNED_BYTE,               4, 1, true,  false }, // UByte4
+	{ GL_UNSIGNED_BYTE,               4, 1, false, true  }, // UByte4Norm
+	{ GL_BYTE,                        4, 1, false, true  }, // Byte4Norm
+	{ GL_UNSIGNED_SHORT,              2, 1, false, true  }, // UShort2Norm
+	{ GL_SHORT,                       2, 1, false, true  }, // Short2Norm
+	{ GL_SHORT,                       4, 1, false, true  }, // Short4Norm
+	{ GL_INT_2_10_10_10_REV,          4, 1, false, false }, // Int2_10_10_10_Rev
+	{ GL_UNSIGNED_INT_2_10_10_10_REV, 4, 1, false, false }, // UInt2_10_10_10_Rev
+};
+static_assert(std::size(s_AttributeFormats) == static_cast<size_t>(ShaderDataType::UInt2_10_10_10_Rev) + 1,
+	"s_AttributeFormats must cover every ShaderDataType");
+
+static const AttributeFormat& GetAttributeFormat(ShaderDataType type) {
+	ASSERT_ENGINE(type != ShaderDataType::None, "Unknown ShaderDataType!");
+	return s_AttributeFormats[static_cast<size_t>(type)];
 }
 
-OpenGLVertexArray::OpenGLVertexArray() {
-	glGenVertexArrays(1, &m_RendererID);
+OpenGLVertexArray::OpenGLVertexArray()
+	: m_DirectStateAccess(OpenGLContext::GetCapabilities().DirectStateAccess) {
+	if (m_DirectStateAccess) {
+		glCreateVertexArrays(1, &m_RendererID);
+	} else {
+		glGenVertexArrays(1, &m_RendererID);
+	}
 }
 
 OpenGLVertexArray::~OpenGLVertexArray() {
-	glDeleteVertexArrays(1, &m_RendererID);
+	OpenGLDeletionQueue::Enqueue(GLObjectType::VertexArray, m_RendererID);
 }
 
 void OpenGLVertexArray::Bind() const {
 	glBindVertexArray(m_RendererID);
+	RendererStatistics::Current().VertexArrayBinds++;
+	UpdateStreamingOffsets();
+}
+
+void OpenGLVertexArray::UpdateStreamingOffsets() const {
+	for (auto& binding : m_StreamingBindings) {
+		uint32_t offset = binding.Buffer->GetStreamingOffset();
+		if (offset == binding.BoundOffset) {
+			continue;
+		}
+		const auto& layout = binding.Buffer->GetLayout();
+		const GLsizei stride = static_cast<GLsizei>(layout.GetStride());
+		if (m_DirectStateAccess) {
+			// DSA 下每个顶点缓冲独占一个绑定点，属性偏移是相对的，只需移动绑定点的基础偏移
+			glVertexArrayVertexBuffer(m_RendererID, binding.BindingIndex, binding.Buffer->GetRendererID(),
+				static_cast<GLintptr>(offset), stride);
+			binding.BoundOffset = offset;
+			continue;
+		}
+		// glVertexAttribPointer 设置的属性 i 使用绑定点 i，相对偏移为 0，
+		// 因此把绑定点的偏移改为 (属性偏移 + 当前段偏移) 即可让属性读取最新写入的段
+		uint32_t attribute = binding.FirstAttribute;
+		for (const auto& element : layout) {
+			const uint32_t slotCount = GetAttributeFormat(element.Type).SlotCount;
+			for (uint32_t slot = 0; slot < slotCount; ++slot) {
+				const size_t slotOffset = element.Offset + slot * (element.Size / slotCount);
+				glBindVertexBuffer(attribute++, binding.Buffer->GetRendererID(),
+					static_cast<GLintptr>(slotOffset + offset), stride);
+			}
+		}
+		binding.BoundOffset = offset;
+	}
 }
 
 void OpenGLVertexArray::Unbind() const {
 	glBindVertexArray(0);
 }
 // 添加顶点缓冲区
-// 核心逻辑：遍历 VertexBuffer 的 Layout，为每个属性调用 glEnableVertexAttribArray 和 glVertexAttribPointer
+// 核心逻辑：遍历 VertexBuffer 的 Layout，为每个属性启用并设置格式
+// （整数属性使用 IFormat/IPointer，矩阵按列拆成多个属性）
 void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) {
 	ASSERT_ENGINE(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
+	const auto& glVertexBuffer = static_cast<const OpenGLVertexBuffer&>(*vertexBuffer);
+	if (m_DirectStateAccess) {
+		AddVertexBufferDSA(glVertexBuffer);
+	} else {
+		AddVertexBufferLegacy(glVertexBuffer);
+	}
+	m_VertexBuffers.push_back(vertexBuffer);
+}
+
+// GL 4.5：格式与缓冲分离 (glVertexArrayAttribFormat + glVertexArrayVertexBuffer)，
+// 不需要绑定 VAO 或 GL_ARRAY_BUFFER
+void OpenGLVertexArray::AddVertexBufferDSA(const OpenGLVertexBuffer& vertexBuffer) {
+	const auto& layout = vertexBuffer.GetLayout();
+	const GLsizei stride = static_cast<GLsizei>(layout.GetStride());
+	const uint32_t bindingIndex = static_cast<uint32_t>(m_VertexBuffers.size());
+	glVertexArrayVertexBuffer(m_RendererID, bindingIndex, vertexBuffer.GetRendererID(),
+		vertexBuffer.GetStreamingOffset(), stride);
+	if (vertexBuffer.IsPersistentlyMapped()) {
+		m_StreamingBindings.push_back({ &vertexBuffer, m_VertexBufferIndex, bindingIndex, vertexBuffer.GetStreamingOffset() });
+	}
+	for (const auto& element : layout) {
+		const AttributeFormat& format = GetAttributeFormat(element.Type);
+		const GLboolean normalized = (element.Normalized || format.Normalized) ? GL_TRUE : GL_FALSE;
+		for (uint32_t slot = 0; slot < format.SlotCount; ++slot) {
+			const GLuint relativeOffset = static_cast<GLuint>(element.Offset + slot * (element.Size / format.SlotCount));
+			glEnableVertexArrayAttrib(m_RendererID, m_VertexBufferIndex);
+			if (format.Integer) {
+				glVertexArrayAttribIFormat(m_RendererID, m_VertexBufferIndex, format.ComponentCount, format.BaseType, relativeOffset);
+			} else {
+				glVertexArrayAttribFormat(m_RendererID, m_VertexBufferIndex, format.ComponentCount, format.BaseType, normalized, relativeOffset);
+			}
+			glVertexArrayAttribBinding(m_RendererID, m_VertexBufferIndex, bindingIndex);
+			m_VertexBufferIndex++;
+		}
+	}
+}
+
+// GL 3.3：绑定 VAO 与 GL_ARRAY_BUFFER 后调用 glVertexAttribPointer
+void OpenGLVertexArray::AddVertexBufferLegacy(const OpenGLVertexBuffer& vertexBuffer) {
 	glBindVertexArray(m_RendererID);
-	vertexBuffer->Bind();
-	const auto& layout = vertexBuffer->GetLayout();
+	vertexBuffer.Bind();
+	const auto& layout = vertexBuffer.GetLayout();
+	const GLsizei stride = static_cast<GLsizei>(layout.GetStride());
+	if (vertexBuffer.IsPersistentlyMapped()) {
+		m_StreamingBindings.push_back({ &vertexBuffer, m_VertexBufferIndex, 0, 0 });
+	}
 	for (const auto& element : layout) {
-		glEnableVertexAttribArray(m_VertexBufferIndex);
-		glVertexAttribPointer(m_VertexBufferIndex,
-			element.GetComponentCount(),
-			ShaderDataTypeToOpenGLBaseType(element.Type),
-			element.Normalized ? GL_TRUE : GL_FALSE,
-			layout.GetStride(),
-			(const void*)element.Offset);
-		m_VertexBufferIndex++;
+		const AttributeFormat& format = GetAttributeFormat(element.Type);
+		if (format.Integer) {
+			glEnableVertexAttribArray(m_VertexBufferIndex);
+			glVertexAttribIPointer(m_VertexBufferIndex, format.ComponentCount, format.BaseType,
+				stride, (const void*)element.Offset);
+			m_VertexBufferIndex++;
+			continue;
+		}
+		const GLboolean normalized = (element.Normalized || format.Normalized) ? GL_TRUE : GL_FALSE;
+		for (uint32_t slot = 0; slot < format.SlotCount; ++slot) {
+			glEnableVertexAttribArray(m_VertexBufferIndex);
+			glVertexAttribPointer(m_VertexBufferIndex, format.ComponentCount, format.BaseType, normalized,
+				stride, (const void*)(element.Offset + slot * (element.Size / format.SlotCount)));
+			m_VertexBufferIndex++;
+		}
 	}
-	m_VertexBuffers.push_back(vertexBuffer);
 }
 // 设置索引缓冲区
 // 注意：VAO 也会记录当前的 GL_ELEMENT_ARRAY_BUFFER 绑定状态
 void OpenGLVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) {
-	glBindVertexArray(m_RendererID);
-	indexBuffer->Bind();
+	if (m_DirectStateAccess) {
+		glVertexArrayElementBuffer(m_RendererID, static_cast<const OpenGLIndexBuffer&>(*indexBuffer).GetRendererID());
+	} else {
+		glBindVertexArray(m_RendererID);
+		indexBuffer->Bind();
+	}
 	m_IndexBuffer = indexBuffer;
 }
 }
\ No newline at end of file
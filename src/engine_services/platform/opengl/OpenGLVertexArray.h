@@ -5,11 +5,15 @@
 // 类: OpenGLVertexArray
 // 作用: OpenGL 顶点数组对象 (VAO) 实现
 // 描述: 管理顶点属性和缓冲区的绑定状态。
-//       在 AddVertexBuffer 中，会根据 Buffer 的 Layout 自动调用 glVertexAttribPointer。
+//       在 AddVertexBuffer 中，会根据 Buffer 的 Layout 自动设置顶点属性：
+//       GL 4.5 使用 DSA (glVertexArrayVertexBuffer / glVertexArrayAttribFormat)，每个顶点缓冲对应一个绑定点；
+//       GL 3.3 回退到绑定 VAO 后调用 glVertexAttribPointer。
 // ---------------------------------------------------------------------
 
 namespace GE {
 
+class OpenGLVertexBuffer;
+
 class OpenGLVertexArray : public VertexArray {
 public:
 	OpenGLVertexArray();
@@ -20,10 +24,28 @@ public:
 	virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override;
 	virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
 	virtual const Ref<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
+
+	// 把流式顶点缓冲的绑定点偏移指向最近一次写入的位置；Bind 时会调用，
+	// 绑定之后又 SetData 的情况由 OpenGLRendererAPI 在绘制前再调用一次（回退路径要求该 VAO 已绑定）
+	void UpdateStreamingOffsets() const;
+private:
+	void AddVertexBufferDSA(const OpenGLVertexBuffer& vertexBuffer);
+	void AddVertexBufferLegacy(const OpenGLVertexBuffer& vertexBuffer);
 private:
 	uint32_t m_RendererID;
+	bool m_DirectStateAccess;
 	uint32_t m_VertexBufferIndex = 0; // 记录下一个要启用的顶点属性索引 (Attribute Index)
 	std::vector<Ref<VertexBuffer>> m_VertexBuffers;
 	Ref<IndexBuffer> m_IndexBuffer;
+
+	// 持久映射的流式顶点缓冲：每次 SetData 后数据位于环形缓冲的不同段，
+	// Bind 时需把其绑定点的偏移指向当前段
+	struct StreamingBinding {
+		const OpenGLVertexBuffer* Buffer;
+		uint32_t FirstAttribute; // 回退路径：属性 i 对应绑定点 i
+		uint32_t BindingIndex;   // DSA 路径：整个缓冲共用的绑定点
+		uint32_t BoundOffset;
+	};
+	mutable std::vector<StreamingBinding> m_StreamingBindings;
 };
 }
\ No newline at end of file
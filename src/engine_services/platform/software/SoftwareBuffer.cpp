@@ -0,0 +1,63 @@
+#include "SoftwareBuffer.h"
+#include "engine_services/renderer/RendererStatistics.h"
+#include <algorithm>
+#include <cstring>
+
+namespace GE {
+
+static inline void CountUpload(uint64_t size) {
+	RendererFrameStatistics& stats = RendererStatistics::Current();
+	stats.BufferUploads++;
+	stats.BufferUploadBytes += size;
+}
+
+SoftwareVertexBuffer::SoftwareVertexBuffer(uint32_t size)
+	: m_Data(size) {
+}
+
+SoftwareVertexBuffer::SoftwareVertexBuffer(float* vertices, uint32_t size)
+	: m_Data(size) {
+	if (vertices) {
+		std::memcpy(m_Data.data(), vertices, size);
+	}
+}
+
+void SoftwareVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+	ASSERT_ENGINE(static_cast<uint64_t>(offset) + size <= m_Data.size(), "VertexBuffer::SetData out of range!");
+	std::memcpy(m_Data.data() + offset, data, size);
+	CountUpload(size);
+}
+
+SoftwareIndexBuffer::SoftwareIndexBuffer(uint32_t* indices, uint32_t count)
+	: m_Indices(count) {
+	if (indices) {
+		std::copy_n(indices, count, m_Indices.data());
+	}
+}
+
+void SoftwareIndexBuffer::SetData(const uint32_t* indices, uint32_t count, uint32_t offset) {
+	ASSERT_ENGINE(static_cast<uint64_t>(offset) + count <= m_Indices.size(), "IndexBuffer::SetData out of range!");
+	std::copy_n(indices, count, m_Indices.data() + offset);
+	CountUpload(static_cast<uint64_t>(count) * sizeof(uint32_t));
+}
+
+SoftwareIndirectBuffer::SoftwareIndirectBuffer(uint32_t capacity)
+	: m_Commands(capacity) {
+}
+
+void SoftwareIndirectBuffer::SetCommands(const DrawElementsIndirectCommand* commands, uint32_t count, uint32_t offset) {
+	ASSERT_ENGINE(static_cast<uint64_t>(offset) + count <= m_Commands.size(), "IndirectBuffer::SetCommands out of range!");
+	std::copy_n(commands, count, m_Commands.data() + offset);
+	CountUpload(static_cast<uint64_t>(count) * sizeof(DrawElementsIndirectCommand));
+}
+
+SoftwareStorageBuffer::SoftwareStorageBuffer(uint32_t size)
+	: m_Data(size) {
+}
+
+void SoftwareStorageBuffer::SetData(const void* data, uint32_t size, uint32_t offset) {
+	ASSERT_ENGINE(static_cast<uint64_t>(offset) + size <= m_Data.size(), "StorageBuffer::SetData out of range!");
+	std::memcpy(m_Data.data() + offset, data, size);
+	CountUpload(size);
+}
+}
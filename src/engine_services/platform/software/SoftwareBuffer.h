@@ -0,0 +1,68 @@
+#pragma once
+#include "engine_services/renderer/Buffer.h"
+#include <vector>
+
+// ---------------------------------------------------------------------
+// 类: SoftwareVertexBuffer / SoftwareIndexBuffer / SoftwareIndirectBuffer / SoftwareStorageBuffer
+// 作用: 软件渲染后端的缓冲区
+// 描述: 数据直接保存在系统内存中，SetData 只是拷贝；SoftwareRendererAPI 绘制时按 BufferLayout 读取顶点。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class SoftwareVertexBuffer : public VertexBuffer {
+public:
+	SoftwareVertexBuffer(uint32_t size);
+	SoftwareVertexBuffer(float* vertices, uint32_t size);
+	virtual void Bind() const override {}
+	virtual void Unbind() const override {}
+	virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+	virtual const BufferLayout& GetLayout() const override { return m_Layout; }
+	virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
+	virtual uint32_t GetSize() const override { return static_cast<uint32_t>(m_Data.size()); }
+
+	inline const uint8_t* GetData() const { return m_Data.data(); }
+private:
+	std::vector<uint8_t> m_Data;
+	BufferLayout m_Layout;
+};
+
+class SoftwareIndexBuffer : public IndexBuffer {
+public:
+	SoftwareIndexBuffer(uint32_t* indices, uint32_t count);
+	virtual void Bind() const override {}
+	virtual void Unbind() const override {}
+	virtual uint32_t GetCount() const override { return static_cast<uint32_t>(m_Indices.size()); }
+	virtual void SetData(const uint32_t* indices, uint32_t count, uint32_t offset = 0) override;
+
+	inline const uint32_t* GetData() const { return m_Indices.data(); }
+private:
+	std::vector<uint32_t> m_Indices;
+};
+
+class SoftwareIndirectBuffer : public IndirectBuffer {
+public:
+	SoftwareIndirectBuffer(uint32_t capacity);
+	virtual void Bind() const override {}
+	virtual void Unbind() const override {}
+	virtual void SetCommands(const DrawElementsIndirectCommand* commands, uint32_t count, uint32_t offset = 0) override;
+	virtual uint32_t GetCapacity() const override { return static_cast<uint32_t>(m_Commands.size()); }
+
+	inline const DrawElementsIndirectCommand* GetCommands() const { return m_Commands.data(); }
+private:
+	std::vector<DrawElementsIndirectCommand> m_Commands;
+};
+
+// 软件着色器不读取 SSBO，只保存数据，便于同一套提交代码在两个后端上运行
+class SoftwareStorageBuffer : public StorageBuffer {
+public:
+	SoftwareStorageBuffer(uint32_t size);
+	virtual void Bind(uint32_t) const override {}
+	virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+	virtual uint32_t GetSize() const override { return static_cast<uint32_t>(m_Data.size()); }
+
+	inline const uint8_t* GetData() const { return m_Data.data(); }
+private:
+	std::vector<uint8_t> m_Data;
+};
+}
@@ -0,0 +1,580 @@
+#include "SoftwareRendererAPI.h"
+#include "SoftwareBuffer.h"
+#include "SoftwareVertexArray.h"
+#include "engine_services/renderer/RendererStatistics.h"
+#include "engine_services/renderer/VertexPacking.h"
+#include "core/JobSystem.h"
+#include "core/Log.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <emmintrin.h>
+
+// ---------------------------------------------------------------------
+// 文件: SoftwareRendererAPI.cpp
+// 作用: 软件渲染后端的顶点处理、图元装配与瓦片光栅化
+// ---------------------------------------------------------------------
+namespace GE {
+
+static SoftwareRendererAPI* s_Instance = nullptr;
+
+// 顶点阶段每个任务处理的顶点数
+static constexpr uint32_t s_VertexGroupSize = 256;
+// 一次绘制最多读取的属性位置（矩阵按列计）
+static constexpr uint32_t s_MaxAttributes = 32;
+
+static inline void CountDraw(uint32_t vertexCount) {
+	RendererFrameStatistics& stats = RendererStatistics::Current();
+	stats.DrawCalls++;
+	stats.Vertices += vertexCount;
+	stats.Triangles += vertexCount / 3;
+}
+
+// ==================== 顶点属性 ====================
+
+// 一个属性位置的数据来源；矩阵的每一列是一个来源
+struct AttributeSource {
+	const uint8_t* Data;
+	uint32_t Size;       // 缓冲区的字节数，越界的读取返回默认值
+	uint32_t Stride;
+	uint32_t Offset;
+	ShaderDataType Type;
+	bool Normalized;
+};
+
+static void GatherAttributes(const SoftwareVertexArray& vertexArray, std::vector<AttributeSource>& sources) {
+	sources.clear();
+	for (const Ref<VertexBuffer>& buffer : vertexArray.GetVertexBuffers()) {
+		const SoftwareVertexBuffer& softwareBuffer = static_cast<const SoftwareVertexBuffer&>(*buffer);
+		const BufferLayout& layout = buffer->GetLayout();
+		for (const BufferElement& element : layout) {
+			AttributeSource source{ softwareBuffer.GetData(), softwareBuffer.GetSize(), layout.GetStride(),
+				static_cast<uint32_t>(element.Offset), element.Type, element.Normalized };
+			uint32_t columns = 1;
+			if (element.Type == ShaderDataType::Mat3) {
+				source.Type = ShaderDataType::Float3;
+				columns = 3;
+			} else if (element.Type == ShaderDataType::Mat4) {
+				source.Type = ShaderDataType::Float4;
+				columns = 4;
+			}
+			for (uint32_t column = 0; column < columns; ++column) {
+				sources.push_back(source);
+				source.Offset += ShaderDataTypeSize(source.Type);
+			}
+		}
+	}
+	ASSERT_ENGINE(sources.size() <= s_MaxAttributes, "Too many vertex attributes for the software renderer!");
+}
+// 当前绘制的属性来源，只在渲染线程上重建，顶点任务只读
+static std::vector<AttributeSource> s_AttributeSources;
+
+// 与 GL 相同：缺少的分量为 (0, 0, 0, 1)
+static Vec4 DecodeAttribute(const AttributeSource& source, uint32_t vertex) {
+	Vec4 result(0.0f, 0.0f, 0.0f, 1.0f);
+	const uint64_t position = static_cast<uint64_t>(vertex) * source.Stride + source.Offset;
+	if (position + ShaderDataTypeSize(source.Type) > source.Size) {
+		return result;
+	}
+	const uint8_t* data = source.Data + position;
+	float* components = &result.x;
+	switch (source.Type) {
+		case ShaderDataType::Float:
+		case ShaderDataType::Float2:
+		case ShaderDataType::Float3:
+		case ShaderDataType::Float4:
+			std::memcpy(components, data, ShaderDataTypeSize(source.Type));
+			break;
+		case ShaderDataType::Int:
+		case ShaderDataType::Int2:
+		case ShaderDataType::Int3:
+		case ShaderDataType::Int4: {
+			int32_t values[4];
+			const uint32_t count = ShaderDataTypeSize(source.Type) / 4;
+			std::memcpy(values, data, count * sizeof(int32_t));
+			for (uint32_t i = 0; i < count; ++i) {
+				components[i] = static_cast<float>(values[i]);
+			}
+			break;
+		}
+		case ShaderDataType::Bool:
+			components[0] = static_cast<float>(data[0]);
+			break;
+		case ShaderDataType::UByte4:
+			for (uint32_t i = 0; i < 4; ++i) {
+				components[i] = static_cast<float>(data[i]);
+			}
+			break;
+		case ShaderDataType::Half2:
+		case ShaderDataType::Half4: {
+			uint16_t values[4];
+			const uint32_t count = ShaderDataTypeSize(source.Type) / 2;
+			std::memcpy(values, data, count * sizeof(uint16_t));
+			for (uint32_t i = 0; i < count; ++i) {
+				components[i] = HalfToFloat(values[i]);
+			}
+			break;
+		}
+		case ShaderDataType::UByte4Norm:
+			UnpackUnorm8(data, components, 4);
+			break;
+		case ShaderDataType::Byte4Norm:
+			UnpackSnorm8(reinterpret_cast<const int8_t*>(data), components, 4);
+			break;
+		case ShaderDataType::UShort2Norm: {
+			uint16_t values[2];
+			std::memcpy(values, data, sizeof(values));
+			UnpackUnorm16(values, components, 2);
+			break;
+		}
+		case ShaderDataType::Short2Norm:
+		case ShaderDataType::Short4Norm: {
+			int16_t values[4];
+			const uint32_t count = ShaderDataTypeSize(source.Type) / 2;
+			std::memcpy(values, data, count * sizeof(int16_t));
+			UnpackSnorm16(values, components, count);
+			break;
+		}
+		case ShaderDataType::Int2_10_10_10_Rev:
+		case ShaderDataType::UInt2_10_10_10_Rev: {
+			uint32_t packed;
+			std::memcpy(&packed, data, sizeof(packed));
+			if (source.Type == ShaderDataType::Int2_10_10_10_Rev && source.Normalized) {
+				UnpackSnorm1010102(&packed, components, 1);
+				break;
+			}
+			for (uint32_t i = 0; i < 4; ++i) {
+				const uint32_t bits = i < 3 ? 10 : 2;
+				const uint32_t field = (packed >> (i * 10)) & ((1u << bits) - 1);
+				if (source.Type == ShaderDataType::Int2_10_10_10_Rev) {
+					// 符号扩展
+					const int32_t value = static_cast<int32_t>(field << (32 - bits)) >> (32 - bits);
+					components[i] = static_cast<float>(value);
+				} else {
+					components[i] = source.Normalized ? static_cast<float>(field) / static_cast<float>((1u << bits) - 1)
+						: static_cast<float>(field);
+				}
+			}
+			break;
+		}
+		default:
+			break;
+	}
+	return result;
+}
+
+// ==================== 颜色 ====================
+
+static inline uint32_t PackColor(const Vec4& color) {
+	const Vec4 clamped = glm::clamp(color, Vec4(0.0f), Vec4(1.0f)) * 255.0f + 0.5f;
+	return static_cast<uint32_t>(clamped.r) | (static_cast<uint32_t>(clamped.g) << 8)
+		| (static_cast<uint32_t>(clamped.b) << 16) | (static_cast<uint32_t>(clamped.a) << 24);
+}
+
+static inline Vec4 UnpackColor(uint32_t color) {
+	return Vec4(static_cast<float>(color & 0xFF), static_cast<float>((color >> 8) & 0xFF),
+		static_cast<float>((color >> 16) & 0xFF), static_cast<float>(color >> 24)) * (1.0f / 255.0f);
+}
+
+// ==================== SoftwareRendererAPI ====================
+
+SoftwareRendererAPI::SoftwareRendererAPI() {
+	ASSERT_ENGINE(!s_Instance, "Only one software renderer may exist!");
+	s_Instance = this;
+}
+
+SoftwareRendererAPI::~SoftwareRendererAPI() {
+	s_Instance = nullptr;
+}
+
+SoftwareRendererAPI* SoftwareRendererAPI::Get() {
+	return s_Instance;
+}
+
+void SoftwareRendererAPI::Init() {
+	LOG_INFO_ENGINE("Software renderer: {0} raster threads, {1}x{1} tiles", JobSystem::GetWorkerCount() + 1, TileSize);
+}
+
+void SoftwareRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+	m_ViewportX = x;
+	m_ViewportY = y;
+	m_ViewportWidth = width;
+	m_ViewportHeight = height;
+	const uint32_t requiredWidth = std::max(m_Framebuffer.Width, x + width);
+	const uint32_t requiredHeight = std::max(m_Framebuffer.Height, y + height);
+	if (requiredWidth == m_Framebuffer.Width && requiredHeight == m_Framebuffer.Height) {
+		return;
+	}
+	// 保留已有的内容，新增区域为透明黑与远平面
+	SoftwareFramebuffer resized;
+	resized.Width = requiredWidth;
+	resized.Height = requiredHeight;
+	resized.Color.assign(static_cast<size_t>(requiredWidth) * requiredHeight, 0);
+	resized.Depth.assign(static_cast<size_t>(requiredWidth) * requiredHeight, 1.0f);
+	for (uint32_t row = 0; row < m_Framebuffer.Height; ++row) {
+		std::copy_n(m_Framebuffer.Color.data() + row * m_Framebuffer.Width, m_Framebuffer.Width, resized.Color.data() + row * requiredWidth);
+		std::copy_n(m_Framebuffer.Depth.data() + row * m_Framebuffer.Width, m_Framebuffer.Width, resized.Depth.data() + row * requiredWidth);
+	}
+	m_Framebuffer = std::move(resized);
+	m_TilesX = (requiredWidth + TileSize - 1) / TileSize;
+	m_TilesY = (requiredHeight + TileSize - 1) / TileSize;
+	m_TileBins.resize(m_TilesX * m_TilesY);
+}
+
+void SoftwareRendererAPI::Clear() {
+	std::fill(m_Framebuffer.Color.begin(), m_Framebuffer.Color.end(), PackColor(m_ClearColor));
+	std::fill(m_Framebuffer.Depth.begin(), m_Framebuffer.Depth.end(), 1.0f);
+}
+
+void SoftwareRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount) {
+	const SoftwareVertexArray& softwareArray = static_cast<const SoftwareVertexArray&>(*vertexArray);
+	if (const Ref<IndexBuffer>& indexBuffer = vertexArray->GetIndexBuffer()) {
+		const uint32_t count = indexCount ? indexCount : indexBuffer->GetCount();
+		Draw(softwareArray, static_cast<const SoftwareIndexBuffer&>(*indexBuffer).GetData(), count, 0, 0, 0);
+		CountDraw(count);
+		return;
+	}
+	// 与 OpenGLRendererAPI 相同：没有索引缓冲时按第一个顶点缓冲的大小计算顶点数量
+	const auto& vertexBuffers = vertexArray->GetVertexBuffers();
+	if (!vertexBuffers.empty()) {
+		const uint32_t vertexCount = vertexBuffers[0]->GetSize() / vertexBuffers[0]->GetLayout().GetStride();
+		const uint32_t count = indexCount ? indexCount : vertexCount;
+		Draw(softwareArray, nullptr, count, 0, 0, 0);
+		CountDraw(count);
+	}
+}
+
+void SoftwareRendererAPI::DrawArrays(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex) {
+	Draw(static_cast<const SoftwareVertexArray&>(*vertexArray), nullptr, vertexCount, firstVertex, 0, 0);
+	CountDraw(vertexCount);
+}
+
+void SoftwareRendererAPI::DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t firstIndex, int32_t baseVertex) {
+	ASSERT_ENGINE(vertexArray->GetIndexBuffer(), "Base vertex draw requires an index buffer!");
+	const SoftwareIndexBuffer& indexBuffer = static_cast<const SoftwareIndexBuffer&>(*vertexArray->GetIndexBuffer());
+	ASSERT_ENGINE(static_cast<uint64_t>(firstIndex) + indexCount <= indexBuffer.GetCount(), "Index range out of bounds!");
+	Draw(static_cast<const SoftwareVertexArray&>(*vertexArray), indexBuffer.GetData() + firstIndex, indexCount, 0, baseVertex, 0);
+	CountDraw(indexCount);
+}
+
+void SoftwareRendererAPI::DrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<IndirectBuffer>& indirectBuffer,
+	uint32_t drawCount, uint32_t firstCommand) {
+	ASSERT_ENGINE(vertexArray->GetIndexBuffer(), "Indirect draw requires an index buffer!");
+	ASSERT_ENGINE(static_cast<uint64_t>(firstCommand) + drawCount <= indirectBuffer->GetCapacity(), "Indirect draw range out of bounds!");
+	const SoftwareVertexArray& softwareArray = static_cast<const SoftwareVertexArray&>(*vertexArray);
+	const SoftwareIndexBuffer& indexBuffer = static_cast<const SoftwareIndexBuffer&>(*vertexArray->GetIndexBuffer());
+	const DrawElementsIndirectCommand* commands = static_cast<const SoftwareIndirectBuffer&>(*indirectBuffer).GetCommands() + firstCommand;
+	for (uint32_t i = 0; i < drawCount; ++i) {
+		const DrawElementsIndirectCommand& command = commands[i];
+		ASSERT_ENGINE(static_cast<uint64_t>(command.FirstIndex) + command.Count <= indexBuffer.GetCount(), "Index range out of bounds!");
+		for (uint32_t instance = 0; instance < command.InstanceCount; ++instance) {
+			Draw(softwareArray, indexBuffer.GetData() + command.FirstIndex, command.Count, 0, command.BaseVertex,
+				command.BaseInstance + instance);
+		}
+	}
+	RendererFrameStatistics& stats = RendererStatistics::Current();
+	stats.DrawCalls++;
+	stats.IndirectCommands += drawCount;
+}
+
+void SoftwareRendererAPI::Draw(const SoftwareVertexArray& vertexArray, const uint32_t* indices, uint32_t count, uint32_t first,
+	int32_t baseVertex, uint32_t instanceIndex) {
+	const SoftwareShader* shader = SoftwareShader::GetBound();
+	if (!shader) {
+		LOG_WARN_ENGINE("Software renderer: draw without a bound shader ignored");
+		return;
+	}
+	count -= count % 3;
+	if (count == 0 || m_ViewportWidth == 0 || m_ViewportHeight == 0) {
+		return;
+	}
+	DrawState state{ &shader->GetStages(), {} };
+	if (state.Stages->Setup) {
+		state.Stages->Setup(shader->GetUniforms(), state.Constants);
+	}
+
+	// 1. 顶点阶段：只处理本次绘制引用到的顶点范围
+	auto vertexAt = [&](uint32_t k) -> uint32_t {
+		return indices ? static_cast<uint32_t>(static_cast<int64_t>(indices[k]) + baseVertex) : first + k;
+	};
+	uint32_t minVertex = vertexAt(0);
+	uint32_t maxVertex = minVertex;
+	if (indices) {
+		for (uint32_t k = 1; k < count; ++k) {
+			const uint32_t vertex = vertexAt(k);
+			minVertex = std::min(minVertex, vertex);
+			maxVertex = std::max(maxVertex, vertex);
+		}
+	} else {
+		maxVertex = first + count - 1;
+	}
+	ShadeVertices(vertexArray, state, minVertex, maxVertex - minVertex + 1, instanceIndex);
+
+	// 2. 图元装配与分箱（按提交顺序，保证混合结果确定）
+	m_Triangles.clear();
+	m_TriangleVaryings.clear();
+	for (uint32_t k = 0; k < count; k += 3) {
+		const ClipVertex* vertices[3] = {
+			&m_Vertices[vertexAt(k) - m_FirstVertex],
+			&m_Vertices[vertexAt(k + 1) - m_FirstVertex],
+			&m_Vertices[vertexAt(k + 2) - m_FirstVertex]
+		};
+		SetupTriangle(vertices, state.Stages->VaryingCount);
+	}
+	for (uint32_t tile : m_ActiveTiles) {
+		m_TileBins[tile].clear();
+	}
+	m_ActiveTiles.clear();
+	for (uint32_t i = 0; i < m_Triangles.size(); ++i) {
+		const RasterTriangle& triangle = m_Triangles[i];
+		for (uint32_t tileY = static_cast<uint32_t>(triangle.MinY) / TileSize; tileY <= static_cast<uint32_t>(triangle.MaxY) / TileSize; ++tileY) {
+			for (uint32_t tileX = static_cast<uint32_t>(triangle.MinX) / TileSize; tileX <= static_cast<uint32_t>(triangle.MaxX) / TileSize; ++tileX) {
+				std::vector<uint32_t>& bin = m_TileBins[tileY * m_TilesX + tileX];
+				if (bin.empty()) {
+					m_ActiveTiles.push_back(tileY * m_TilesX + tileX);
+				}
+				bin.push_back(i);
+			}
+		}
+	}
+
+	// 3. 各瓦片并行光栅化
+	JobContext context;
+	JobSystem::Dispatch(context, static_cast<uint32_t>(m_ActiveTiles.size()), 1, [this, &state](JobDispatchArgs args) {
+		const uint32_t tile = m_ActiveTiles[args.JobIndex];
+		RasterizeTile(tile % m_TilesX, tile / m_TilesX, state);
+	});
+	JobSystem::Wait(context);
+}
+
+void SoftwareRendererAPI::ShadeVertices(const SoftwareVertexArray& vertexArray, const DrawState& state, uint32_t firstVertex,
+	uint32_t vertexCount, uint32_t instanceIndex) {
+	GatherAttributes(vertexArray, s_AttributeSources);
+	m_FirstVertex = firstVertex;
+	m_Vertices.resize(vertexCount);
+	JobContext context;
+	JobSystem::Dispatch(context, (vertexCount + s_VertexGroupSize - 1) / s_VertexGroupSize, 1,
+		[this, &state, firstVertex, vertexCount, instanceIndex](JobDispatchArgs args) {
+		Vec4 attributes[s_MaxAttributes];
+		const uint32_t attributeCount = static_cast<uint32_t>(s_AttributeSources.size());
+		const uint32_t begin = args.JobIndex * s_VertexGroupSize;
+		const uint32_t end = std::min(begin + s_VertexGroupSize, vertexCount);
+		for (uint32_t i = begin; i < end; ++i) {
+			const uint32_t vertex = firstVertex + i;
+			for (uint32_t attribute = 0; attribute < attributeCount; ++attribute) {
+				attributes[attribute] = DecodeAttribute(s_AttributeSources[attribute], vertex);
+			}
+			const SoftwareVertexInput input{ attributes, attributeCount, vertex, instanceIndex };
+			ClipVertex& output = m_Vertices[i];
+			output.Position = state.Stages->Vertex(state.Constants, input, output.Varyings);
+		}
+	});
+	JobSystem::Wait(context);
+}
+
+void SoftwareRendererAPI::SetupTriangle(const ClipVertex* vertices[3], uint32_t varyingCount) {
+	// 按近平面 (z >= -w) 裁剪，得到至多 4 个顶点的多边形
+	ClipVertex clipped[4];
+	const ClipVertex* polygon[4];
+	uint32_t polygonCount = 0;
+	uint32_t clippedCount = 0;
+	const float distances[3] = {
+		vertices[0]->Position.z + vertices[0]->Position.w,
+		vertices[1]->Position.z + vertices[1]->Position.w,
+		vertices[2]->Position.z + vertices[2]->Position.w
+	};
+	if (distances[0] >= 0.0f && distances[1] >= 0.0f && distances[2] >= 0.0f) {
+		polygon[0] = vertices[0];
+		polygon[1] = vertices[1];
+		polygon[2] = vertices[2];
+		polygonCount = 3;
+	} else {
+		for (uint32_t i = 0; i < 3; ++i) {
+			const uint32_t next = (i + 1) % 3;
+			if (distances[i] >= 0.0f) {
+				polygon[polygonCount++] = vertices[i];
+			}
+			if ((distances[i] >= 0.0f) != (distances[next] >= 0.0f)) {
+				const float t = distances[i] / (distances[i] - distances[next]);
+				ClipVertex& vertex = clipped[clippedCount++];
+				vertex.Position = Lerp(vertices[i]->Position, vertices[next]->Position, t);
+				for (uint32_t v = 0; v < varyingCount; ++v) {
+					vertex.Varyings[v] = Lerp(vertices[i]->Varyings[v], vertices[next]->Varyings[v], t);
+				}
+				polygon[polygonCount++] = &vertex;
+			}
+		}
+	}
+
+	const float viewportX = static_cast<float>(m_ViewportX);
+	const float viewportY = static_cast<float>(m_ViewportY);
+	const float viewportWidth = static_cast<float>(m_ViewportWidth);
+	const float viewportHeight = static_cast<float>(m_ViewportHeight);
+	const float viewportRight = static_cast<float>(m_ViewportX + m_ViewportWidth - 1);
+	const float viewportTop = static_cast<float>(m_ViewportY + m_ViewportHeight - 1);
+	// 扇形拆分为三角形
+	for (uint32_t i = 1; i + 1 < polygonCount; ++i) {
+		const ClipVertex* corners[3] = { polygon[0], polygon[i], polygon[i + 1] };
+		RasterTriangle triangle;
+		bool degenerate = false;
+		for (uint32_t corner = 0; corner < 3; ++corner) {
+			const Vec4& position = corners[corner]->Position;
+			if (position.w <= 1e-7f) {
+				degenerate = true;
+				break;
+			}
+			const float inverseW = 1.0f / position.w;
+			triangle.X[corner] = viewportX + (position.x * inverseW * 0.5f + 0.5f) * viewportWidth;
+			triangle.Y[corner] = viewportY + (position.y * inverseW * 0.5f + 0.5f) * viewportHeight;
+			triangle.Z[corner] = position.z * inverseW * 0.5f + 0.5f;
+			triangle.InverseW[corner] = inverseW;
+		}
+		if (degenerate) {
+			continue;
+		}
+		const float area = (triangle.X[1] - triangle.X[0]) * (triangle.Y[2] - triangle.Y[0])
+			- (triangle.Y[1] - triangle.Y[0]) * (triangle.X[2] - triangle.X[0]);
+		if (area == 0.0f || std::isnan(area)) {
+			continue;
+		}
+		// 统一为正面积（两种环绕方向都绘制，与 GL 默认不剔除一致）
+		if (area < 0.0f) {
+			std::swap(corners[1], corners[2]);
+			std::swap(triangle.X[1], triangle.X[2]);
+			std::swap(triangle.Y[1], triangle.Y[2]);
+			std::swap(triangle.Z[1], triangle.Z[2]);
+			std::swap(triangle.InverseW[1], triangle.InverseW[2]);
+		}
+		// 在浮点下限制到视口，远在屏幕外的顶点转换为整数时不会溢出
+		const float minX = std::clamp(std::floor(std::min({ triangle.X[0], triangle.X[1], triangle.X[2] })), viewportX, viewportRight);
+		const float maxX = std::clamp(std::ceil(std::max({ triangle.X[0], triangle.X[1], triangle.X[2] })), viewportX, viewportRight);
+		const float minY = std::clamp(std::floor(std::min({ triangle.Y[0], triangle.Y[1], triangle.Y[2] })), viewportY, viewportTop);
+		const float maxY = std::clamp(std::ceil(std::max({ triangle.Y[0], triangle.Y[1], triangle.Y[2] })), viewportY, viewportTop);
+		if (std::max({ triangle.X[0], triangle.X[1], triangle.X[2] }) < viewportX
+			|| std::min({ triangle.X[0], triangle.X[1], triangle.X[2] }) > viewportRight + 1.0f
+			|| std::max({ triangle.Y[0], triangle.Y[1], triangle.Y[2] }) < viewportY
+			|| std::min({ triangle.Y[0], triangle.Y[1], triangle.Y[2] }) > viewportTop + 1.0f) {
+			continue;
+		}
+		triangle.MinX = static_cast<int32_t>(minX);
+		triangle.MaxX = static_cast<int32_t>(maxX);
+		triangle.MinY = static_cast<int32_t>(minY);
+		triangle.MaxY = static_cast<int32_t>(maxY);
+		triangle.VaryingOffset = static_cast<uint32_t>(m_TriangleVaryings.size());
+		for (uint32_t corner = 0; corner < 3; ++corner) {
+			for (uint32_t v = 0; v < varyingCount; ++v) {
+				m_TriangleVaryings.push_back(corners[corner]->Varyings[v] * triangle.InverseW[corner]);
+			}
+		}
+		m_Triangles.push_back(triangle);
+	}
+}
+
+void SoftwareRendererAPI::RasterizeTile(uint32_t tileX, uint32_t tileY, const DrawState& state) {
+	const int32_t minX = static_cast<int32_t>(tileX * TileSize);
+	const int32_t minY = static_cast<int32_t>(tileY * TileSize);
+	const int32_t maxX = std::min(minX + static_cast<int32_t>(TileSize), static_cast<int32_t>(m_Framebuffer.Width)) - 1;
+	const int32_t maxY = std::min(minY + static_cast<int32_t>(TileSize), static_cast<int32_t>(m_Framebuffer.Height)) - 1;
+	for (uint32_t index : m_TileBins[tileY * m_TilesX + tileX]) {
+		RasterizeTriangle(m_Triangles[index], minX, minY, maxX, maxY, state);
+	}
+}
+
+// top-left 规则：左边与上边上的像素属于三角形，右边与下边上的不属于
+static inline bool IsTopLeftEdge(float a, float b) {
+	return a > 0.0f || (a == 0.0f && b < 0.0f);
+}
+
+static inline __m128 EdgeInside(__m128 edge, bool topLeft) {
+	return topLeft ? _mm_cmpge_ps(edge, _mm_setzero_ps()) : _mm_cmpgt_ps(edge, _mm_setzero_ps());
+}
+
+void SoftwareRendererAPI::RasterizeTriangle(const RasterTriangle& triangle, int32_t tileMinX, int32_t tileMinY,
+	int32_t tileMaxX, int32_t tileMaxY, const DrawState& state) {
+	const int32_t firstX = std::max(triangle.MinX, tileMinX);
+	const int32_t minX = firstX & ~3;
+	const int32_t maxX = std::min(triangle.MaxX, tileMaxX);
+	const int32_t minY = std::max(triangle.MinY, tileMinY);
+	const int32_t maxY = std::min(triangle.MaxY, tileMaxY);
+	if (minX > maxX || minY > maxY) {
+		return;
+	}
+	const float* x = triangle.X;
+	const float* y = triangle.Y;
+	// 边函数 E_i(x, y) = A_i * x + B_i * y + C_i，E_i 为对着顶点 i 的边，E_i / area 即顶点 i 的重心坐标
+	const float a0 = y[1] - y[2], b0 = x[2] - x[1], c0 = -(a0 * x[1] + b0 * y[1]);
+	const float a1 = y[2] - y[0], b1 = x[0] - x[2], c1 = -(a1 * x[2] + b1 * y[2]);
+	const float a2 = y[0] - y[1], b2 = x[1] - x[0], c2 = -(a2 * x[0] + b2 * y[0]);
+	const bool topLeft0 = IsTopLeftEdge(a0, b0), topLeft1 = IsTopLeftEdge(a1, b1), topLeft2 = IsTopLeftEdge(a2, b2);
+	const float inverseArea = 1.0f / (a2 * x[2] + b2 * y[2] + c2);
+
+	const uint32_t varyingCount = state.Stages->VaryingCount;
+	const float* triangleVaryings = m_TriangleVaryings.data() + triangle.VaryingOffset;
+	const __m128 a0x4 = _mm_set1_ps(a0), a1x4 = _mm_set1_ps(a1), a2x4 = _mm_set1_ps(a2);
+	const __m128 z0x4 = _mm_set1_ps(triangle.Z[0]), z1x4 = _mm_set1_ps(triangle.Z[1]), z2x4 = _mm_set1_ps(triangle.Z[2]);
+	const __m128 inverseArea4 = _mm_set1_ps(inverseArea);
+	const __m128 laneOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+	const uint32_t width = m_Framebuffer.Width;
+	float varyings[SoftwareShaderStages::MaxVaryings];
+
+	for (int32_t row = minY; row <= maxY; ++row) {
+		const float py = static_cast<float>(row) + 0.5f;
+		const __m128 row0 = _mm_set1_ps(b0 * py + c0);
+		const __m128 row1 = _mm_set1_ps(b1 * py + c1);
+		const __m128 row2 = _mm_set1_ps(b2 * py + c2);
+		uint32_t* colorRow = m_Framebuffer.Color.data() + static_cast<size_t>(row) * width;
+		float* depthRow = m_Framebuffer.Depth.data() + static_cast<size_t>(row) * width;
+		for (int32_t column = minX; column <= maxX; column += 4) {
+			const __m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(column)), laneOffsets);
+			const __m128 e0 = _mm_add_ps(_mm_mul_ps(a0x4, px), row0);
+			const __m128 e1 = _mm_add_ps(_mm_mul_ps(a1x4, px), row1);
+			const __m128 e2 = _mm_add_ps(_mm_mul_ps(a2x4, px), row2);
+			__m128 inside = _mm_and_ps(_mm_and_ps(EdgeInside(e0, topLeft0), EdgeInside(e1, topLeft1)), EdgeInside(e2, topLeft2));
+			int mask = _mm_movemask_ps(inside);
+			if (mask == 0) {
+				continue;
+			}
+			// 窗口深度在屏幕空间中是线性的，直接按重心坐标插值
+			const __m128 z = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e0, z0x4), _mm_mul_ps(e1, z1x4)), _mm_mul_ps(e2, z2x4)), inverseArea4);
+			alignas(16) float depths[4];
+			_mm_store_ps(depths, z);
+			// 起点按 4 对齐后，组内可能有包围矩形（已限制到视口）之外的通道，不处理
+			const int32_t firstLane = std::max(firstX - column, 0);
+			const int32_t laneCount = std::min(4, maxX - column + 1);
+			mask &= ((1 << laneCount) - 1) & ~((1 << firstLane) - 1);
+			if (m_DepthTest) {
+				for (int32_t lane = 0; lane < laneCount; ++lane) {
+					if (!(depths[lane] < depthRow[column + lane])) {
+						mask &= ~(1 << lane);
+					}
+				}
+			}
+			if (mask == 0) {
+				continue;
+			}
+			alignas(16) float weights[3][4];
+			_mm_store_ps(weights[0], _mm_mul_ps(e0, inverseArea4));
+			_mm_store_ps(weights[1], _mm_mul_ps(e1, inverseArea4));
+			_mm_store_ps(weights[2], _mm_mul_ps(e2, inverseArea4));
+			for (int32_t lane = 0; lane < laneCount; ++lane) {
+				if (!(mask & (1 << lane))) {
+					continue;
+				}
+				// 透视校正：插值 varying / w 与 1 / w，再相除
+				const float w0 = weights[0][lane], w1 = weights[1][lane], w2 = weights[2][lane];
+				const float w = 1.0f / (w0 * triangle.InverseW[0] + w1 * triangle.InverseW[1] + w2 * triangle.InverseW[2]);
+				for (uint32_t v = 0; v < varyingCount; ++v) {
+					varyings[v] = (w0 * triangleVaryings[v] + w1 * triangleVaryings[varyingCount + v]
+						+ w2 * triangleVaryings[2 * varyingCount + v]) * w;
+				}
+				const Vec4 source = glm::clamp(state.Stages->Fragment(state.Constants, varyings), Vec4(0.0f), Vec4(1.0f));
+				uint32_t& destination = colorRow[column + lane];
+				destination = PackColor(source * source.a + UnpackColor(destination) * (1.0f - source.a));
+				if (m_DepthTest) {
+					depthRow[column + lane] = depths[lane];
+				}
+			}
+		}
+	}
+}
+}
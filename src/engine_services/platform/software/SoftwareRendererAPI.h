@@ -0,0 +1,118 @@
+#pragma once
+#include "engine_services/renderer/RendererAPI.h"
+#include "SoftwareShader.h"
+#include <vector>
+
+// ---------------------------------------------------------------------
+// 类: SoftwareRendererAPI
+// 作用: 不依赖 GPU 的软件渲染后端
+// 描述: 把三角形光栅化到系统内存中的 SoftwareFramebuffer，用于没有 GPU 的构建与测试机器，
+//       也可以作为图形 API 不可用时的后备。一次绘制分为：
+//       1. 顶点阶段：所引用的顶点范围按块在 JobSystem 上并行执行 SoftwareShaderStages::Vertex；
+//       2. 图元装配：按近平面裁剪，变换到窗口坐标，按包围矩形分入 TileSize 的瓦片；
+//       3. 光栅化：各瓦片并行，每个瓦片按提交顺序处理其中的三角形，
+//          边函数与深度以 SSE 每次求 4 个像素，覆盖的像素再逐个执行片元阶段并混合。
+//       每个任务只写自己的瓦片，绘制结果与线程数无关；采用 top-left 填充规则，共享边的像素只绘制一次。
+//
+//       状态与 OpenGLRendererAPI::Init 一致：混合开启 (SrcAlpha, OneMinusSrcAlpha)，深度测试默认关闭。
+//       不支持纹理、帧缓冲对象与 GPU 计时，这些资源的 Create 在软件后端下会断言失败。
+//       读取 GetFramebuffer 之前需保证没有正在执行的渲染命令（单线程模式，或先调用 RenderThread::Flush）。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class SoftwareVertexArray;
+
+// 默认帧缓冲：左下角为原点，逐行排列
+struct SoftwareFramebuffer {
+	uint32_t Width = 0;
+	uint32_t Height = 0;
+	std::vector<uint32_t> Color;  // RGBA8，R 在最低字节
+	std::vector<float> Depth;     // [0, 1]，1 为远平面
+
+	inline uint32_t GetPixel(uint32_t x, uint32_t y) const { return Color[y * Width + x]; }
+	inline float GetDepth(uint32_t x, uint32_t y) const { return Depth[y * Width + x]; }
+};
+
+class SoftwareRendererAPI : public RendererAPI {
+public:
+	// 瓦片的边长（像素），必须是 4 的倍数
+	static constexpr uint32_t TileSize = 64;
+
+	SoftwareRendererAPI();
+	virtual ~SoftwareRendererAPI();
+
+	virtual void Init() override;
+	virtual void Shutdown() override {}
+	// 默认帧缓冲随视口增大，容纳 (x + width) × (y + height)
+	virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) override;
+	virtual void SetClearColor(const Vec4& color) override { m_ClearColor = color; }
+	virtual void Clear() override;
+	virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) override;
+	virtual void DrawArrays(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0) override;
+	virtual void DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t firstIndex, int32_t baseVertex) override;
+	virtual void DrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<IndirectBuffer>& indirectBuffer,
+		uint32_t drawCount, uint32_t firstCommand = 0) override;
+	virtual void PushDebugGroup(const char*) override {}
+	virtual void PopDebugGroup() override {}
+	virtual void EndFrame() override {}
+
+	// 深度测试 (Less) 与深度写入
+	inline void SetDepthTest(bool enabled) { m_DepthTest = enabled; }
+	inline const SoftwareFramebuffer& GetFramebuffer() const { return m_Framebuffer; }
+
+	// 当前的软件后端，RendererAPI 不是 Software 或 Renderer 尚未初始化时为 nullptr
+	static SoftwareRendererAPI* Get();
+private:
+	// 裁剪空间的顶点
+	struct ClipVertex {
+		Vec4 Position;
+		float Varyings[SoftwareShaderStages::MaxVaryings];
+	};
+	// 窗口坐标的三角形，Varyings 已除以 w
+	struct RasterTriangle {
+		float X[3];
+		float Y[3];
+		float Z[3];
+		float InverseW[3];
+		uint32_t VaryingOffset;   // 在 m_TriangleVaryings 中的起始位置，3 * VaryingCount 个
+		int32_t MinX, MinY, MaxX, MaxY;
+	};
+	struct DrawState {
+		const SoftwareShaderStages* Stages;
+		SoftwareShaderConstants Constants;
+	};
+
+	/**
+	 * @brief 绘制 count 个顶点组成的三角形列表
+	 *
+	 * indices 为空时第 k 个顶点是 first + k，否则是 indices[k] + baseVertex。
+	 */
+	void Draw(const SoftwareVertexArray& vertexArray, const uint32_t* indices, uint32_t count, uint32_t first,
+		int32_t baseVertex, uint32_t instanceIndex);
+	void ShadeVertices(const SoftwareVertexArray& vertexArray, const DrawState& state, uint32_t firstVertex, uint32_t vertexCount,
+		uint32_t instanceIndex);
+	void SetupTriangle(const ClipVertex* vertices[3], uint32_t varyingCount);
+	void RasterizeTile(uint32_t tileX, uint32_t tileY, const DrawState& state);
+	void RasterizeTriangle(const RasterTriangle& triangle, int32_t tileMinX, int32_t tileMinY, int32_t tileMaxX, int32_t tileMaxY,
+		const DrawState& state);
+private:
+	SoftwareFramebuffer m_Framebuffer;
+	Vec4 m_ClearColor{ 0.0f, 0.0f, 0.0f, 1.0f };
+	uint32_t m_ViewportX = 0;
+	uint32_t m_ViewportY = 0;
+	uint32_t m_ViewportWidth = 0;
+	uint32_t m_ViewportHeight = 0;
+	bool m_DepthTest = false;
+
+	// 每次绘制重用的临时数据
+	std::vector<ClipVertex> m_Vertices;      // 顶点范围 [m_FirstVertex, m_FirstVertex + size) 的输出
+	uint32_t m_FirstVertex = 0;
+	std::vector<RasterTriangle> m_Triangles;
+	std::vector<float> m_TriangleVaryings;
+	std::vector<std::vector<uint32_t>> m_TileBins;
+	std::vector<uint32_t> m_ActiveTiles;
+	uint32_t m_TilesX = 0;
+	uint32_t m_TilesY = 0;
+};
+}
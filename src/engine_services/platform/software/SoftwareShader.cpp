@@ -0,0 +1,104 @@
+#include "SoftwareShader.h"
+#include "engine_services/renderer/RendererStatistics.h"
+#include "core/Log.h"
+#include <mutex>
+
+namespace GE {
+
+static std::mutex s_RegistryMutex;
+static std::unordered_map<std::string, SoftwareShaderStages> s_Registry;
+static const SoftwareShader* s_BoundShader = nullptr;
+
+// 未注册时使用：位置 = u_ViewProjection * u_Transform * 属性 0，颜色 = u_Color（默认白色）
+static SoftwareShaderStages CreateDefaultStages() {
+	SoftwareShaderStages stages;
+	stages.Setup = [](const SoftwareUniforms& uniforms, SoftwareShaderConstants& constants) {
+		constants.Matrices[0] = uniforms.GetMat4("u_ViewProjection") * uniforms.GetMat4("u_Transform");
+		constants.Vectors[0] = uniforms.GetVector("u_Color", Vec4(1.0f));
+	};
+	stages.Vertex = [](const SoftwareShaderConstants& constants, const SoftwareVertexInput& input, float*) {
+		const Vec4 position = input.AttributeCount > 0 ? input.Attributes[0] : Vec4(0.0f, 0.0f, 0.0f, 1.0f);
+		return constants.Matrices[0] * position;
+	};
+	stages.Fragment = [](const SoftwareShaderConstants& constants, const float*) {
+		return constants.Vectors[0];
+	};
+	return stages;
+}
+
+static SoftwareShaderStages FindStages(const std::string& name) {
+	{
+		std::lock_guard<std::mutex> lock(s_RegistryMutex);
+		auto it = s_Registry.find(name);
+		if (it != s_Registry.end()) {
+			return it->second;
+		}
+	}
+	LOG_WARN_ENGINE("No software shader stages registered for '{0}', using the default stages", name);
+	return CreateDefaultStages();
+}
+
+int SoftwareUniforms::GetInt(const std::string& name, int defaultValue) const {
+	auto it = m_Ints.find(name);
+	return it != m_Ints.end() && !it->second.empty() ? it->second[0] : defaultValue;
+}
+
+const std::vector<int>* SoftwareUniforms::GetIntArray(const std::string& name) const {
+	auto it = m_Ints.find(name);
+	return it != m_Ints.end() ? &it->second : nullptr;
+}
+
+Vec4 SoftwareUniforms::GetVector(const std::string& name, const Vec4& defaultValue) const {
+	auto it = m_Vectors.find(name);
+	return it != m_Vectors.end() ? it->second : defaultValue;
+}
+
+Mat4 SoftwareUniforms::GetMat4(const std::string& name, const Mat4& defaultValue) const {
+	auto it = m_Matrices.find(name);
+	return it != m_Matrices.end() ? it->second : defaultValue;
+}
+
+SoftwareShader::SoftwareShader(const std::string& filepath) {
+	// 与 OpenGLShader 相同：名称为文件名去掉扩展名
+	auto lastSlash = filepath.find_last_of("/\\");
+	lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
+	auto lastDot = filepath.rfind('.');
+	auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
+	m_Name = filepath.substr(lastSlash, count);
+	m_Stages = FindStages(m_Name);
+}
+
+SoftwareShader::SoftwareShader(const std::string& name, const std::string&, const std::string&)
+	: m_Name(name), m_Stages(FindStages(name)) {
+}
+
+SoftwareShader::SoftwareShader(const std::string& name, const SoftwareShaderStages& stages)
+	: m_Name(name), m_Stages(stages) {
+}
+
+SoftwareShader::~SoftwareShader() {
+	Unbind();
+}
+
+void SoftwareShader::Bind() const {
+	s_BoundShader = this;
+	RendererStatistics::Current().ShaderBinds++;
+}
+
+void SoftwareShader::Unbind() const {
+	if (s_BoundShader == this) {
+		s_BoundShader = nullptr;
+	}
+}
+
+void SoftwareShader::RegisterStages(const std::string& name, const SoftwareShaderStages& stages) {
+	ASSERT_ENGINE(stages.Vertex && stages.Fragment, "Software shader stages require a vertex and a fragment stage!");
+	ASSERT_ENGINE(stages.VaryingCount <= SoftwareShaderStages::MaxVaryings, "Too many software shader varyings!");
+	std::lock_guard<std::mutex> lock(s_RegistryMutex);
+	s_Registry[name] = stages;
+}
+
+const SoftwareShader* SoftwareShader::GetBound() {
+	return s_BoundShader;
+}
+}
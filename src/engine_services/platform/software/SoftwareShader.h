@@ -0,0 +1,97 @@
+#pragma once
+#include "engine_services/renderer/Shader.h"
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// ---------------------------------------------------------------------
+// 类: SoftwareShader
+// 作用: 软件渲染后端的着色器
+// 描述: 可编程阶段是普通的 C++ 可调用对象（SoftwareShaderStages），按着色器名称注册：
+//       Shader::Create 在软件后端下不编译 GLSL，而是按名称（文件名去掉扩展名，或显式给出的名称）
+//       查找已注册的阶段，同一套创建与提交代码因此可以在两个后端上运行。
+//       没有注册的着色器使用默认阶段：位置为 u_ViewProjection * u_Transform * 属性 0，颜色为 u_Color。
+//
+//       Set* 写入的 uniform 按名称保存；每次绘制开始时 Setup 阶段把需要的值读入
+//       SoftwareShaderConstants，顶点与片元阶段只读取它，避免逐顶点、逐像素按名称查找。
+//       顶点与片元阶段在多个工作线程上同时调用，不能修改共享状态。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+// Setup 阶段写入、顶点与片元阶段读取的常量
+struct SoftwareShaderConstants {
+	Mat4 Matrices[4]{ Mat4(1.0f), Mat4(1.0f), Mat4(1.0f), Mat4(1.0f) };
+	Vec4 Vectors[8]{};
+	int32_t Ints[8]{};
+};
+
+struct SoftwareVertexInput {
+	const Vec4* Attributes;   // 按属性位置解码为 Vec4（缺少的分量为 0，w 为 1）
+	uint32_t AttributeCount;
+	uint32_t VertexIndex;     // 相当于 gl_VertexID（已加上 baseVertex）
+	uint32_t InstanceIndex;   // 相当于 gl_InstanceID + baseInstance
+};
+
+class SoftwareUniforms {
+public:
+	void SetInt(const std::string& name, int value) { m_Ints[name] = { value }; }
+	void SetIntArray(const std::string& name, const int* values, uint32_t count) { m_Ints[name].assign(values, values + count); }
+	void SetVector(const std::string& name, const Vec4& value) { m_Vectors[name] = value; }
+	void SetMat4(const std::string& name, const Mat4& value) { m_Matrices[name] = value; }
+
+	int GetInt(const std::string& name, int defaultValue = 0) const;
+	const std::vector<int>* GetIntArray(const std::string& name) const;
+	// SetFloat / SetFloat2 写入的值读作 Vec4，其余分量为 0
+	Vec4 GetVector(const std::string& name, const Vec4& defaultValue = Vec4(0.0f)) const;
+	Mat4 GetMat4(const std::string& name, const Mat4& defaultValue = Mat4(1.0f)) const;
+private:
+	std::unordered_map<std::string, std::vector<int>> m_Ints;
+	std::unordered_map<std::string, Vec4> m_Vectors;
+	std::unordered_map<std::string, Mat4> m_Matrices;
+};
+
+struct SoftwareShaderStages {
+	// 每个顶点输出、在三角形内插值的 float 个数，不超过 MaxVaryings
+	static constexpr uint32_t MaxVaryings = 16;
+	uint32_t VaryingCount = 0;
+
+	// 每次绘制开始时在渲染线程上调用一次
+	std::function<void(const SoftwareUniforms& uniforms, SoftwareShaderConstants& constants)> Setup;
+	// 返回裁剪空间位置，并写出 VaryingCount 个 varying
+	std::function<Vec4(const SoftwareShaderConstants& constants, const SoftwareVertexInput& input, float* varyings)> Vertex;
+	// varyings 已做透视校正插值；返回非预乘的 RGBA，按 SrcAlpha / OneMinusSrcAlpha 混合
+	std::function<Vec4(const SoftwareShaderConstants& constants, const float* varyings)> Fragment;
+};
+
+class SoftwareShader : public Shader {
+public:
+	SoftwareShader(const std::string& filepath);
+	SoftwareShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
+	SoftwareShader(const std::string& name, const SoftwareShaderStages& stages);
+	virtual ~SoftwareShader();
+
+	virtual void Bind() const override;
+	virtual void Unbind() const override;
+	virtual void SetInt(const std::string& name, int value) override { m_Uniforms.SetInt(name, value); }
+	virtual void SetIntArray(const std::string& name, int* values, uint32_t count) override { m_Uniforms.SetIntArray(name, values, count); }
+	virtual void SetFloat(const std::string& name, float value) override { m_Uniforms.SetVector(name, Vec4(value, 0.0f, 0.0f, 0.0f)); }
+	virtual void SetFloat2(const std::string& name, const Vec2& value) override { m_Uniforms.SetVector(name, Vec4(value, 0.0f, 0.0f)); }
+	virtual void SetFloat4(const std::string& name, const Vec4& value) override { m_Uniforms.SetVector(name, value); }
+	virtual void SetMat4(const std::string& name, const Mat4& value) override { m_Uniforms.SetMat4(name, value); }
+	virtual const std::string& GetName() const override { return m_Name; }
+
+	inline const SoftwareShaderStages& GetStages() const { return m_Stages; }
+	inline const SoftwareUniforms& GetUniforms() const { return m_Uniforms; }
+
+	// 为名为 name 的着色器注册阶段，之后以该名称创建的着色器都使用它们（已创建的不受影响）
+	static void RegisterStages(const std::string& name, const SoftwareShaderStages& stages);
+	// 最近一次 Bind 的着色器，由 SoftwareRendererAPI 在绘制时读取
+	static const SoftwareShader* GetBound();
+private:
+	std::string m_Name;
+	SoftwareShaderStages m_Stages;
+	SoftwareUniforms m_Uniforms;
+};
+}
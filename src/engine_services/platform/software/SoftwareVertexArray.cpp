@@ -0,0 +1,14 @@
+#include "SoftwareVertexArray.h"
+#include "engine_services/renderer/RendererStatistics.h"
+
+namespace GE {
+
+void SoftwareVertexArray::Bind() const {
+	RendererStatistics::Current().VertexArrayBinds++;
+}
+
+void SoftwareVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) {
+	ASSERT_ENGINE(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
+	m_VertexBuffers.push_back(vertexBuffer);
+}
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include "engine_services/renderer/VertexArray.h"
+
+// ---------------------------------------------------------------------
+// 类: SoftwareVertexArray
+// 作用: 软件渲染后端的顶点数组
+// 描述: 只记录顶点缓冲与索引缓冲。属性位置与 OpenGLVertexArray 的分配方式相同：
+//       按添加顺序依次编号，矩阵属性按列占用多个位置。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class SoftwareVertexArray : public VertexArray {
+public:
+	virtual void Bind() const override;
+	virtual void Unbind() const override {}
+	virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+	virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override { m_IndexBuffer = indexBuffer; }
+	virtual const std::vector<Ref<VertexBuffer>>& GetVertexBuffers() const override { return m_VertexBuffers; }
+	virtual const Ref<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; }
+private:
+	std::vector<Ref<VertexBuffer>> m_VertexBuffers;
+	Ref<IndexBuffer> m_IndexBuffer;
+};
+}
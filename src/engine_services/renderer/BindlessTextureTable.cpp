@@ -0,0 +1,107 @@
+#include "BindlessTextureTable.h"
+#include "Renderer.h"
+#include "RenderThread.h"
+#include "engine_services/platform/opengl/OpenGLContext.h"
+#include <algorithm>
+
+namespace GE {
+
+void BindlessTextureTable::RenderState::MarkDirty(uint32_t index) {
+	DirtyMin = std::min(DirtyMin, index);
+	DirtyMax = std::max(DirtyMax, index + 1);
+}
+
+BindlessTextureTable::BindlessTextureTable(uint32_t capacity)
+	: m_Capacity(capacity) {
+	ASSERT_ENGINE(capacity > 0, "BindlessTextureTable capacity must be non-zero!");
+	m_Buffer = StorageBuffer::Create(capacity * static_cast<uint32_t>(sizeof(uint64_t)));
+	m_RenderState = CreateRef<RenderState>();
+	m_RenderState->Textures.reserve(capacity);
+	m_RenderState->Handles.reserve(capacity);
+}
+
+uint32_t BindlessTextureTable::Register(const Ref<Texture>& texture) {
+	ASSERT_ENGINE(texture, "Cannot register a null texture!");
+	auto it = m_Indices.find(texture.get());
+	if (it != m_Indices.end()) {
+		return it->second;
+	}
+
+	uint32_t index = InvalidIndex;
+	if (!m_FreeIndices.empty()) {
+		index = m_FreeIndices.back();
+		m_FreeIndices.pop_back();
+	} else if (m_Count < m_Capacity) {
+		index = m_Count++;
+	} else {
+		LOG_WARN_ENGINE("BindlessTextureTable is full ({0} textures)", m_Capacity);
+		return InvalidIndex;
+	}
+	m_Indices[texture.get()] = index;
+	// 句柄在 Update 中取得
+	RenderThread::Submit([state = m_RenderState, texture, index]() {
+		if (index >= state->Textures.size()) {
+			state->Textures.resize(index + 1);
+			state->Handles.resize(index + 1, 0);
+		}
+		state->Textures[index] = texture;
+		state->Handles[index] = 0;
+	});
+	return index;
+}
+
+void BindlessTextureTable::Unregister(const Ref<Texture>& texture) {
+	auto it = m_Indices.find(texture.get());
+	if (it == m_Indices.end()) {
+		return;
+	}
+	const uint32_t index = it->second;
+	m_Indices.erase(it);
+	m_FreeIndices.push_back(index);
+	RenderThread::Submit([state = m_RenderState, index]() {
+		state->Textures[index] = nullptr;
+		// 清零表项，误用已注销下标的着色器不会采样到已销毁的纹理
+		if (state->Handles[index] != 0) {
+			state->Handles[index] = 0;
+			state->MarkDirty(index);
+		}
+	});
+}
+
+void BindlessTextureTable::Update() {
+	RenderThread::Submit([state = m_RenderState, buffer = m_Buffer]() {
+		for (uint32_t i = 0; i < static_cast<uint32_t>(state->Textures.size()); ++i) {
+			if (!state->Textures[i]) {
+				continue;
+			}
+			const uint64_t handle = state->Textures[i]->GetBindlessHandle();
+			if (handle != state->Handles[i]) {
+				state->Handles[i] = handle;
+				state->MarkDirty(i);
+			}
+		}
+		if (state->DirtyMin >= state->DirtyMax) {
+			return;
+		}
+		const uint32_t stride = static_cast<uint32_t>(sizeof(uint64_t));
+		buffer->SetData(state->Handles.data() + state->DirtyMin, (state->DirtyMax - state->DirtyMin) * stride, state->DirtyMin * stride);
+		state->DirtyMin = UINT32_MAX;
+		state->DirtyMax = 0;
+	});
+}
+
+void BindlessTextureTable::Bind(uint32_t binding) const {
+	RenderThread::Submit([buffer = m_Buffer, binding]() { buffer->Bind(binding); });
+}
+
+bool BindlessTextureTable::IsSupported() {
+	switch (Renderer::GetAPI()) {
+		case RendererAPI::API::None:    return false;
+		case RendererAPI::API::OpenGL:  return OpenGLContext::GetCapabilities().BindlessTexture;
+		case RendererAPI::API::Software: return false;
+		case RendererAPI::API::Null:    return false;
+	}
+	ASSERT_ENGINE(false, "Unknown RendererAPI!");
+	return false;
+}
+}
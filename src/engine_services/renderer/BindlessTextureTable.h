@@ -0,0 +1,68 @@
+#pragma once
+#include "Buffer.h"
+#include "Texture.h"
+#include <unordered_map>
+#include <vector>
+
+// ---------------------------------------------------------------------
+// 类: BindlessTextureTable
+// 作用: 无绑定纹理句柄表 (ARB_bindless_texture)
+// 描述: 把纹理的 64 位句柄按注册顺序写入一个 SSBO，着色器按下标直接采样，
+//       一次合批或一次间接绘制可以引用任意多张纹理，不再受纹理槽位数量限制，也不必在批次之间切换绑定：
+//
+//           #extension GL_ARB_bindless_texture : require
+//           layout(std430, binding = 3) readonly buffer TextureTable { sampler2D u_Textures[]; };
+//           vec4 color = texture(u_Textures[v_TextureIndex], v_TexCoord);
+//
+//       下标必须是动态一致 (dynamically uniform) 的，例如来自 gl_DrawID 或 BaseInstance 的逐绘制数据；
+//       同一次绘制内各顶点不同的下标需要 GL_NV_gpu_shader5 等扩展才能保证正确。
+//       纹理在数据到达之前使用占位纹理的句柄，Update 会在句柄变化时重新上传。
+//       下标在主线程上分配；取得句柄与上传都录制为命令，在渲染线程上执行。
+//       不支持时 (IsSupported 为 false) 应改用 Texture2DArray 合并同尺寸纹理。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class BindlessTextureTable {
+public:
+	static constexpr uint32_t InvalidIndex = 0xFFFFFFFF;
+
+	// capacity 为最多可注册的纹理数量
+	BindlessTextureTable(uint32_t capacity = 4096);
+
+	// 注册纹理并返回其在表中的下标；重复注册返回同一个下标，表满时返回 InvalidIndex
+	uint32_t Register(const Ref<Texture>& texture);
+	// 注销纹理，下标留给之后注册的纹理复用
+	void Unregister(const Ref<Texture>& texture);
+
+	// 刷新句柄（纹理数据到达后占位句柄会被替换）并上传变化的区间；每帧绘制前调用一次
+	void Update();
+	// 绑定到指定的 SSBO 绑定点
+	void Bind(uint32_t binding) const;
+
+	inline uint32_t GetCount() const { return m_Count; }
+	inline uint32_t GetCapacity() const { return m_Capacity; }
+
+	// 当前后端与硬件是否支持无绑定纹理
+	static bool IsSupported();
+private:
+	// 只在渲染线程上访问的表项
+	struct RenderState {
+		std::vector<Ref<Texture>> Textures; // 下标即表项，空位为 nullptr
+		std::vector<uint64_t> Handles;      // 与 Textures 一一对应，已上传的句柄
+		// 尚未上传的表项区间 [Min, Max)
+		uint32_t DirtyMin = UINT32_MAX;
+		uint32_t DirtyMax = 0;
+
+		void MarkDirty(uint32_t index);
+	};
+
+	uint32_t m_Capacity;
+	Ref<StorageBuffer> m_Buffer;
+	Ref<RenderState> m_RenderState;
+	// 主线程上的下标分配
+	uint32_t m_Count = 0;
+	std::vector<uint32_t> m_FreeIndices;
+	std::unordered_map<const Texture*, uint32_t> m_Indices;
+};
+}
@@ -1,6 +1,9 @@
 #include "Buffer.h"
 #include "Renderer.h"
+#include "RenderThread.h"
 #include "engine_services/platform/opengl/OpenGLBuffer.h"
+#include "engine_services/platform/software/SoftwareBuffer.h"
+#include "engine_services/platform/null/NullBuffer.h"
 
 namespace GE {
 
@@ -8,7 +11,9 @@ namespace GE {
 Ref<VertexBuffer> VertexBuffer::Create(uint32_t size) {
 	switch (Renderer::GetAPI()) {
 		case RendererAPI::API::None:    ASSERT_ENGINE(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexBuffer>(size);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLVertexBuffer>(size);
+		case RendererAPI::API::Software: return CreateRenderResource<SoftwareVertexBuffer>(size);
+		case RendererAPI::API::Null:    return CreateRenderResource<NullVertexBuffer>(size);
 	}
 	ASSERT_ENGINE(false, "Unknown RendererAPI!");
 	return nullptr;
@@ -17,7 +22,9 @@ Ref<VertexBuffer> VertexBuffer::Create(uint32_t size) {
 Ref<VertexBuffer> VertexBuffer::Create(float* vertices, uint32_t size) {
 	switch (Renderer::GetAPI()) {
 		case RendererAPI::API::None:    ASSERT_ENGINE(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexBuffer>(vertices, size);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLVertexBuffer>(vertices, size);
+		case RendererAPI::API::Software: return CreateRenderResource<SoftwareVertexBuffer>(vertices, size);
+		case RendererAPI::API::Null:    return CreateRenderResource<NullVertexBuffer>(vertices, size);
 	}
 	ASSERT_ENGINE(false, "Unknown RendererAPI!");
 	return nullptr;
@@ -27,7 +34,31 @@ Ref<VertexBuffer> VertexBuffer::Create(float* vertices, uint32_t size) {
 Ref<IndexBuffer> IndexBuffer::Create(uint32_t* indices, uint32_t count) {
 	switch (Renderer::GetAPI()) {
 		case RendererAPI::API::None:    ASSERT_ENGINE(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLIndexBuffer>(indices, count);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLIndexBuffer>(indices, count);
+		case RendererAPI::API::Software: return CreateRenderResource<SoftwareIndexBuffer>(indices, count);
+		case RendererAPI::API::Null:    return CreateRenderResource<NullIndexBuffer>(indices, count);
+	}
+	ASSERT_ENGINE(false, "Unknown RendererAPI!");
+	return nullptr;
+}
+
+Ref<IndirectBuffer> IndirectBuffer::Create(uint32_t capacity) {
+	switch (Renderer::GetAPI()) {
+		case RendererAPI::API::None:    ASSERT_ENGINE(false, "RendererAPI::None is currently not supported!"); return nullptr;
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLIndirectBuffer>(capacity);
+		case RendererAPI::API::Software: return CreateRenderResource<SoftwareIndirectBuffer>(capacity);
+		case RendererAPI::API::Null:    return CreateRenderResource<NullIndirectBuffer>(capacity);
+	}
+	ASSERT_ENGINE(false, "Unknown RendererAPI!");
+	return nullptr;
+}
+
+Ref<StorageBuffer> StorageBuffer::Create(uint32_t size) {
+	switch (Renderer::GetAPI()) {
+		case RendererAPI::API::None:    ASSERT_ENGINE(false, "RendererAPI::None is currently not supported!"); return nullptr;
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLStorageBuffer>(size);
+		case RendererAPI::API::Software: return CreateRenderResource<SoftwareStorageBuffer>(size);
+		case RendererAPI::API::Null:    return CreateRenderResource<NullStorageBuffer>(size);
 	}
 	ASSERT_ENGINE(false, "Unknown RendererAPI!");
 	return nullptr;
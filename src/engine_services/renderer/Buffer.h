@@ -1,8 +1,10 @@
 #pragma once
 #include "core/Core.h"
 #include "core/Log.h"
+#include <array>
+#include <initializer_list>
+#include <span>
 #include <vector>
-#include <string>
 
 // ---------------------------------------------------------------------
 // 文件: Buffer.h
@@ -12,11 +14,23 @@
 
 namespace GE {
 
+// 紧凑格式：
+// - Half2/Half4: 16 位半精度浮点
+// - *Norm: 归一化整数，着色器读到的是 [0, 1] (无符号) 或 [-1, 1] (有符号) 的 float
+// - UByte4: 真正的整数属性 (uvec4)，不做归一化
+// - Int2_10_10_10_Rev / UInt2_10_10_10_Rev: 4 个分量打包进 32 位 (x/y/z 各 10 位, w 2 位)，
+//   配合 Normalized 使用时适合存放法线、切线
+// 例：位置 Float3 + 法线 Int2_10_10_10_Rev + UV Half2 = 20 字节，
+//     而全部使用 Float（位置 + 法线 + UV + 颜色 Float4）需要 48 字节
 enum class ShaderDataType {
-	None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool
+	None = 0, Float, Float2, Float3, Float4, Mat3, Mat4, Int, Int2, Int3, Int4, Bool,
+	Half2, Half4,
+	UByte4, UByte4Norm, Byte4Norm,
+	UShort2Norm, Short2Norm, Short4Norm,
+	Int2_10_10_10_Rev, UInt2_10_10_10_Rev
 };
 
-static uint32_t ShaderDataTypeSize(ShaderDataType type) {
+static constexpr uint32_t ShaderDataTypeSize(ShaderDataType type) {
 	switch (type) {
 		case ShaderDataType::Float:    return 4;
 		case ShaderDataType::Float2:   return 4 * 2;
@@ -29,22 +43,34 @@ static uint32_t ShaderDataTypeSize(ShaderDataType type) {
 		case ShaderDataType::Int3:     return 4 * 3;
 		case ShaderDataType::Int4:     return 4 * 4;
 		case ShaderDataType::Bool:     return 1;
+		case ShaderDataType::Half2:    return 2 * 2;
+		case ShaderDataType::Half4:    return 2 * 4;
+		case ShaderDataType::UByte4:     return 4;
+		case ShaderDataType::UByte4Norm: return 4;
+		case ShaderDataType::Byte4Norm:  return 4;
+		case ShaderDataType::UShort2Norm: return 2 * 2;
+		case ShaderDataType::Short2Norm:  return 2 * 2;
+		case ShaderDataType::Short4Norm:  return 2 * 4;
+		case ShaderDataType::Int2_10_10_10_Rev:  return 4;
+		case ShaderDataType::UInt2_10_10_10_Rev: return 4;
 	}
 	ASSERT_ENGINE(false, "Unknown ShaderDataType!");
 	return 0;
 }
 
+// BufferElement / BufferLayout 都可以在编译期构造（参见 VertexLayout.h 中的 MakeLayout），
+// 名称只保存字符串字面量指针，创建布局不会产生任何堆分配
 struct BufferElement {
-	std::string Name;       // 属性名称（用于调试或 Shader 绑定）
-	ShaderDataType Type;    // 数据类型（如 Float3）
-	uint32_t Size;          // 数据大小（字节）
-	size_t Offset;          // 在结构体中的偏移量（自动计算）
-	bool Normalized;        // 是否需要归一化
-	BufferElement() = default;
-	BufferElement(ShaderDataType type, const std::string& name, bool normalized = false)
+	const char* Name = "";                      // 属性名称（用于调试或 Shader 绑定），必须是静态生命周期的字符串
+	ShaderDataType Type = ShaderDataType::None; // 数据类型（如 Float3）
+	uint32_t Size = 0;                          // 数据大小（字节）
+	size_t Offset = 0;                          // 在结构体中的偏移量（自动计算）
+	bool Normalized = false;                    // 是否需要归一化
+	constexpr BufferElement() = default;
+	constexpr BufferElement(ShaderDataType type, const char* name, bool normalized = false)
 		: Name(name), Type(type), Size(ShaderDataTypeSize(type)), Offset(0), Normalized(normalized) {}
 
-	uint32_t GetComponentCount() const {
+	constexpr uint32_t GetComponentCount() const {
 		switch (Type) {
 			case ShaderDataType::Float:   return 1;
 			case ShaderDataType::Float2:  return 2;
@@ -57,6 +83,16 @@ struct BufferElement {
 			case ShaderDataType::Int3:    return 3;
 			case ShaderDataType::Int4:    return 4;
 			case ShaderDataType::Bool:    return 1;
+			case ShaderDataType::Half2:   return 2;
+			case ShaderDataType::Half4:   return 4;
+			case ShaderDataType::UByte4:      return 4;
+			case ShaderDataType::UByte4Norm:  return 4;
+			case ShaderDataType::Byte4Norm:   return 4;
+			case ShaderDataType::UShort2Norm: return 2;
+			case ShaderDataType::Short2Norm:  return 2;
+			case ShaderDataType::Short4Norm:  return 4;
+			case ShaderDataType::Int2_10_10_10_Rev:  return 4;
+			case ShaderDataType::UInt2_10_10_10_Rev: return 4;
 		}
 		ASSERT_ENGINE(false, "Unknown ShaderDataType!");
 		return 0;
@@ -65,33 +101,51 @@ struct BufferElement {
 
 class BufferLayout {
 public:
-	BufferLayout() {}
-	BufferLayout(const std::initializer_list<BufferElement>& elements) 
-        : m_Elements(elements) {
+	// 一个布局最多包含的属性数量（GL_MAX_VERTEX_ATTRIBS 的最小保证值）
+	static constexpr uint32_t MaxElements = 16;
+
+	constexpr BufferLayout() = default;
+	constexpr BufferLayout(std::initializer_list<BufferElement> elements) {
+		for (const BufferElement& element : elements) {
+			PushElement(element);
+		}
 		CalculateOffsetsAndStride();
 	}
+	// 元素的 Offset 与 stride 由调用者给定（例如 MakeLayout 按结构体成员的实际布局计算），不再自动计算
+	constexpr BufferLayout(std::span<const BufferElement> elements, uint32_t stride)
+		: m_Stride(stride) {
+		for (const BufferElement& element : elements) {
+			PushElement(element);
+		}
+	}
 	// 获取单个顶点的总步幅 (Stride)，即一个顶点占据的总字节数
-	inline uint32_t GetStride() const { return m_Stride; }
+	constexpr uint32_t GetStride() const { return m_Stride; }
 	// 获取所有元素列表
-	inline const std::vector<BufferElement>& GetElements() const { return m_Elements; }
+	constexpr std::span<const BufferElement> GetElements() const { return { m_Elements.data(), m_ElementCount }; }
+	constexpr uint32_t GetElementCount() const { return m_ElementCount; }
 	// 提供迭代器支持，以便可以使用 for-range 循环遍历
-	std::vector<BufferElement>::iterator begin() { return m_Elements.begin(); }
-	std::vector<BufferElement>::iterator end() { return m_Elements.end(); }
-	std::vector<BufferElement>::const_iterator begin() const { return m_Elements.begin(); }
-	std::vector<BufferElement>::const_iterator end() const { return m_Elements.end(); }
+	constexpr BufferElement* begin() { return m_Elements.data(); }
+	constexpr BufferElement* end() { return m_Elements.data() + m_ElementCount; }
+	constexpr const BufferElement* begin() const { return m_Elements.data(); }
+	constexpr const BufferElement* end() const { return m_Elements.data() + m_ElementCount; }
 private:
-	// 计算每个属性的 Offset 和总 Stride
-	void CalculateOffsetsAndStride() {
+	constexpr void PushElement(const BufferElement& element) {
+		ASSERT_ENGINE(m_ElementCount < MaxElements, "BufferLayout has too many elements!");
+		m_Elements[m_ElementCount++] = element;
+	}
+	// 计算每个属性的 Offset 和总 Stride（元素紧密排列，无对齐填充）
+	constexpr void CalculateOffsetsAndStride() {
 		size_t offset = 0;
 		m_Stride = 0;
-		for (auto& element : m_Elements) {
+		for (auto& element : *this) {
 			element.Offset = offset;
 			offset += element.Size;
 			m_Stride += element.Size;
 		}
 	}
 private:
-	std::vector<BufferElement> m_Elements;
+	std::array<BufferElement, MaxElements> m_Elements{};
+	uint32_t m_ElementCount = 0;
 	uint32_t m_Stride = 0;
 };
 
@@ -102,10 +156,13 @@ public:
 	virtual void Unbind() const = 0;
 	virtual const BufferLayout& GetLayout() const = 0;
 	virtual void SetLayout(const BufferLayout& layout) = 0;
-	virtual void SetData(const void* data, uint32_t size) = 0;
+	// 从字节偏移 offset 处写入 size 字节；流式缓冲每次整体重写，offset 必须为 0
+	virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
 	virtual uint32_t GetSize() const = 0;
 
+	// 动态顶点缓冲：适用于每帧通过 SetData 重写的数据（精灵、粒子、UI），后端以流式环形缓冲实现
 	static Ref<VertexBuffer> Create(uint32_t size);
+	// vertices 为 nullptr 时只分配存储，之后通过 SetData 按区间填充（例如 GeometryHeap 的子分配）
 	static Ref<VertexBuffer> Create(float* vertices, uint32_t size);
 };
 
@@ -115,7 +172,55 @@ public:
 	virtual void Bind() const = 0;
 	virtual void Unbind() const = 0;
 	virtual uint32_t GetCount() const = 0;
+	// 从第 offset 个索引处写入 count 个索引
+	virtual void SetData(const uint32_t* indices, uint32_t count, uint32_t offset = 0) = 0;
 
+	// indices 为 nullptr 时只分配 count 个索引的存储
 	static Ref<IndexBuffer> Create(uint32_t* indices, uint32_t count);
 };
+
+// 间接绘制命令，内存布局与 glMultiDrawElementsIndirect 要求的 DrawElementsIndirectCommand 一致
+struct DrawElementsIndirectCommand {
+	uint32_t Count = 0;         // 本次绘制的索引数量
+	uint32_t InstanceCount = 1; // 实例数量
+	uint32_t FirstIndex = 0;    // 在 IndexBuffer 中的起始索引（以索引为单位）
+	int32_t BaseVertex = 0;     // 加到每个索引上的顶点偏移
+	uint32_t BaseInstance = 0;  // 起始实例编号，可作为逐绘制数据 (StorageBuffer) 的下标
+};
+static_assert(sizeof(DrawElementsIndirectCommand) == 20, "DrawElementsIndirectCommand must match the GL layout");
+
+// ---------------------------------------------------------------------
+// 类: IndirectBuffer
+// 作用: 存放在 GPU 上的间接绘制命令缓冲
+// 描述: 一次 RenderCommand::DrawIndexedIndirect 会执行其中连续的多条命令，
+//       着色器通过 gl_DrawID（或 BaseInstance）索引 StorageBuffer 中的逐绘制数据（变换、材质）。
+// ---------------------------------------------------------------------
+class IndirectBuffer {
+public:
+	virtual ~IndirectBuffer() = default;
+	virtual void Bind() const = 0;
+	virtual void Unbind() const = 0;
+	// 从第 offset 条命令开始写入 count 条命令
+	virtual void SetCommands(const DrawElementsIndirectCommand* commands, uint32_t count, uint32_t offset = 0) = 0;
+	// 可容纳的命令条数
+	virtual uint32_t GetCapacity() const = 0;
+
+	static Ref<IndirectBuffer> Create(uint32_t capacity);
+};
+
+// ---------------------------------------------------------------------
+// 类: StorageBuffer
+// 作用: 着色器存储缓冲 (SSBO) 抽象
+// 描述: 用于存放大量逐绘制/逐对象数据，绑定到着色器中 layout(std430, binding = N) 的 buffer 块。
+// ---------------------------------------------------------------------
+class StorageBuffer {
+public:
+	virtual ~StorageBuffer() = default;
+	// 绑定到指定的 SSBO 绑定点
+	virtual void Bind(uint32_t binding) const = 0;
+	virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+	virtual uint32_t GetSize() const = 0;
+
+	static Ref<StorageBuffer> Create(uint32_t size);
+};
 }
\ No newline at end of file
@@ -0,0 +1,297 @@
+#include "ClusteredLighting.h"
+#include "Renderer.h"
+#include "RenderThread.h"
+#include "core/JobSystem.h"
+#include "engine_services/platform/opengl/OpenGLContext.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace GE {
+
+// 光源下标占低 20 位
+static constexpr uint32_t s_PairLightBits = 20;
+static constexpr uint32_t s_PairLightMask = (1u << s_PairLightBits) - 1;
+
+// 与着色器中 ClusterParams 的 std430 布局一致
+struct ClusterParams {
+	uint32_t GridSize[4];  // TilesX, TilesY, Slices, 光源数
+	float ScreenSize[2];
+	float SliceScale;      // slice = log(depth) * SliceScale - SliceBias
+	float SliceBias;
+};
+
+// 一帧上传的数据，随命令交给渲染线程
+struct ClusterUpload {
+	ClusterParams Params;
+	std::vector<PointLight> Lights;
+	std::vector<uint32_t> Grid; // 每簇 (Offset, Count)
+	std::vector<uint32_t> Indices;
+};
+
+static const char* s_ShaderSource = R"(
+layout(std430, binding = 4) readonly buffer ClusterParams {
+	uvec4 u_ClusterGrid;   // xyz: 网格尺寸, w: 光源数
+	vec4 u_ClusterScreen;  // xy: 屏幕尺寸, z: 切片比例, w: 切片偏移
+};
+struct ClusterLight {
+	vec4 PositionRadius;   // 视空间位置, 半径
+	vec4 ColorIntensity;
+};
+layout(std430, binding = 5) readonly buffer ClusterLights { ClusterLight u_ClusterLights[]; };
+layout(std430, binding = 6) readonly buffer ClusterGrid { uvec2 u_Clusters[]; };
+layout(std430, binding = 7) readonly buffer ClusterIndices { uint u_ClusterLightIndices[]; };
+
+uint GetClusterIndex(vec2 fragCoord, float viewDepth) {
+	uvec3 grid = u_ClusterGrid.xyz;
+	uvec2 tile = min(uvec2(fragCoord / u_ClusterScreen.xy * vec2(grid.xy)), grid.xy - 1u);
+	float slice = log(max(viewDepth, 1e-4)) * u_ClusterScreen.z - u_ClusterScreen.w;
+	uint z = uint(clamp(slice, 0.0, float(grid.z - 1u)));
+	return (z * grid.y + tile.y) * grid.x + tile.x;
+}
+
+// viewPosition / viewNormal 为视空间（相机朝 -Z）
+vec3 EvaluateClusteredLights(vec2 fragCoord, vec3 viewPosition, vec3 viewNormal, vec3 albedo) {
+	uvec2 cluster = u_Clusters[GetClusterIndex(fragCoord, -viewPosition.z)];
+	vec3 normal = normalize(viewNormal);
+	vec3 result = vec3(0.0);
+	for (uint i = 0u; i < cluster.y; ++i) {
+		ClusterLight light = u_ClusterLights[u_ClusterLightIndices[cluster.x + i]];
+		vec3 toLight = light.PositionRadius.xyz - viewPosition;
+		float distanceSquared = dot(toLight, toLight);
+		float radiusSquared = light.PositionRadius.w * light.PositionRadius.w;
+		// 在半径处平滑衰减到 0
+		float window = clamp(1.0 - (distanceSquared * distanceSquared) / (radiusSquared * radiusSquared), 0.0, 1.0);
+		float attenuation = window * window / (distanceSquared + 1.0);
+		float lambert = max(dot(normal, toLight * inversesqrt(max(distanceSquared, 1e-8))), 0.0);
+		result += albedo * light.ColorIntensity.rgb * (light.ColorIntensity.w * lambert * attenuation);
+	}
+	return result;
+}
+)";
+
+// 球与 AABB 是否相交
+static inline bool SphereIntersectsBounds(const Vec3& center, float radius, const Vec3& min, const Vec3& max) {
+	const Vec3 closest = glm::clamp(center, min, max);
+	const Vec3 delta = center - closest;
+	return glm::dot(delta, delta) <= radius * radius;
+}
+
+ClusteredLighting::ClusteredLighting(const ClusteredLightingSpecification& specification)
+	: m_Specification(specification) {
+	ASSERT_ENGINE(IsSupported(), "Clustered lighting requires shader storage buffers (GL 4.3)!");
+	ASSERT_ENGINE(specification.TilesX * specification.TilesY < (1u << (32 - s_PairLightBits)), "Too many cluster tiles per slice!");
+	ASSERT_ENGINE(specification.MaxLights <= s_PairLightMask + 1, "Too many clustered lights!");
+	const uint32_t clusterCount = specification.TilesX * specification.TilesY * specification.Slices;
+	m_ParamsBuffer = StorageBuffer::Create(sizeof(ClusterParams));
+	m_LightBuffer = StorageBuffer::Create(std::max(specification.MaxLights, 1u) * static_cast<uint32_t>(sizeof(PointLight)));
+	m_GridBuffer = StorageBuffer::Create(clusterCount * 2 * static_cast<uint32_t>(sizeof(uint32_t)));
+	m_IndexBuffer = StorageBuffer::Create(std::max(specification.MaxAssignments, 1u) * static_cast<uint32_t>(sizeof(uint32_t)));
+	m_Slices.resize(specification.Slices);
+}
+
+void ClusteredLighting::BuildClusterBounds(const Mat4& projection, float nearPlane, float farPlane) {
+	const ClusteredLightingSpecification& spec = m_Specification;
+	m_ClusterBounds.resize(spec.TilesX * spec.TilesY * spec.Slices);
+	// 视空间中深度 d 处，NDC (x, y) 对应 (x * d / P00, y * d / P11)（对称透视投影）
+	const float scaleX = 1.0f / projection[0][0];
+	const float scaleY = 1.0f / projection[1][1];
+	const float depthRatio = farPlane / nearPlane;
+	const float slices = static_cast<float>(spec.Slices);
+	const float tilesX = static_cast<float>(spec.TilesX);
+	const float tilesY = static_cast<float>(spec.TilesY);
+	for (uint32_t slice = 0; slice < spec.Slices; ++slice) {
+		const float sliceNear = nearPlane * std::pow(depthRatio, static_cast<float>(slice) / slices);
+		const float sliceFar = nearPlane * std::pow(depthRatio, static_cast<float>(slice + 1) / slices);
+		for (uint32_t y = 0; y < spec.TilesY; ++y) {
+			const float ndcY0 = -1.0f + 2.0f * static_cast<float>(y) / tilesY;
+			const float ndcY1 = -1.0f + 2.0f * static_cast<float>(y + 1) / tilesY;
+			for (uint32_t x = 0; x < spec.TilesX; ++x) {
+				const float ndcX0 = -1.0f + 2.0f * static_cast<float>(x) / tilesX;
+				const float ndcX1 = -1.0f + 2.0f * static_cast<float>(x + 1) / tilesX;
+				ClusterBounds& bounds = m_ClusterBounds[GetClusterIndex(x, y, slice)];
+				bounds.Min = Vec3(std::numeric_limits<float>::max());
+				bounds.Max = Vec3(-std::numeric_limits<float>::max());
+				for (float depth : { sliceNear, sliceFar }) {
+					for (float ndcX : { ndcX0, ndcX1 }) {
+						for (float ndcY : { ndcY0, ndcY1 }) {
+							const Vec3 corner(ndcX * depth * scaleX, ndcY * depth * scaleY, -depth);
+							bounds.Min = glm::min(bounds.Min, corner);
+							bounds.Max = glm::max(bounds.Max, corner);
+						}
+					}
+				}
+			}
+		}
+	}
+	m_BoundsProjection = projection;
+	m_BoundsNear = nearPlane;
+	m_BoundsFar = farPlane;
+}
+
+void ClusteredLighting::Update(const Mat4& view, const Mat4& projection, float nearPlane, float farPlane,
+	uint32_t screenWidth, uint32_t screenHeight, const std::vector<PointLight>& lights) {
+	ASSERT_ENGINE(nearPlane > 0.0f && farPlane > nearPlane, "Invalid clustered lighting depth range!");
+	const ClusteredLightingSpecification& spec = m_Specification;
+	if (projection != m_BoundsProjection || nearPlane != m_BoundsNear || farPlane != m_BoundsFar) {
+		BuildClusterBounds(projection, nearPlane, farPlane);
+	}
+	const float sliceScale = static_cast<float>(spec.Slices) / std::log(farPlane / nearPlane);
+	const float sliceBias = sliceScale * std::log(nearPlane);
+	auto depthToSlice = [&](float depth) -> uint32_t {
+		if (depth <= nearPlane) {
+			return 0;
+		}
+		const float slice = std::log(depth) * sliceScale - sliceBias;
+		return std::min(static_cast<uint32_t>(slice), spec.Slices - 1);
+	};
+	auto ndcToTile = [](float ndc, uint32_t tiles) -> uint32_t {
+		const float tile = (ndc * 0.5f + 0.5f) * static_cast<float>(tiles);
+		return static_cast<uint32_t>(std::clamp(tile, 0.0f, static_cast<float>(tiles - 1)));
+	};
+
+	// 1. 变换到视空间，剔除视锥外的光源，求出每个光源覆盖的瓦片与切片范围
+	for (SliceAssignment& slice : m_Slices) {
+		slice.Lights.clear();
+	}
+	m_ViewLights.clear();
+	m_LightRanges.clear();
+	const uint32_t lightCount = std::min(static_cast<uint32_t>(lights.size()), spec.MaxLights);
+	for (uint32_t i = 0; i < lightCount; ++i) {
+		const PointLight& light = lights[i];
+		const Vec3 center = Vec3(view * Vec4(light.Position, 1.0f));
+		const float depth = -center.z;
+		const float radius = light.Radius;
+		if (radius <= 0.0f || depth + radius < nearPlane || depth - radius > farPlane) {
+			continue;
+		}
+		// 包围盒四个角在最近与最远深度处的投影给出保守的屏幕范围；包围盒跨过近平面时覆盖整个屏幕
+		float minX = -1.0f, maxX = 1.0f, minY = -1.0f, maxY = 1.0f;
+		if (depth - radius > nearPlane) {
+			minX = minY = std::numeric_limits<float>::max();
+			maxX = maxY = -std::numeric_limits<float>::max();
+			for (float d : { depth - radius, depth + radius }) {
+				for (float offset : { -radius, radius }) {
+					const float x = projection[0][0] * (center.x + offset) / d;
+					const float y = projection[1][1] * (center.y + offset) / d;
+					minX = std::min(minX, x);
+					maxX = std::max(maxX, x);
+					minY = std::min(minY, y);
+					maxY = std::max(maxY, y);
+				}
+			}
+			if (maxX < -1.0f || minX > 1.0f || maxY < -1.0f || minY > 1.0f) {
+				continue;
+			}
+		}
+		const uint32_t index = static_cast<uint32_t>(m_ViewLights.size());
+		m_ViewLights.push_back({ center, radius, light.Color, light.Intensity });
+		m_LightRanges.push_back({ ndcToTile(minX, spec.TilesX), ndcToTile(maxX, spec.TilesX),
+			ndcToTile(minY, spec.TilesY), ndcToTile(maxY, spec.TilesY) });
+		const uint32_t firstSlice = depthToSlice(depth - radius);
+		const uint32_t lastSlice = depthToSlice(depth + radius);
+		for (uint32_t slice = firstSlice; slice <= lastSlice; ++slice) {
+			m_Slices[slice].Lights.push_back(index);
+		}
+	}
+
+	// 2. 每个切片一个任务：精确测试范围内的簇，再按簇做计数排序
+	const uint32_t tilesPerSlice = spec.TilesX * spec.TilesY;
+	JobContext context;
+	JobSystem::Dispatch(context, spec.Slices, 1, [this, &spec, tilesPerSlice](JobDispatchArgs args) {
+		SliceAssignment& slice = m_Slices[args.JobIndex];
+		slice.Pairs.clear();
+		slice.Counts.assign(tilesPerSlice, 0);
+		for (uint32_t lightIndex : slice.Lights) {
+			const PointLight& light = m_ViewLights[lightIndex];
+			const LightRange& range = m_LightRanges[lightIndex];
+			for (uint32_t y = range.MinY; y <= range.MaxY; ++y) {
+				for (uint32_t x = range.MinX; x <= range.MaxX; ++x) {
+					const ClusterBounds& bounds = m_ClusterBounds[GetClusterIndex(x, y, args.JobIndex)];
+					if (SphereIntersectsBounds(light.Position, light.Radius, bounds.Min, bounds.Max)) {
+						const uint32_t tile = y * spec.TilesX + x;
+						slice.Pairs.push_back((tile << s_PairLightBits) | lightIndex);
+						slice.Counts[tile]++;
+					}
+				}
+			}
+		}
+		// 计数排序保持每簇内光源的顺序
+		std::vector<uint32_t> offsets(tilesPerSlice);
+		uint32_t offset = 0;
+		for (uint32_t tile = 0; tile < tilesPerSlice; ++tile) {
+			offsets[tile] = offset;
+			offset += slice.Counts[tile];
+		}
+		slice.Indices.resize(slice.Pairs.size());
+		for (uint32_t pair : slice.Pairs) {
+			slice.Indices[offsets[pair >> s_PairLightBits]++] = pair & s_PairLightMask;
+		}
+	});
+	JobSystem::Wait(context);
+
+	// 3. 拼接各切片的结果
+	Ref<ClusterUpload> upload = CreateRef<ClusterUpload>();
+	upload->Params = {
+		{ spec.TilesX, spec.TilesY, spec.Slices, static_cast<uint32_t>(m_ViewLights.size()) },
+		{ static_cast<float>(std::max(screenWidth, 1u)), static_cast<float>(std::max(screenHeight, 1u)) },
+		sliceScale, sliceBias
+	};
+	upload->Lights = m_ViewLights;
+	upload->Grid.resize(tilesPerSlice * spec.Slices * 2);
+	m_Statistics = {};
+	m_Statistics.Lights = static_cast<uint32_t>(m_ViewLights.size());
+	for (uint32_t sliceIndex = 0; sliceIndex < spec.Slices; ++sliceIndex) {
+		const SliceAssignment& slice = m_Slices[sliceIndex];
+		uint32_t sliceOffset = 0;
+		for (uint32_t tile = 0; tile < tilesPerSlice; ++tile) {
+			const uint32_t count = slice.Counts.empty() ? 0 : slice.Counts[tile];
+			const uint32_t offset = static_cast<uint32_t>(upload->Indices.size());
+			const uint32_t kept = std::min(count, spec.MaxAssignments - std::min(offset, spec.MaxAssignments));
+			upload->Indices.insert(upload->Indices.end(), slice.Indices.begin() + sliceOffset, slice.Indices.begin() + sliceOffset + kept);
+			const uint32_t cluster = sliceIndex * tilesPerSlice + tile;
+			upload->Grid[cluster * 2] = offset;
+			upload->Grid[cluster * 2 + 1] = kept;
+			sliceOffset += count;
+			m_Statistics.MaxLightsPerCluster = std::max(m_Statistics.MaxLightsPerCluster, count);
+			m_Statistics.DroppedAssignments += count - kept;
+		}
+	}
+	m_Statistics.Assignments = static_cast<uint32_t>(upload->Indices.size());
+
+	RenderThread::Submit([upload, params = m_ParamsBuffer, lightBuffer = m_LightBuffer, grid = m_GridBuffer, indices = m_IndexBuffer]() {
+		params->SetData(&upload->Params, sizeof(ClusterParams));
+		if (!upload->Lights.empty()) {
+			lightBuffer->SetData(upload->Lights.data(), static_cast<uint32_t>(upload->Lights.size() * sizeof(PointLight)));
+		}
+		grid->SetData(upload->Grid.data(), static_cast<uint32_t>(upload->Grid.size() * sizeof(uint32_t)));
+		if (!upload->Indices.empty()) {
+			indices->SetData(upload->Indices.data(), static_cast<uint32_t>(upload->Indices.size() * sizeof(uint32_t)));
+		}
+	});
+}
+
+void ClusteredLighting::Bind() const {
+	RenderThread::Submit([params = m_ParamsBuffer, lights = m_LightBuffer, grid = m_GridBuffer, indices = m_IndexBuffer]() {
+		params->Bind(ParamsBinding);
+		lights->Bind(LightsBinding);
+		grid->Bind(GridBinding);
+		indices->Bind(IndicesBinding);
+	});
+}
+
+const char* ClusteredLighting::GetShaderSource() {
+	return s_ShaderSource;
+}
+
+bool ClusteredLighting::IsSupported() {
+	switch (Renderer::GetAPI()) {
+		case RendererAPI::API::None:    return false;
+		case RendererAPI::API::OpenGL:  return OpenGLContext::GetCapabilities().MultiDrawIndirect;
+		case RendererAPI::API::Software: return false;
+		case RendererAPI::API::Null:    return true; // 只需要存储缓冲，空后端可以测量光源分配的 CPU 开销
+	}
+	ASSERT_ENGINE(false, "Unknown RendererAPI!");
+	return false;
+}
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include "core/Core.h"
+#include "core/CoreMath.h"
+#include "Buffer.h"
+#include <vector>
+
+// ---------------------------------------------------------------------
+// 类: ClusteredLighting
+// 作用: 分簇前向光照 (Clustered Forward Shading)
+// 描述: 视锥按屏幕瓦片 (TilesX × TilesY) 与按指数划分的深度切片 (Slices) 切成三维的簇，
+//       每帧在 CPU 上把点光源分配到与其包围球相交的簇：先由光源的视空间包围盒求出它覆盖的
+//       瓦片与切片范围，再只对范围内的簇做球与 AABB 的精确测试。各切片在 JobSystem 上并行处理，
+//       每个任务只写自己切片的簇，无需同步。结果写入四个 SSBO：
+//
+//           binding 4: ClusterParams   网格尺寸、屏幕尺寸与深度切片参数
+//           binding 5: ClusterLights   视空间中的光源
+//           binding 6: ClusterGrid     每簇 (Offset, Count)
+//           binding 7: ClusterIndices  按簇连续排列的光源下标
+//
+//       片元着色器由 gl_FragCoord 与视空间深度找到所在的簇，只遍历簇中的光源，
+//       每个片元的开销取决于局部的光源密度而不是光源总数。
+//       着色器用法：在 #version 之后拼接 GetShaderSource()，然后
+//
+//           vec3 lighting = EvaluateClusteredLights(gl_FragCoord.xy, viewPosition, viewNormal, albedo);
+//
+//       需要 SSBO (GL 4.3)，不支持时 IsSupported 为 false。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+// 与着色器中的 std430 布局一致
+struct PointLight {
+	Vec3 Position{ 0.0f };   // 世界空间
+	float Radius = 1.0f;     // 影响半径，之外贡献为 0
+	Vec3 Color{ 1.0f };
+	float Intensity = 1.0f;
+};
+static_assert(sizeof(PointLight) == 32, "PointLight must match the std430 layout");
+
+struct ClusteredLightingSpecification {
+	uint32_t TilesX = 16;
+	uint32_t TilesY = 9;
+	uint32_t Slices = 24;
+	uint32_t MaxLights = 8192;
+	// 所有簇的光源下标总数上限，超出的分配被丢弃（并计入 GetStatistics().DroppedAssignments）
+	uint32_t MaxAssignments = 16 * 9 * 24 * 64;
+};
+
+struct ClusteredLightingStatistics {
+	uint32_t Lights = 0;             // 本帧参与分配的光源（视锥内）
+	uint32_t Assignments = 0;        // 写入的光源下标总数
+	uint32_t MaxLightsPerCluster = 0;
+	uint32_t DroppedAssignments = 0;
+};
+
+class ClusteredLighting {
+public:
+	// 着色器中使用的 SSBO 绑定点
+	static constexpr uint32_t ParamsBinding = 4;
+	static constexpr uint32_t LightsBinding = 5;
+	static constexpr uint32_t GridBinding = 6;
+	static constexpr uint32_t IndicesBinding = 7;
+
+	ClusteredLighting(const ClusteredLightingSpecification& specification = {});
+
+	/**
+	 * @brief 分配本帧的光源并上传
+	 *
+	 * view / projection 为场景相机的矩阵（透视投影，右手坐标系，相机朝 -Z），
+	 * near / far 为投影的近远平面，screenWidth / screenHeight 为场景渲染目标的尺寸。
+	 * 投影或尺寸变化时重新计算各簇的包围盒。超过 MaxLights 的光源被忽略。
+	 */
+	void Update(const Mat4& view, const Mat4& projection, float nearPlane, float farPlane,
+		uint32_t screenWidth, uint32_t screenHeight, const std::vector<PointLight>& lights);
+	// 绑定四个 SSBO，在绘制使用光照的物体之前调用
+	void Bind() const;
+
+	inline const ClusteredLightingStatistics& GetStatistics() const { return m_Statistics; }
+	inline const ClusteredLightingSpecification& GetSpecification() const { return m_Specification; }
+
+	// 着色器中的数据块声明与 EvaluateClusteredLights 函数
+	static const char* GetShaderSource();
+	static bool IsSupported();
+private:
+	struct ClusterBounds {
+		Vec3 Min;
+		Vec3 Max;
+	};
+	void BuildClusterBounds(const Mat4& projection, float nearPlane, float farPlane);
+	inline uint32_t GetClusterIndex(uint32_t x, uint32_t y, uint32_t slice) const {
+		return (slice * m_Specification.TilesY + y) * m_Specification.TilesX + x;
+	}
+private:
+	ClusteredLightingSpecification m_Specification;
+	Ref<StorageBuffer> m_ParamsBuffer;
+	Ref<StorageBuffer> m_LightBuffer;
+	Ref<StorageBuffer> m_GridBuffer;
+	Ref<StorageBuffer> m_IndexBuffer;
+
+	// 一个深度切片的分配结果，由处理该切片的任务独占写入
+	struct SliceAssignment {
+		std::vector<uint32_t> Lights;  // 与切片深度范围相交的光源
+		std::vector<uint32_t> Pairs;   // (簇在切片中的序号 << 20) | 光源下标
+		std::vector<uint32_t> Indices; // 按簇排序后的光源下标
+		std::vector<uint32_t> Counts;  // 切片中每簇的光源数
+	};
+	// 光源覆盖的瓦片范围（闭区间）
+	struct LightRange {
+		uint32_t MinX, MaxX, MinY, MaxY;
+	};
+
+	// 簇的视空间包围盒，仅在投影变化时重建
+	std::vector<ClusterBounds> m_ClusterBounds;
+	Mat4 m_BoundsProjection{ 0.0f };
+	float m_BoundsNear = 0.0f;
+	float m_BoundsFar = 0.0f;
+
+	std::vector<PointLight> m_ViewLights; // 视锥内的光源，已变换到视空间
+	std::vector<LightRange> m_LightRanges;
+	std::vector<SliceAssignment> m_Slices;
+	ClusteredLightingStatistics m_Statistics;
+};
+}
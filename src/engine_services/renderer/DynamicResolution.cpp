@@ -0,0 +1,170 @@
+#include "DynamicResolution.h"
+#include "Renderer.h"
+#include "RenderCommand.h"
+#include "GpuProfiler.h"
+#include "RenderThread.h"
+#include <algorithm>
+#include <cmath>
+
+namespace GE {
+
+// 测量值的指数平滑系数，单帧的尖峰不会引起缩放变化
+static constexpr float s_TimeSmoothing = 0.1f;
+// 小于此值的缩放变化忽略，避免渲染尺寸每帧抖动一两个像素
+static constexpr float s_MinScaleChange = 0.01f;
+
+// 缩放后的尺寸：离屏目标向上取整以容纳最大缩放，渲染尺寸四舍五入到最近的像素，结果至少为 1
+static uint32_t ScaleSizeCeil(uint32_t size, float scale) {
+	return std::max(1u, static_cast<uint32_t>(std::ceil(static_cast<float>(size) * scale)));
+}
+
+static uint32_t ScaleSizeRound(uint32_t size, float scale) {
+	return std::max(1u, static_cast<uint32_t>(std::lround(static_cast<float>(size) * scale)));
+}
+
+// 全屏三角形：三个顶点覆盖整个裁剪空间，不需要顶点缓冲
+static const char* s_UpscaleVertexSource = R"(
+	#version 330 core
+	out vec2 v_TexCoord;
+	void main() {
+		vec2 position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+		v_TexCoord = position;
+		gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+	}
+)";
+
+// 双线性放大后按十字形邻域做反锐化掩模，结果限制在邻域的最小/最大值之间，不会产生光晕
+static const char* s_UpscaleFragmentSource = R"(
+	#version 330 core
+	in vec2 v_TexCoord;
+	out vec4 o_Color;
+	uniform sampler2D u_Source;
+	uniform vec2 u_UVScale;   // 渲染区域占离屏目标的比例
+	uniform vec2 u_TexelSize; // 离屏目标一个像素的纹理坐标大小
+	uniform float u_Sharpness;
+
+	vec3 Sample(vec2 uv) {
+		// 限制在渲染区域内，不采样到区域外的旧内容
+		return texture(u_Source, clamp(uv, 0.5 * u_TexelSize, u_UVScale - 0.5 * u_TexelSize)).rgb;
+	}
+
+	void main() {
+		vec2 uv = v_TexCoord * u_UVScale;
+		vec3 center = Sample(uv);
+		vec3 north = Sample(uv + vec2(0.0, u_TexelSize.y));
+		vec3 south = Sample(uv - vec2(0.0, u_TexelSize.y));
+		vec3 east = Sample(uv + vec2(u_TexelSize.x, 0.0));
+		vec3 west = Sample(uv - vec2(u_TexelSize.x, 0.0));
+		vec3 lo = min(center, min(min(north, south), min(east, west)));
+		vec3 hi = max(center, max(max(north, south), max(east, west)));
+		vec3 sharpened = center + (4.0 * center - north - south - east - west) * u_Sharpness;
+		o_Color = vec4(clamp(sharpened, lo, hi), 1.0);
+	}
+)";
+
+DynamicResolution::DynamicResolution(const DynamicResolutionSpecification& specification, uint32_t outputWidth, uint32_t outputHeight)
+	: m_Specification(specification) {
+	ASSERT_ENGINE(specification.MinScale > 0.0f && specification.MinScale <= specification.MaxScale, "Invalid dynamic resolution scale range!");
+	m_Scale = specification.MaxScale;
+	m_OutputWidth = std::max(outputWidth, 1u);
+	m_OutputHeight = std::max(outputHeight, 1u);
+
+	m_TargetWidth = ScaleSizeCeil(m_OutputWidth, specification.MaxScale);
+	m_TargetHeight = ScaleSizeCeil(m_OutputHeight, specification.MaxScale);
+	FramebufferSpecification framebuffer;
+	framebuffer.Width = m_TargetWidth;
+	framebuffer.Height = m_TargetHeight;
+	framebuffer.Attachments.push_back({ specification.ColorFormat, TextureFilter::Linear });
+	if (specification.EntityID) {
+		framebuffer.Attachments.push_back({ FramebufferTextureFormat::RedInteger, TextureFilter::Nearest });
+	}
+	if (specification.Depth) {
+		framebuffer.Attachments.push_back({ FramebufferTextureFormat::Depth });
+	}
+	m_Target = Framebuffer::Create(framebuffer);
+	m_Timer = GpuTimer::Create();
+	m_UpscaleShader = Shader::Create("DynamicResolutionUpscale", s_UpscaleVertexSource, s_UpscaleFragmentSource);
+	m_FullscreenVertexArray = VertexArray::Create();
+	UpdateRenderSize();
+}
+
+void DynamicResolution::SetOutputSize(uint32_t width, uint32_t height) {
+	if (width == 0 || height == 0 || (width == m_OutputWidth && height == m_OutputHeight)) {
+		return;
+	}
+	m_OutputWidth = width;
+	m_OutputHeight = height;
+	m_TargetWidth = ScaleSizeCeil(width, m_Specification.MaxScale);
+	m_TargetHeight = ScaleSizeCeil(height, m_Specification.MaxScale);
+	RenderThread::Submit([target = m_Target, targetWidth = m_TargetWidth, targetHeight = m_TargetHeight]() {
+		target->Resize(targetWidth, targetHeight);
+	});
+	UpdateRenderSize();
+}
+
+void DynamicResolution::Update(float cpuFrameTime) {
+	m_CpuTime = m_CpuTime > 0.0f ? m_CpuTime + (cpuFrameTime - m_CpuTime) * s_TimeSmoothing : cpuFrameTime;
+	if (!m_Timer->HasResult()) {
+		return;
+	}
+	const float gpuTime = m_Timer->GetMilliseconds();
+	m_GpuTime = m_GpuTime > 0.0f ? m_GpuTime + (gpuTime - m_GpuTime) * s_TimeSmoothing : gpuTime;
+
+	// GPU 时间与像素数（缩放的平方）近似成正比，据此预测到达阈值所需的缩放
+	const DynamicResolutionSpecification& spec = m_Specification;
+	const float target = spec.TargetFrameTime;
+	float scale = m_Scale;
+	if (m_GpuTime > target * spec.DecreaseThreshold) {
+		m_StableFrames = 0;
+		const float desired = m_Scale * std::sqrt(target * spec.DecreaseThreshold / m_GpuTime);
+		scale = std::max(desired, m_Scale - spec.MaxScaleStep);
+	} else if (m_GpuTime < target * spec.IncreaseThreshold && m_CpuTime < target) {
+		// 测量值落后几帧，每次提高后重新等待 IncreaseDelayFrames 帧，避免冲过头后又降回来
+		if (++m_StableFrames >= spec.IncreaseDelayFrames) {
+			m_StableFrames = 0;
+			const float desired = m_Scale * std::sqrt(target * spec.IncreaseThreshold / std::max(m_GpuTime, 0.01f));
+			scale = std::min(desired, m_Scale + spec.MaxScaleStep);
+		}
+	} else {
+		m_StableFrames = 0;
+	}
+	scale = std::clamp(scale, spec.MinScale, spec.MaxScale);
+	if (std::abs(scale - m_Scale) >= s_MinScaleChange || scale == spec.MinScale || scale == spec.MaxScale) {
+		m_Scale = scale;
+		UpdateRenderSize();
+	}
+}
+
+void DynamicResolution::UpdateRenderSize() {
+	m_RenderWidth = std::min(ScaleSizeRound(m_OutputWidth, m_Scale), m_TargetWidth);
+	m_RenderHeight = std::min(ScaleSizeRound(m_OutputHeight, m_Scale), m_TargetHeight);
+}
+
+void DynamicResolution::BeginScene() {
+	RenderThread::Submit([timer = m_Timer]() { timer->Begin(); });
+	Renderer::BeginScene(m_Target);
+	RenderCommand::SetViewport(0, 0, m_RenderWidth, m_RenderHeight);
+}
+
+void DynamicResolution::EndScene() {
+	// 解析并恢复窗口为渲染目标与其视口
+	Renderer::EndScene();
+
+	GPU_PROFILE_SCOPE("Upscale");
+	const Vec2 targetSize(static_cast<float>(m_TargetWidth), static_cast<float>(m_TargetHeight));
+	const Vec2 uvScale = Vec2(static_cast<float>(m_RenderWidth), static_cast<float>(m_RenderHeight)) / targetSize;
+	const Vec2 texelSize = 1.0f / targetSize;
+	// 没有缩小时不锐化，原样输出
+	const float sharpness = m_RenderWidth < m_OutputWidth ? m_Specification.Sharpness : 0.0f;
+	RenderThread::Submit([shader = m_UpscaleShader, target = m_Target, uvScale, texelSize, sharpness]() {
+		shader->Bind();
+		shader->SetInt("u_Source", 0);
+		shader->SetFloat2("u_UVScale", uvScale);
+		shader->SetFloat2("u_TexelSize", texelSize);
+		shader->SetFloat("u_Sharpness", sharpness);
+		target->BindColorAttachment(0, 0);
+	});
+	RenderCommand::DrawArrays(m_FullscreenVertexArray, 3);
+	RenderThread::Submit([timer = m_Timer]() { timer->End(); });
+}
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include "core/Core.h"
+#include "Framebuffer.h"
+#include "GpuTimer.h"
+#include "Shader.h"
+#include "VertexArray.h"
+
+// ---------------------------------------------------------------------
+// 类: DynamicResolution
+// 作用: 动态分辨率，按测得的帧时间调整场景的渲染分辨率以维持目标帧时间
+// 描述: 场景渲染到一个按 MaxScale 分配的离屏帧缓冲中，实际只使用左下角 (宽, 高) × Scale 的区域，
+//       缩放变化时不需要重新分配。场景结束后以双线性采样加锐化把该区域放大到窗口。
+//       控制器以场景 (含放大) 的 GPU 时间为依据：GPU 时间超过目标的 DecreaseThreshold 时立即降低缩放，
+//       按像素数与 GPU 时间成正比预测所需的缩放；低于 IncreaseThreshold 并持续 IncreaseDelayFrames 帧
+//       才提高。两个阈值之间不调整（滞回），每帧的变化不超过 MaxScaleStep，避免画面跳变。
+//       CPU 时间超过目标而 GPU 并不紧张时，瓶颈在 CPU，降低分辨率没有帮助，此时保持不变。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+struct DynamicResolutionSpecification {
+	float TargetFrameTime = 16.0f;    // 目标帧时间（毫秒）
+	float MinScale = 0.5f;            // 每个轴上的缩放范围
+	float MaxScale = 1.0f;
+	float DecreaseThreshold = 0.95f;  // GPU 时间超过目标的该比例时降低缩放
+	float IncreaseThreshold = 0.75f;  // GPU 时间低于目标的该比例时才考虑提高缩放
+	uint32_t IncreaseDelayFrames = 30;
+	float MaxScaleStep = 0.05f;       // 每帧缩放的最大变化
+	float Sharpness = 0.2f;           // 放大时的锐化强度，0 为纯双线性
+	FramebufferTextureFormat ColorFormat = FramebufferTextureFormat::RGBA8;
+	bool Depth = true;
+	bool EntityID = false;            // 附加物体 ID 附件 (RedInteger，颜色附件 1)，供 ObjectPicker 使用
+};
+
+class DynamicResolution {
+public:
+	DynamicResolution(const DynamicResolutionSpecification& specification, uint32_t outputWidth, uint32_t outputHeight);
+
+	// 窗口尺寸变化时调用，按新尺寸 × MaxScale 重新分配离屏目标
+	void SetOutputSize(uint32_t width, uint32_t height);
+	/**
+	 * @brief 每帧在渲染场景之前调用，更新缩放
+	 *
+	 * cpuFrameTime 为上一帧 CPU 的工作时间（毫秒），不含等待垂直同步与交换缓冲区；
+	 * GPU 时间取自内部计时器最近完成的测量。
+	 */
+	void Update(float cpuFrameTime);
+
+	// 以离屏目标开始场景，视口为当前渲染分辨率
+	void BeginScene();
+	// 结束场景，并把渲染区域放大到窗口
+	void EndScene();
+
+	inline float GetScale() const { return m_Scale; }
+	inline uint32_t GetRenderWidth() const { return m_RenderWidth; }
+	inline uint32_t GetRenderHeight() const { return m_RenderHeight; }
+	inline float GetGpuTime() const { return m_GpuTime; }
+	inline float GetCpuTime() const { return m_CpuTime; }
+	inline const Ref<Framebuffer>& GetTarget() const { return m_Target; }
+
+	inline const DynamicResolutionSpecification& GetSpecification() const { return m_Specification; }
+	void SetTargetFrameTime(float milliseconds) { m_Specification.TargetFrameTime = milliseconds; }
+	void SetSharpness(float sharpness) { m_Specification.Sharpness = sharpness; }
+private:
+	void UpdateRenderSize();
+private:
+	DynamicResolutionSpecification m_Specification;
+	Ref<Framebuffer> m_Target;
+	Ref<GpuTimer> m_Timer;
+	Ref<Shader> m_UpscaleShader;
+	Ref<VertexArray> m_FullscreenVertexArray; // 没有缓冲，顶点由 gl_VertexID 生成
+
+	uint32_t m_TargetWidth = 0;  // 离屏目标的尺寸，与渲染线程上 Resize 的结果一致
+	uint32_t m_TargetHeight = 0;
+	uint32_t m_OutputWidth = 0;
+	uint32_t m_OutputHeight = 0;
+	uint32_t m_RenderWidth = 0;
+	uint32_t m_RenderHeight = 0;
+	float m_Scale = 1.0f;
+	float m_GpuTime = 0.0f; // 平滑后的测量值
+	float m_CpuTime = 0.0f;
+	uint32_t m_StableFrames = 0;
+};
+}
@@ -0,0 +1,19 @@
+#include "Framebuffer.h"
+#include "Renderer.h"
+#include "RenderThread.h"
+#include "engine_services/platform/opengl/OpenGLFramebuffer.h"
+#include "engine_services/platform/null/NullFramebuffer.h"
+
+namespace GE {
+
+Ref<Framebuffer> Framebuffer::Create(const FramebufferSpecification& specification) {
+	switch (Renderer::GetAPI()) {
+		case RendererAPI::API::None:    ASSERT_ENGINE(false, "RendererAPI::None is currently not supported!"); return nullptr;
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLFramebuffer>(specification);
+		case RendererAPI::API::Software: ASSERT_ENGINE(false, "Framebuffers are not supported by the software renderer!"); return nullptr;
+		case RendererAPI::API::Null:    return CreateRenderResource<NullFramebuffer>(specification);
+	}
+	ASSERT_ENGINE(false, "Unknown RendererAPI!");
+	return nullptr;
+}
+}
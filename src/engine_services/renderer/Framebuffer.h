@@ -0,0 +1,92 @@
+#pragma once
+#include "core/Core.h"
+#include "core/CoreMath.h"
+#include "Texture.h"
+#include <initializer_list>
+#include <vector>
+
+// ---------------------------------------------------------------------
+// 文件: Framebuffer.h
+// 作用: 帧缓冲 / 离屏渲染目标抽象
+// 描述: 一个帧缓冲由若干颜色附件和至多一个深度附件组成，尺寸与采样数在创建时确定，可随时 Resize。
+//       Samples > 1 时附件是多重采样的渲染缓冲，只能作为渲染目标；
+//       Resolve 把它们解析到同尺寸的单采样纹理上，之后才能作为纹理采样或读取。
+//       Samples == 1 时附件本身就是纹理，Resolve 什么也不做。
+//       Renderer::BeginScene 可以以任意帧缓冲为目标，是分辨率缩放、后处理、编辑器视口和离屏截图的基础。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+enum class FramebufferTextureFormat {
+	None = 0,
+	// 颜色
+	RGBA8,
+	RGBA16F,
+	RGBA32F,
+	RedInteger,      // 32 位有符号整数，例如物体 ID
+	// 深度 / 模板
+	Depth24Stencil8,
+	Depth32F,
+
+	Depth = Depth24Stencil8
+};
+
+static inline bool IsDepthFormat(FramebufferTextureFormat format) {
+	return format == FramebufferTextureFormat::Depth24Stencil8 || format == FramebufferTextureFormat::Depth32F;
+}
+
+struct FramebufferAttachmentSpecification {
+	FramebufferTextureFormat Format = FramebufferTextureFormat::None;
+	TextureFilter Filter = TextureFilter::Linear; // 作为纹理采样时的过滤方式（整数格式总是 Nearest）
+
+	FramebufferAttachmentSpecification() = default;
+	FramebufferAttachmentSpecification(FramebufferTextureFormat format, TextureFilter filter = TextureFilter::Linear)
+		: Format(format), Filter(filter) {}
+};
+
+struct FramebufferSpecification {
+	uint32_t Width = 0;
+	uint32_t Height = 0;
+	// 按顺序对应着色器中的 layout(location = N) 输出；深度附件可以放在任意位置
+	std::vector<FramebufferAttachmentSpecification> Attachments;
+	uint32_t Samples = 1;
+
+	FramebufferSpecification() = default;
+	FramebufferSpecification(uint32_t width, uint32_t height, std::initializer_list<FramebufferAttachmentSpecification> attachments, uint32_t samples = 1)
+		: Width(width), Height(height), Attachments(attachments), Samples(samples) {}
+};
+
+class Framebuffer {
+public:
+	// 创建或 Resize 时允许的最大边长
+	static constexpr uint32_t MaxSize = 8192;
+
+	virtual ~Framebuffer() = default;
+
+	// 绑定为渲染目标，并把视口设为帧缓冲的尺寸
+	virtual void Bind() = 0;
+	// 恢复默认帧缓冲（窗口），视口由调用者恢复
+	virtual void Unbind() = 0;
+
+	// 重新分配所有附件，尺寸为 0 或超过 MaxSize 时忽略
+	virtual void Resize(uint32_t width, uint32_t height) = 0;
+	// 多重采样附件解析到单采样纹理；Samples == 1 时为空操作
+	virtual void Resolve() = 0;
+
+	// 清除单个颜色附件（浮点 / 归一化格式）
+	virtual void ClearAttachment(uint32_t attachmentIndex, const Vec4& value) = 0;
+	// 清除单个整数颜色附件 (RedInteger)
+	virtual void ClearAttachment(uint32_t attachmentIndex, int value) = 0;
+
+	// 把解析后的颜色附件绑定到纹理单元
+	virtual void BindColorAttachment(uint32_t attachmentIndex, uint32_t slot) const = 0;
+	// 解析后的颜色 / 深度纹理的对象 ID，可直接交给 ImGui::Image 等
+	virtual uint32_t GetColorAttachmentRendererID(uint32_t attachmentIndex = 0) const = 0;
+	virtual uint32_t GetDepthAttachmentRendererID() const = 0;
+	virtual uint32_t GetColorAttachmentCount() const = 0;
+
+	virtual const FramebufferSpecification& GetSpecification() const = 0;
+
+	static Ref<Framebuffer> Create(const FramebufferSpecification& specification);
+};
+}
@@ -0,0 +1,72 @@
+#include "GeometryHeap.h"
+#include "RenderCommand.h"
+#include "RenderThread.h"
+#include <vector>
+
+namespace GE {
+
+GeometryHeap::GeometryHeap(const BufferLayout& layout, uint32_t vertexCapacity, uint32_t indexCapacity)
+	: m_Layout(layout), m_VertexAllocator(vertexCapacity), m_IndexAllocator(indexCapacity) {
+	// 只分配存储，网格数据在 Allocate 时按区间上传
+	m_VertexBuffer = VertexBuffer::Create(nullptr, vertexCapacity * layout.GetStride());
+	m_IndexBuffer = IndexBuffer::Create(nullptr, indexCapacity);
+	m_VertexArray = VertexArray::Create();
+
+	RenderThread::Submit([layout, vertexArray = m_VertexArray, vertexBuffer = m_VertexBuffer, indexBuffer = m_IndexBuffer]() {
+		vertexBuffer->SetLayout(layout);
+		vertexArray->AddVertexBuffer(vertexBuffer);
+		vertexArray->SetIndexBuffer(indexBuffer);
+	});
+}
+
+GeometryAllocation GeometryHeap::Allocate(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount) {
+	GeometryAllocation allocation;
+	allocation.VertexRange = m_VertexAllocator.Allocate(vertexCount);
+	if (!allocation.VertexRange.IsValid()) {
+		LOG_WARN_ENGINE("GeometryHeap out of vertex space ({0} vertices requested)", vertexCount);
+		return allocation;
+	}
+	allocation.IndexRange = m_IndexAllocator.Allocate(indexCount);
+	if (!allocation.IndexRange.IsValid()) {
+		LOG_WARN_ENGINE("GeometryHeap out of index space ({0} indices requested)", indexCount);
+		m_VertexAllocator.Free(allocation.VertexRange);
+		allocation.VertexRange = {};
+		return allocation;
+	}
+	allocation.VertexOffset = allocation.VertexRange.Offset;
+	allocation.VertexCount = vertexCount;
+	allocation.IndexOffset = allocation.IndexRange.Offset;
+	allocation.IndexCount = indexCount;
+
+	// 调用者的数据在命令执行前可能已经释放，复制一份随命令提交
+	const uint32_t stride = m_Layout.GetStride();
+	const uint8_t* vertexBytes = static_cast<const uint8_t*>(vertices);
+	RenderThread::Submit([vertexBuffer = m_VertexBuffer, indexBuffer = m_IndexBuffer,
+		vertexData = std::vector<uint8_t>(vertexBytes, vertexBytes + vertexCount * stride),
+		indexData = std::vector<uint32_t>(indices, indices + indexCount),
+		vertexOffset = allocation.VertexOffset * stride, indexOffset = allocation.IndexOffset]() {
+		vertexBuffer->SetData(vertexData.data(), static_cast<uint32_t>(vertexData.size()), vertexOffset);
+		indexBuffer->SetData(indexData.data(), static_cast<uint32_t>(indexData.size()), indexOffset);
+	});
+	return allocation;
+}
+
+void GeometryHeap::Free(GeometryAllocation& allocation) {
+	if (!allocation.IsValid()) {
+		return;
+	}
+	m_VertexAllocator.Free(allocation.VertexRange);
+	m_IndexAllocator.Free(allocation.IndexRange);
+	allocation = {};
+}
+
+void GeometryHeap::Draw(const GeometryAllocation& allocation) const {
+	ASSERT_ENGINE(allocation.IsValid(), "Drawing an invalid geometry allocation!");
+	RenderCommand::DrawIndexedBaseVertex(m_VertexArray, allocation.IndexCount, allocation.IndexOffset,
+		static_cast<int32_t>(allocation.VertexOffset));
+}
+
+Ref<GeometryHeap> GeometryHeap::Create(const BufferLayout& layout, uint32_t vertexCapacity, uint32_t indexCapacity) {
+	return CreateRef<GeometryHeap>(layout, vertexCapacity, indexCapacity);
+}
+}
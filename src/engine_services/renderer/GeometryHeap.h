@@ -0,0 +1,57 @@
+#pragma once
+#include "VertexArray.h"
+#include "core/OffsetAllocator.h"
+
+// ---------------------------------------------------------------------
+// 类: GeometryHeap
+// 作用: 多个网格共享的几何堆
+// 描述: 同一种顶点格式的所有网格共用一个大的 VertexBuffer / IndexBuffer 和一个 VertexArray，
+//       顶点与索引区间分别由 OffsetAllocator 子分配。网格因此只是 (顶点偏移, 索引偏移, 数量) 三元组，
+//       绘制时不必切换 VAO 或缓冲，可直接合批，或转换为 DrawElementsIndirectCommand 做间接绘制。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+struct GeometryAllocation {
+	uint32_t VertexOffset = 0; // 以顶点为单位，绘制时作为 BaseVertex
+	uint32_t VertexCount = 0;
+	uint32_t IndexOffset = 0;  // 以索引为单位，绘制时作为 FirstIndex
+	uint32_t IndexCount = 0;
+	OffsetAllocator::Allocation VertexRange;
+	OffsetAllocator::Allocation IndexRange;
+
+	inline bool IsValid() const { return VertexRange.IsValid() && IndexRange.IsValid(); }
+	// 转换为一条间接绘制命令
+	inline DrawElementsIndirectCommand ToIndirectCommand(uint32_t instanceCount = 1, uint32_t baseInstance = 0) const {
+		return { IndexCount, instanceCount, IndexOffset, static_cast<int32_t>(VertexOffset), baseInstance };
+	}
+};
+
+class GeometryHeap {
+public:
+	// vertexCapacity / indexCapacity 分别为可容纳的顶点数与索引数
+	GeometryHeap(const BufferLayout& layout, uint32_t vertexCapacity, uint32_t indexCapacity);
+
+	// 分配并上传一个网格；索引是相对网格自身的（从 0 开始），空间不足时返回无效的分配
+	GeometryAllocation Allocate(const void* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount);
+	void Free(GeometryAllocation& allocation);
+
+	// 以 BaseVertex 方式绘制一个已分配的网格
+	void Draw(const GeometryAllocation& allocation) const;
+
+	inline const Ref<VertexArray>& GetVertexArray() const { return m_VertexArray; }
+	inline const BufferLayout& GetLayout() const { return m_Layout; }
+	inline OffsetAllocator::StorageReport GetVertexStorageReport() const { return m_VertexAllocator.GetStorageReport(); }
+	inline OffsetAllocator::StorageReport GetIndexStorageReport() const { return m_IndexAllocator.GetStorageReport(); }
+
+	static Ref<GeometryHeap> Create(const BufferLayout& layout, uint32_t vertexCapacity, uint32_t indexCapacity);
+private:
+	// 布局在主线程上保留一份，缓冲的 SetLayout 在渲染线程上执行
+	BufferLayout m_Layout;
+	Ref<VertexBuffer> m_VertexBuffer;
+	Ref<IndexBuffer> m_IndexBuffer;
+	Ref<VertexArray> m_VertexArray;
+	OffsetAllocator m_VertexAllocator;
+	OffsetAllocator m_IndexAllocator;
+};
+}
@@ -0,0 +1,266 @@
+#include "GpuProfiler.h"
+#include "Renderer.h"
+#include "RenderCommand.h"
+#include "RenderThread.h"
+#include "core/Log.h"
+#include "engine_services/platform/opengl/OpenGLGpuTimer.h"
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace GE {
+
+static constexpr uint32_t s_InvalidIndex = 0xFFFFFFFF;
+// 跨帧平均值的指数平滑系数
+static constexpr float s_AverageSmoothing = 0.1f;
+
+struct GpuProfilerScopeRecord {
+	std::string Name;
+	uint32_t Parent = s_InvalidIndex;
+	uint32_t Depth = 0;
+	uint32_t BeginIndex = 0;
+	uint32_t EndIndex = s_InvalidIndex;
+};
+
+// 一帧写入的查询；Scopes 只增不减，ScopeCount 之后的记录保留字符串容量供下次复用
+struct GpuProfilerBatch {
+	std::vector<GpuProfilerScopeRecord> Scopes;
+	uint32_t ScopeCount = 0;
+	uint32_t TimestampCount = 0;
+	uint32_t FrameEndIndex = 0;
+	uint64_t FrameIndex = 0;
+	bool Pending = false;
+};
+
+struct GpuProfilerData {
+	Scope<GpuTimestampPool> Pool;
+	GpuProfilerBatch Batches[GpuProfiler::FrameLatency];
+	uint32_t Batch = 0;          // 本帧写入的批次
+	uint64_t FrameIndex = 0;
+	std::atomic<bool> Enabled{ true };
+	bool InFrame = false;
+	bool Recording = false;      // 本帧是否写入时间戳
+	std::vector<uint32_t> Stack; // 未结束作用域在批次中的下标，本帧不记录时为 s_InvalidIndex
+
+	GpuProfileFrame LastFrame;     // 渲染线程上整理的结果
+	GpuProfileFrame PublishedFrame; // 交给其他线程读取的副本
+	std::mutex PublishMutex;
+	std::vector<uint64_t> Timestamps;
+	std::vector<uint32_t> RecordToScope;
+	std::vector<std::string> ScopePaths;
+	std::unordered_map<std::string, float> Averages; // 以 "父/子" 路径区分同名作用域
+};
+static GpuProfilerData s_Data;
+
+Scope<GpuTimestampPool> GpuTimestampPool::Create(uint32_t batchCount) {
+	switch (Renderer::GetAPI()) {
+		case RendererAPI::API::None:    ASSERT_ENGINE(false, "RendererAPI::None is currently not supported!"); return nullptr;
+		case RendererAPI::API::OpenGL:  return CreateScope<OpenGLGpuTimestampPool>(batchCount);
+		case RendererAPI::API::Software: return nullptr; // 没有 GPU 时间戳，作用域只推入调试分组
+		case RendererAPI::API::Null:    return nullptr;
+	}
+	ASSERT_ENGINE(false, "Unknown RendererAPI!");
+	return nullptr;
+}
+
+// 把一个已完成的批次整理为 LastFrame
+static void ResolveBatch(uint32_t batchIndex) {
+	GpuProfilerBatch& batch = s_Data.Batches[batchIndex];
+	s_Data.Timestamps.resize(batch.TimestampCount);
+	s_Data.Pool->Read(batchIndex, batch.TimestampCount, s_Data.Timestamps.data());
+	const auto toMilliseconds = [](uint64_t begin, uint64_t end) {
+		return end > begin ? static_cast<float>(static_cast<double>(end - begin) / 1000000.0) : 0.0f;
+	};
+
+	GpuProfileFrame& frame = s_Data.LastFrame;
+	const bool hasPrevious = frame.FrameIndex != 0;
+	frame.FrameIndex = batch.FrameIndex;
+	frame.Milliseconds = toMilliseconds(s_Data.Timestamps[0], s_Data.Timestamps[batch.FrameEndIndex]);
+	frame.AverageMilliseconds = hasPrevious
+		? frame.AverageMilliseconds + (frame.Milliseconds - frame.AverageMilliseconds) * s_AverageSmoothing
+		: frame.Milliseconds;
+
+	// 记录按开始的顺序排列（先序），父作用域总在子作用域之前
+	frame.Scopes.clear();
+	s_Data.ScopePaths.clear();
+	s_Data.RecordToScope.assign(batch.ScopeCount, s_InvalidIndex);
+	for (uint32_t i = 0; i < batch.ScopeCount; ++i) {
+		const GpuProfilerScopeRecord& record = batch.Scopes[i];
+		if (record.EndIndex == s_InvalidIndex) {
+			continue;
+		}
+		const uint32_t parent = record.Parent == s_InvalidIndex ? s_InvalidIndex : s_Data.RecordToScope[record.Parent];
+		uint32_t scopeIndex = s_InvalidIndex;
+		for (uint32_t j = 0; j < frame.Scopes.size(); ++j) {
+			if (frame.Scopes[j].Parent == parent && frame.Scopes[j].Name == record.Name) {
+				scopeIndex = j;
+				break;
+			}
+		}
+		if (scopeIndex == s_InvalidIndex) {
+			scopeIndex = static_cast<uint32_t>(frame.Scopes.size());
+			GpuProfileScope& scope = frame.Scopes.emplace_back();
+			scope.Name = record.Name;
+			scope.Depth = record.Depth;
+			scope.Parent = parent;
+			s_Data.ScopePaths.push_back(parent == s_InvalidIndex ? record.Name : s_Data.ScopePaths[parent] + "/" + record.Name);
+		}
+		GpuProfileScope& scope = frame.Scopes[scopeIndex];
+		scope.Count++;
+		scope.Milliseconds += toMilliseconds(s_Data.Timestamps[record.BeginIndex], s_Data.Timestamps[record.EndIndex]);
+		s_Data.RecordToScope[i] = scopeIndex;
+	}
+	for (uint32_t i = 0; i < frame.Scopes.size(); ++i) {
+		GpuProfileScope& scope = frame.Scopes[i];
+		auto [it, inserted] = s_Data.Averages.try_emplace(s_Data.ScopePaths[i], scope.Milliseconds);
+		if (!inserted) {
+			it->second += (scope.Milliseconds - it->second) * s_AverageSmoothing;
+		}
+		scope.AverageMilliseconds = it->second;
+	}
+	batch.Pending = false;
+
+	std::lock_guard<std::mutex> lock(s_Data.PublishMutex);
+	s_Data.PublishedFrame = frame;
+}
+
+void GpuProfiler::Init() {
+	s_Data.Pool = GpuTimestampPool::Create(FrameLatency);
+}
+
+void GpuProfiler::Shutdown() {
+	s_Data.Pool.reset();
+	for (GpuProfilerBatch& batch : s_Data.Batches) {
+		batch = GpuProfilerBatch();
+	}
+	s_Data.Stack.clear();
+	s_Data.InFrame = false;
+	s_Data.Recording = false;
+}
+
+void GpuProfiler::SetEnabled(bool enabled) {
+	s_Data.Enabled = enabled;
+}
+
+bool GpuProfiler::IsEnabled() {
+	return s_Data.Enabled;
+}
+
+// 以下 *Impl 都在渲染线程上执行，s_Data 中除 Enabled 与 PublishedFrame 外只由渲染线程访问
+static void EndScopeImpl() {
+	ASSERT_ENGINE(!s_Data.Stack.empty(), "GpuProfiler::EndScope without a matching BeginScope!");
+	if (s_Data.Stack.empty()) {
+		return;
+	}
+	const uint32_t index = s_Data.Stack.back();
+	s_Data.Stack.pop_back();
+	if (index != s_InvalidIndex && s_Data.Recording) {
+		GpuProfilerBatch& batch = s_Data.Batches[s_Data.Batch];
+		GpuProfilerScopeRecord& record = batch.Scopes[index];
+		record.EndIndex = batch.TimestampCount++;
+		s_Data.Pool->Write(s_Data.Batch, record.EndIndex);
+	}
+	RenderCommand::PopDebugGroup();
+}
+
+static void EndFrameImpl() {
+	if (!s_Data.InFrame) {
+		return;
+	}
+	if (!s_Data.Stack.empty()) {
+		LOG_WARN_ENGINE("GpuProfiler: {0} scope(s) not ended before EndFrame", s_Data.Stack.size());
+		while (!s_Data.Stack.empty()) {
+			EndScopeImpl();
+		}
+	}
+	if (s_Data.Recording) {
+		GpuProfilerBatch& batch = s_Data.Batches[s_Data.Batch];
+		batch.FrameEndIndex = batch.TimestampCount++;
+		s_Data.Pool->Write(s_Data.Batch, batch.FrameEndIndex);
+		batch.Pending = true;
+		s_Data.Batch = (s_Data.Batch + 1) % GpuProfiler::FrameLatency;
+	}
+	s_Data.InFrame = false;
+	s_Data.Recording = false;
+}
+
+static void BeginFrameImpl() {
+	if (!s_Data.Pool) {
+		return;
+	}
+	if (s_Data.InFrame) {
+		EndFrameImpl();
+	}
+	// s_Data.Batch 处是最早提交的批次，按提交顺序读取，遇到未完成的就停止
+	for (uint32_t i = 0; i < GpuProfiler::FrameLatency; ++i) {
+		const uint32_t batchIndex = (s_Data.Batch + i) % GpuProfiler::FrameLatency;
+		const GpuProfilerBatch& batch = s_Data.Batches[batchIndex];
+		if (!batch.Pending) {
+			continue;
+		}
+		if (!s_Data.Pool->IsAvailable(batchIndex, batch.TimestampCount)) {
+			break;
+		}
+		ResolveBatch(batchIndex);
+	}
+
+	s_Data.FrameIndex++;
+	s_Data.InFrame = true;
+	GpuProfilerBatch& batch = s_Data.Batches[s_Data.Batch];
+	// 批次仍未完成说明 GPU 落后太多，跳过本帧而不是等待
+	s_Data.Recording = s_Data.Enabled && !batch.Pending;
+	if (s_Data.Recording) {
+		batch.ScopeCount = 0;
+		batch.TimestampCount = 1;
+		batch.FrameIndex = s_Data.FrameIndex;
+		s_Data.Pool->Write(s_Data.Batch, 0);
+	}
+}
+
+static void BeginScopeImpl(const char* name) {
+	RenderCommand::PushDebugGroup(name);
+	if (!s_Data.Recording) {
+		s_Data.Stack.push_back(s_InvalidIndex);
+		return;
+	}
+	GpuProfilerBatch& batch = s_Data.Batches[s_Data.Batch];
+	const uint32_t index = batch.ScopeCount++;
+	if (index == batch.Scopes.size()) {
+		batch.Scopes.emplace_back();
+	}
+	GpuProfilerScopeRecord& record = batch.Scopes[index];
+	record.Name.assign(name);
+	record.Parent = s_Data.Stack.empty() ? s_InvalidIndex : s_Data.Stack.back();
+	record.Depth = static_cast<uint32_t>(s_Data.Stack.size());
+	record.BeginIndex = batch.TimestampCount++;
+	record.EndIndex = s_InvalidIndex;
+	s_Data.Pool->Write(s_Data.Batch, record.BeginIndex);
+	s_Data.Stack.push_back(index);
+}
+
+void GpuProfiler::BeginFrame() {
+	RenderThread::Submit([]() { BeginFrameImpl(); });
+}
+
+void GpuProfiler::EndFrame() {
+	RenderThread::Submit([]() { EndFrameImpl(); });
+}
+
+void GpuProfiler::BeginScope(const char* name) {
+	if (RenderThread::IsRenderThread()) {
+		BeginScopeImpl(name);
+		return;
+	}
+	// 名称在命令执行时才使用，复制一份
+	RenderThread::Submit([name = std::string(name)]() { BeginScopeImpl(name.c_str()); });
+}
+
+void GpuProfiler::EndScope() {
+	RenderThread::Submit([]() { EndScopeImpl(); });
+}
+
+GpuProfileFrame GpuProfiler::GetLastFrame() {
+	std::lock_guard<std::mutex> lock(s_Data.PublishMutex);
+	return s_Data.PublishedFrame;
+}
+}
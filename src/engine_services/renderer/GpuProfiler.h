@@ -0,0 +1,91 @@
+#pragma once
+#include "core/Core.h"
+#include <string>
+#include <vector>
+
+// ---------------------------------------------------------------------
+// 类: GpuProfiler
+// 作用: 按渲染通道统计每帧的 GPU 耗时
+// 描述: 每个作用域在开始和结束处各写入一个 GPU 时间戳，同时推入同名的调试分组，
+//       在 RenderDoc 等工具里也能看到同样的层次。时间戳使用 glQueryCounter 而不是 GL_TIME_ELAPSED，
+//       后者不能嵌套，而作用域通常是嵌套的。
+//       查询按帧放在 FrameLatency 个批次的环中，BeginFrame 只读取已经完成的批次，从不等待 GPU；
+//       环里的批次都还没完成（GPU 落后太多）时，本帧只推调试分组，不记录时间。
+//       因此 GetLastFrame 返回的是几帧之前的结果。
+//       BeginFrame / EndFrame / 作用域经由 RenderThread 录制，查询与整理都在渲染线程上进行。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+// 一帧中的一个作用域；同一父作用域下同名的作用域合并为一项
+struct GpuProfileScope {
+	std::string Name;
+	uint32_t Depth = 0;
+	uint32_t Parent = 0xFFFFFFFF;    // 父作用域在 Scopes 中的下标，顶层为 0xFFFFFFFF
+	uint32_t Count = 0;              // 本帧中合并的次数
+	float Milliseconds = 0.0f;       // 本帧的合计耗时
+	float AverageMilliseconds = 0.0f; // 跨帧的指数平滑值
+};
+
+struct GpuProfileFrame {
+	uint64_t FrameIndex = 0;
+	float Milliseconds = 0.0f;        // BeginFrame 到 EndFrame 之间的 GPU 时间
+	float AverageMilliseconds = 0.0f;
+	// 按首次出现的顺序（先序）排列，可以直接按 Depth 缩进显示
+	std::vector<GpuProfileScope> Scopes;
+};
+
+// 后端的时间戳查询池：分为若干批次，每批次的查询数量按需增长
+class GpuTimestampPool {
+public:
+	virtual ~GpuTimestampPool() = default;
+
+	// 在命令流的当前位置写入该批次的第 index 个时间戳
+	virtual void Write(uint32_t batch, uint32_t index) = 0;
+	// 该批次的前 count 个时间戳是否都已可读（不等待 GPU）
+	virtual bool IsAvailable(uint32_t batch, uint32_t count) const = 0;
+	// 读取该批次的前 count 个时间戳（纳秒）
+	virtual void Read(uint32_t batch, uint32_t count, uint64_t* nanoseconds) const = 0;
+
+	static Scope<GpuTimestampPool> Create(uint32_t batchCount);
+};
+
+class GpuProfiler {
+public:
+	// 同时在途的帧数，GPU 通常落后 CPU 1~3 帧
+	static constexpr uint32_t FrameLatency = 4;
+
+	// 需要当前的图形上下文，由 Renderer::Init / Shutdown 调用
+	static void Init();
+	static void Shutdown();
+
+	// 关闭后不再写入时间戳，作用域仍会推入调试分组
+	static void SetEnabled(bool enabled);
+	static bool IsEnabled();
+
+	// 由 Renderer::BeginFrame / EndFrame 调用
+	static void BeginFrame();
+	static void EndFrame();
+
+	// 作用域必须成对且在同一帧内结束，EndFrame 时未结束的作用域会被自动结束
+	static void BeginScope(const char* name);
+	static void EndScope();
+
+	// 最近一个已完成的帧，尚无结果时 FrameIndex 为 0；可在任意线程上调用，返回副本
+	static GpuProfileFrame GetLastFrame();
+};
+
+// 在当前作用域内计时，离开作用域时结束
+class GpuProfileScopeGuard {
+public:
+	GpuProfileScopeGuard(const char* name) { GpuProfiler::BeginScope(name); }
+	~GpuProfileScopeGuard() { GpuProfiler::EndScope(); }
+	GpuProfileScopeGuard(const GpuProfileScopeGuard&) = delete;
+	GpuProfileScopeGuard& operator=(const GpuProfileScopeGuard&) = delete;
+};
+}
+
+#define GPU_PROFILE_SCOPE_CONCAT_IMPL(a, b) a##b
+#define GPU_PROFILE_SCOPE_CONCAT(a, b) GPU_PROFILE_SCOPE_CONCAT_IMPL(a, b)
+// 例如 GPU_PROFILE_SCOPE("Shadows");
+#define GPU_PROFILE_SCOPE(name) ::GE::GpuProfileScopeGuard GPU_PROFILE_SCOPE_CONCAT(gpuProfileScope, __LINE__)(name)
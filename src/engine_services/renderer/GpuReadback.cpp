@@ -0,0 +1,19 @@
+#include "GpuReadback.h"
+#include "Renderer.h"
+#include "RenderThread.h"
+#include "engine_services/platform/opengl/OpenGLGpuReadback.h"
+#include "engine_services/platform/null/NullGpuReadback.h"
+
+namespace GE {
+
+Ref<GpuReadback> GpuReadback::Create() {
+	switch (Renderer::GetAPI()) {
+		case RendererAPI::API::None:    ASSERT_ENGINE(false, "RendererAPI::None is currently not supported!"); return nullptr;
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLGpuReadback>();
+		case RendererAPI::API::Software: ASSERT_ENGINE(false, "GPU readback is not supported by the software renderer!"); return nullptr;
+		case RendererAPI::API::Null:    return CreateRenderResource<NullGpuReadback>();
+	}
+	ASSERT_ENGINE(false, "Unknown RendererAPI!");
+	return nullptr;
+}
+}
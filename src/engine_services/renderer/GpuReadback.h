@@ -0,0 +1,65 @@
+#pragma once
+#include "core/Core.h"
+#include "core/Buffer.h"
+#include "Framebuffer.h"
+
+// ---------------------------------------------------------------------
+// 类: GpuReadback
+// 作用: 异步读回渲染结果
+// 描述: 同步的 glReadPixels 要等 GPU 执行完之前的所有命令，整条流水线随之停顿。
+//       这里把读取录制为命令：像素先拷贝到像素缓冲对象 (PBO) 并插入栅栏，
+//       几帧之后栅栏触发时缓冲已被映射，GetData 直接返回映射的内存，全程不等待 GPU。
+//       用于截图、物体拾取、自动化图像比对，以及逐帧录制性能回归数据。
+//
+//       读取与 Release 在主线程上调用，命令经由 RenderThread 录制；Update 每帧调用一次。
+//       同时在途的读回最多 MaxReadbacks 个，缓冲在 Release 之后复用。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+// 读回句柄，0 表示无效
+using ReadbackHandle = uint32_t;
+
+enum class ReadbackStatus {
+	Invalid = 0, // 句柄无效或已释放
+	Pending,     // GPU 尚未完成
+	Ready        // 数据可读
+};
+
+class GpuReadback {
+public:
+	// 同时存在（未 Release）的读回数量上限，按 3 帧延迟逐帧截图仍有余量
+	static constexpr uint32_t MaxReadbacks = 16;
+
+	virtual ~GpuReadback() = default;
+
+	/**
+	 * @brief 读取帧缓冲的一个颜色附件
+	 *
+	 * 读取命令的位置决定读到的内容：应在渲染完成（Resolve 之后）再调用。
+	 * 区域超出附件时截断；没有空闲的槽位时返回 0。
+	 */
+	virtual ReadbackHandle ReadColorAttachment(const Ref<Framebuffer>& framebuffer, uint32_t attachmentIndex,
+		uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
+	// 读取窗口后缓冲 (RGBA8)，应在交换缓冲区之前、需要的内容绘制完之后调用
+	virtual ReadbackHandle ReadBackbuffer(uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
+
+	// 每帧调用一次，检查在途读回的栅栏
+	virtual void Update() = 0;
+
+	virtual ReadbackStatus GetStatus(ReadbackHandle handle) const = 0;
+	/**
+	 * @brief 就绪的像素数据
+	 *
+	 * 按行紧密排列（无行对齐填充），第一行是区域的最下一行（OpenGL 约定）。
+	 * 未就绪时返回空视图；视图在 Release 之前有效。
+	 */
+	virtual BufferView GetData(ReadbackHandle handle) const = 0;
+	// 区域的宽高与每像素字节数
+	virtual void GetSize(ReadbackHandle handle, uint32_t& width, uint32_t& height, uint32_t& pixelSize) const = 0;
+	// 释放句柄，之后句柄与视图都不再有效
+	virtual void Release(ReadbackHandle handle) = 0;
+
+	static Ref<GpuReadback> Create();
+};
+}
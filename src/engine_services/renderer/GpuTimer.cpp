@@ -0,0 +1,19 @@
+#include "GpuTimer.h"
+#include "Renderer.h"
+#include "RenderThread.h"
+#include "engine_services/platform/opengl/OpenGLGpuTimer.h"
+#include "engine_services/platform/null/NullGpuTimer.h"
+
+namespace GE {
+
+Ref<GpuTimer> GpuTimer::Create() {
+	switch (Renderer::GetAPI()) {
+		case RendererAPI::API::None:    ASSERT_ENGINE(false, "RendererAPI::None is currently not supported!"); return nullptr;
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLGpuTimer>();
+		case RendererAPI::API::Software: ASSERT_ENGINE(false, "GPU timers are not supported by the software renderer!"); return nullptr;
+		case RendererAPI::API::Null:    return CreateRenderResource<NullGpuTimer>();
+	}
+	ASSERT_ENGINE(false, "Unknown RendererAPI!");
+	return nullptr;
+}
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include "core/Core.h"
+
+// ---------------------------------------------------------------------
+// 类: GpuTimer
+// 作用: 测量一段 GPU 命令的执行时间
+// 描述: Begin / End 之间提交的命令在 GPU 上实际执行的时长。结果要等 GPU 执行完才可用，
+//       后端在内部保留几帧的查询，每次 Begin 时只读取已经完成的结果，从不等待 GPU，
+//       因此 GetMilliseconds 返回的是几帧之前的测量值。每帧最多 Begin / End 一次。
+//       Begin / End 须在渲染线程上调用（放在 RenderThread::Submit 的命令中），结果可在任意线程上读取。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class GpuTimer {
+public:
+	virtual ~GpuTimer() = default;
+
+	virtual void Begin() = 0;
+	virtual void End() = 0;
+
+	// 最近一次已完成测量的耗时（毫秒）
+	virtual float GetMilliseconds() const = 0;
+	// 是否已经有至少一次完成的测量
+	virtual bool HasResult() const = 0;
+
+	static Ref<GpuTimer> Create();
+};
+}
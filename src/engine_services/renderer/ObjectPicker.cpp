@@ -0,0 +1,113 @@
+#include "ObjectPicker.h"
+#include "engine_services/core/Application.h"
+#include <algorithm>
+
+namespace GE {
+
+ObjectPicker::ObjectPicker(uint32_t radius)
+	: m_Radius(radius) {
+	m_Readback = GpuReadback::Create();
+}
+
+ObjectPicker::~ObjectPicker() {
+	for (const PendingPick& pick : m_InFlight) {
+		m_Readback->Release(pick.Handle);
+	}
+}
+
+void ObjectPicker::Pick(const Ref<Framebuffer>& target, uint32_t attachmentIndex, uint32_t x, uint32_t y) {
+	if (m_InFlight.size() >= MaxInFlight) {
+		return;
+	}
+	const FramebufferSpecification& specification = target->GetSpecification();
+	if (x >= specification.Width || y >= specification.Height) {
+		return;
+	}
+	PendingPick pick;
+	pick.X = x;
+	pick.Y = y;
+	pick.RegionX = x > m_Radius ? x - m_Radius : 0;
+	pick.RegionY = y > m_Radius ? y - m_Radius : 0;
+	// 区域超出帧缓冲右上方的部分由 GpuReadback 截断
+	const uint32_t width = x + m_Radius + 1 - pick.RegionX;
+	const uint32_t height = y + m_Radius + 1 - pick.RegionY;
+	pick.Handle = m_Readback->ReadColorAttachment(target, attachmentIndex, pick.RegionX, pick.RegionY, width, height);
+	if (!pick.Handle) {
+		return;
+	}
+	pick.RequestIndex = ++m_RequestCount;
+	m_InFlight.push_back(pick);
+}
+
+void ObjectPicker::PickAtCursor(const Ref<Framebuffer>& target, uint32_t attachmentIndex, uint32_t renderWidth, uint32_t renderHeight) {
+	const FramebufferSpecification& specification = target->GetSpecification();
+	if (renderWidth == 0 || renderHeight == 0) {
+		renderWidth = specification.Width;
+		renderHeight = specification.Height;
+	}
+	const IWindow& window = Application::Get().GetWindow();
+	if (window.GetWidth() == 0 || window.GetHeight() == 0) {
+		return;
+	}
+	const auto [cursorX, cursorY] = window.GetCursorPosition();
+	if (cursorX < 0.0f || cursorY < 0.0f) {
+		return;
+	}
+	// 窗口坐标以左上角为原点，帧缓冲以左下角为原点
+	const float u = cursorX / static_cast<float>(window.GetWidth());
+	const float v = 1.0f - cursorY / static_cast<float>(window.GetHeight());
+	if (u >= 1.0f || v <= 0.0f) {
+		return;
+	}
+	// 先在浮点数范围内限制到最后一个像素，再截断为整数
+	const float pixelX = std::clamp(u * static_cast<float>(renderWidth), 0.0f, static_cast<float>(renderWidth - 1));
+	const float pixelY = std::clamp(v * static_cast<float>(renderHeight), 0.0f, static_cast<float>(renderHeight - 1));
+	const uint32_t x = static_cast<uint32_t>(pixelX);
+	const uint32_t y = static_cast<uint32_t>(pixelY);
+	Pick(target, attachmentIndex, x, y);
+}
+
+void ObjectPicker::Update() {
+	m_Readback->Update();
+	// 按请求顺序完成，较新的结果覆盖较旧的
+	while (!m_InFlight.empty()) {
+		const PendingPick& pick = m_InFlight.front();
+		const ReadbackStatus status = m_Readback->GetStatus(pick.Handle);
+		if (status == ReadbackStatus::Pending) {
+			break;
+		}
+		if (status == ReadbackStatus::Ready) {
+			uint32_t width = 0, height = 0, pixelSize = 0;
+			m_Readback->GetSize(pick.Handle, width, height, pixelSize);
+			const BufferView data = m_Readback->GetData(pick.Handle);
+			m_LastResult.EntityID = Resolve(pick, data.As<int32_t>(), width, height);
+			m_LastResult.X = pick.X;
+			m_LastResult.Y = pick.Y;
+			m_LastResult.RequestIndex = pick.RequestIndex;
+		}
+		m_Readback->Release(pick.Handle);
+		m_InFlight.erase(m_InFlight.begin());
+	}
+}
+
+int32_t ObjectPicker::Resolve(const PendingPick& pick, const int32_t* ids, uint32_t width, uint32_t height) const {
+	int32_t result = -1;
+	uint32_t bestDistance = ~0u;
+	for (uint32_t row = 0; row < height; ++row) {
+		for (uint32_t column = 0; column < width; ++column) {
+			const int32_t id = ids[row * width + column];
+			if (id < 0) {
+				continue;
+			}
+			const int32_t dx = static_cast<int32_t>(pick.RegionX + column) - static_cast<int32_t>(pick.X);
+			const int32_t dy = static_cast<int32_t>(pick.RegionY + row) - static_cast<int32_t>(pick.Y);
+			const uint32_t distance = static_cast<uint32_t>(dx * dx + dy * dy);
+			if (distance < bestDistance) {
+				bestDistance = distance;
+				result = id;
+			}
+		}
+	}
+	return result;
+}
+}
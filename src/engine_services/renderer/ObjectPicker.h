@@ -0,0 +1,66 @@
+#pragma once
+#include "core/Core.h"
+#include "GpuReadback.h"
+#include <vector>
+
+// ---------------------------------------------------------------------
+// 类: ObjectPicker
+// 作用: 基于物体 ID 缓冲的 GPU 拾取
+// 描述: 场景通道把每个物体的 ID 写入帧缓冲的 RedInteger 附件（Renderer::Submit 的 entityID），
+//       拾取时只异步读回光标周围 (2 * Radius + 1)^2 个像素，一两帧之后得到结果。
+//       开销与场景中的物体数量无关，不需要在 CPU 上对每个物体做射线检测。
+//       光标正下方没有物体时取区域内最近的物体，便于选中细小的物体。
+//       在主线程上使用：Pick 放在场景渲染结束之后，Update 每帧调用一次。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+struct PickResult {
+	int32_t EntityID = -1;   // -1 表示没有物体
+	uint32_t X = 0;          // 请求拾取的位置（帧缓冲像素坐标，左下角为原点）
+	uint32_t Y = 0;
+	uint64_t RequestIndex = 0; // 第几次请求的结果，0 表示尚无结果
+};
+
+class ObjectPicker {
+public:
+	// 同时在途的拾取数量，超过时丢弃新的请求（例如每帧按光标悬停拾取而 GPU 落后时）
+	static constexpr uint32_t MaxInFlight = 4;
+
+	ObjectPicker(uint32_t radius = 2);
+	ObjectPicker(const ObjectPicker&) = delete;
+	ObjectPicker& operator=(const ObjectPicker&) = delete;
+	~ObjectPicker();
+
+	// 拾取帧缓冲像素 (x, y)（左下角为原点）处的物体；attachmentIndex 为 RedInteger 颜色附件的序号
+	void Pick(const Ref<Framebuffer>& target, uint32_t attachmentIndex, uint32_t x, uint32_t y);
+	/**
+	 * @brief 拾取窗口光标下的物体
+	 *
+	 * 场景只渲染在帧缓冲左下角 renderWidth × renderHeight 的区域并放大到整个窗口时（动态分辨率），
+	 * 传入该区域的尺寸；为 0 时使用帧缓冲的完整尺寸。
+	 */
+	void PickAtCursor(const Ref<Framebuffer>& target, uint32_t attachmentIndex, uint32_t renderWidth = 0, uint32_t renderHeight = 0);
+
+	// 检查在途的读回，就绪时更新 GetLastResult
+	void Update();
+
+	inline const PickResult& GetLastResult() const { return m_LastResult; }
+	inline bool HasPending() const { return !m_InFlight.empty(); }
+private:
+	struct PendingPick {
+		ReadbackHandle Handle = 0;
+		uint32_t X = 0, Y = 0;                  // 请求的位置
+		uint32_t RegionX = 0, RegionY = 0;      // 读回区域的左下角（截断后）
+		uint64_t RequestIndex = 0;
+	};
+	// 区域中距离请求位置最近的有效 ID
+	int32_t Resolve(const PendingPick& pick, const int32_t* ids, uint32_t width, uint32_t height) const;
+private:
+	uint32_t m_Radius;
+	Ref<GpuReadback> m_Readback;
+	std::vector<PendingPick> m_InFlight;
+	uint64_t m_RequestCount = 0;
+	PickResult m_LastResult;
+};
+}
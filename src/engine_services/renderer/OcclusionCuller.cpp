@@ -0,0 +1,294 @@
+#include "OcclusionCuller.h"
+#include "core/JobSystem.h"
+#include "core/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <emmintrin.h>
+#include <limits>
+
+namespace GE {
+
+OcclusionCuller::OcclusionCuller(const OcclusionCullerSpecification& specification)
+	: m_Specification(specification) {
+	ASSERT_ENGINE(specification.Width > 0 && specification.Height > 0
+		&& specification.Width % TileSize == 0 && specification.Height % TileSize == 0,
+		"Occlusion buffer size must be a non-zero multiple of the tile size!");
+	m_TilesX = specification.Width / TileSize;
+	m_TilesY = specification.Height / TileSize;
+	m_TileBins.resize(m_TilesX * m_TilesY);
+
+	uint32_t width = specification.Width;
+	uint32_t height = specification.Height;
+	while (true) {
+		m_Levels.push_back({ width, height, std::vector<float>(width * height, 1.0f) });
+		if (width == 1 && height == 1) {
+			break;
+		}
+		width = (width + 1) / 2;
+		height = (height + 1) / 2;
+	}
+}
+
+void OcclusionCuller::BeginFrame(const Mat4& viewProjection) {
+	m_ViewProjection = viewProjection;
+	m_Rasterized = false;
+	m_Occluders.clear();
+	m_Statistics = {};
+}
+
+void OcclusionCuller::AddOccluder(const Vec3* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount,
+	const Mat4& transform) {
+	ASSERT_ENGINE(!m_Rasterized, "AddOccluder must be called before Rasterize!");
+	if (!vertices || !indices || indexCount < 3) {
+		return;
+	}
+	m_Occluders.push_back({ vertices, vertexCount, indices, indexCount, transform, 0 });
+}
+
+void OcclusionCuller::Rasterize() {
+	const auto start = std::chrono::steady_clock::now();
+	const float width = static_cast<float>(m_Specification.Width);
+	const float height = static_cast<float>(m_Specification.Height);
+
+	uint32_t triangleCount = 0;
+	for (Occluder& occluder : m_Occluders) {
+		occluder.FirstTriangle = triangleCount;
+		triangleCount += occluder.IndexCount / 3;
+	}
+	m_Triangles.resize(triangleCount);
+
+	// 1. 变换到屏幕空间，剔除跨过近平面、退化或完全在屏幕外的三角形
+	JobContext context;
+	JobSystem::Dispatch(context, static_cast<uint32_t>(m_Occluders.size()), 1, [this, width, height](JobDispatchArgs args) {
+		const Occluder& occluder = m_Occluders[args.JobIndex];
+		const Mat4 matrix = m_ViewProjection * occluder.Transform;
+		const uint32_t count = occluder.IndexCount / 3;
+		for (uint32_t i = 0; i < count; ++i) {
+			ScreenTriangle& triangle = m_Triangles[occluder.FirstTriangle + i];
+			triangle.Valid = false;
+			bool clipped = false;
+			for (uint32_t corner = 0; corner < 3; ++corner) {
+				const uint32_t index = occluder.Indices[i * 3 + corner];
+				ASSERT_ENGINE(index < occluder.VertexCount, "Occluder index out of range!");
+				const Vec4 clip = matrix * Vec4(occluder.Vertices[index], 1.0f);
+				if (clip.w <= 0.0f || clip.z < -clip.w) {
+					clipped = true;
+					break;
+				}
+				const float inverseW = 1.0f / clip.w;
+				triangle.X[corner] = (clip.x * inverseW * 0.5f + 0.5f) * width;
+				triangle.Y[corner] = (clip.y * inverseW * 0.5f + 0.5f) * height;
+				triangle.Z[corner] = std::min(clip.z * inverseW * 0.5f + 0.5f, 1.0f);
+			}
+			if (clipped) {
+				continue;
+			}
+			const float minX = std::min({ triangle.X[0], triangle.X[1], triangle.X[2] });
+			const float maxX = std::max({ triangle.X[0], triangle.X[1], triangle.X[2] });
+			const float minY = std::min({ triangle.Y[0], triangle.Y[1], triangle.Y[2] });
+			const float maxY = std::max({ triangle.Y[0], triangle.Y[1], triangle.Y[2] });
+			const float area = (triangle.X[1] - triangle.X[0]) * (triangle.Y[2] - triangle.Y[0])
+				- (triangle.Y[1] - triangle.Y[0]) * (triangle.X[2] - triangle.X[0]);
+			triangle.Valid = maxX > 0.0f && minX < width && maxY > 0.0f && minY < height && std::abs(area) > 1e-6f;
+		}
+	});
+	JobSystem::Wait(context);
+
+	// 2. 按包围矩形分入瓦片
+	for (std::vector<uint32_t>& bin : m_TileBins) {
+		bin.clear();
+	}
+	m_Statistics.Occluders = static_cast<uint32_t>(m_Occluders.size());
+	m_Statistics.Triangles = triangleCount;
+	for (uint32_t i = 0; i < triangleCount; ++i) {
+		const ScreenTriangle& triangle = m_Triangles[i];
+		if (!triangle.Valid) {
+			continue;
+		}
+		m_Statistics.RasterizedTriangles++;
+		auto toTile = [](float value, uint32_t tiles) {
+			return static_cast<uint32_t>(std::clamp(value / TileSize, 0.0f, static_cast<float>(tiles - 1)));
+		};
+		const uint32_t minTileX = toTile(std::min({ triangle.X[0], triangle.X[1], triangle.X[2] }), m_TilesX);
+		const uint32_t maxTileX = toTile(std::max({ triangle.X[0], triangle.X[1], triangle.X[2] }), m_TilesX);
+		const uint32_t minTileY = toTile(std::min({ triangle.Y[0], triangle.Y[1], triangle.Y[2] }), m_TilesY);
+		const uint32_t maxTileY = toTile(std::max({ triangle.Y[0], triangle.Y[1], triangle.Y[2] }), m_TilesY);
+		for (uint32_t tileY = minTileY; tileY <= maxTileY; ++tileY) {
+			for (uint32_t tileX = minTileX; tileX <= maxTileX; ++tileX) {
+				m_TileBins[tileY * m_TilesX + tileX].push_back(i);
+			}
+		}
+	}
+
+	// 3. 各瓦片并行光栅化，并生成瓦片内的 HiZ 级别
+	JobSystem::Dispatch(context, m_TilesX * m_TilesY, 1, [this](JobDispatchArgs args) {
+		RasterizeTile(args.JobIndex % m_TilesX, args.JobIndex / m_TilesX);
+	});
+	JobSystem::Wait(context);
+
+	// 比瓦片更粗的级别很小，直接生成
+	uint32_t tileLevels = 0;
+	while ((1u << tileLevels) < TileSize) {
+		tileLevels++;
+	}
+	for (uint32_t level = tileLevels + 1; level < m_Levels.size(); ++level) {
+		Downsample(level, 0, 0, m_Levels[level].Width, m_Levels[level].Height);
+	}
+
+	m_Rasterized = true;
+	m_Statistics.RasterizeMilliseconds = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void OcclusionCuller::RasterizeTile(uint32_t tileX, uint32_t tileY) {
+	const uint32_t minX = tileX * TileSize;
+	const uint32_t minY = tileY * TileSize;
+	DepthLevel& depth = m_Levels[0];
+	for (uint32_t y = minY; y < minY + TileSize; ++y) {
+		std::fill_n(depth.Depth.data() + y * depth.Width + minX, TileSize, 1.0f);
+	}
+	for (uint32_t index : m_TileBins[tileY * m_TilesX + tileX]) {
+		RasterizeTriangle(m_Triangles[index], minX, minY);
+	}
+	// 瓦片内的 HiZ：第 level 级在本瓦片中占 (TileSize >> level)^2 个像素
+	for (uint32_t level = 1; (TileSize >> level) > 0 && level < m_Levels.size(); ++level) {
+		const uint32_t size = TileSize >> level;
+		Downsample(level, tileX * size, tileY * size, (tileX + 1) * size, (tileY + 1) * size);
+	}
+}
+
+void OcclusionCuller::RasterizeTriangle(const ScreenTriangle& triangle, uint32_t tileMinX, uint32_t tileMinY) {
+	float x0 = triangle.X[0], y0 = triangle.Y[0], z0 = triangle.Z[0];
+	float x1 = triangle.X[1], y1 = triangle.Y[1], z1 = triangle.Z[1];
+	float x2 = triangle.X[2], y2 = triangle.Y[2], z2 = triangle.Z[2];
+	float area = (x1 - x0) * (y2 - y0) - (y1 - y0) * (x2 - x0);
+	// 统一为正面积，两种环绕方向都光栅化
+	if (area < 0.0f) {
+		std::swap(x1, x2);
+		std::swap(y1, y2);
+		std::swap(z1, z2);
+		area = -area;
+	}
+
+	// 像素中心采样，包围矩形限制在瓦片内；起点按 4 像素对齐（瓦片宽度是 4 的倍数）
+	// 先在浮点下限制到瓦片范围，远在屏幕外的顶点转换为整数时不会溢出
+	const float tileLeft = static_cast<float>(tileMinX), tileRight = static_cast<float>(tileMinX + TileSize - 1);
+	const float tileBottom = static_cast<float>(tileMinY), tileTop = static_cast<float>(tileMinY + TileSize - 1);
+	const int32_t minX = static_cast<int32_t>(std::clamp(std::floor(std::min({ x0, x1, x2 })), tileLeft, tileRight)) & ~3;
+	const int32_t maxX = static_cast<int32_t>(std::clamp(std::ceil(std::max({ x0, x1, x2 })), tileLeft, tileRight));
+	const int32_t minY = static_cast<int32_t>(std::clamp(std::floor(std::min({ y0, y1, y2 })), tileBottom, tileTop));
+	const int32_t maxY = static_cast<int32_t>(std::clamp(std::ceil(std::max({ y0, y1, y2 })), tileBottom, tileTop));
+	if (minX > maxX || minY > maxY) {
+		return;
+	}
+
+	// 边函数 E(x, y) = A * x + B * y + C，三角形内部三者均不小于 0
+	const float a0 = y1 - y2, b0 = x2 - x1, c0 = -(a0 * x1 + b0 * y1);
+	const float a1 = y2 - y0, b1 = x0 - x2, c1 = -(a1 * x2 + b1 * y2);
+	const float a2 = y0 - y1, b2 = x1 - x0, c2 = -(a2 * x0 + b2 * y0);
+	// 深度平面 z = z0 + dzdx * (x - x0) + dzdy * (y - y0)
+	const float inverseArea = 1.0f / area;
+	const float dzdx = ((z1 - z0) * (y2 - y0) - (z2 - z0) * (y1 - y0)) * inverseArea;
+	const float dzdy = ((z2 - z0) * (x1 - x0) - (z1 - z0) * (x2 - x0)) * inverseArea;
+
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 a0x4 = _mm_set1_ps(a0), a1x4 = _mm_set1_ps(a1), a2x4 = _mm_set1_ps(a2);
+	const __m128 dzdx4 = _mm_set1_ps(dzdx);
+	const __m128 laneOffsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+	DepthLevel& depth = m_Levels[0];
+
+	for (int32_t y = minY; y <= maxY; ++y) {
+		const float py = static_cast<float>(y) + 0.5f;
+		const __m128 row0 = _mm_set1_ps(b0 * py + c0);
+		const __m128 row1 = _mm_set1_ps(b1 * py + c1);
+		const __m128 row2 = _mm_set1_ps(b2 * py + c2);
+		const __m128 rowZ = _mm_set1_ps(z0 + dzdy * (py - y0) - dzdx * x0);
+		float* rowDepth = depth.Depth.data() + static_cast<uint32_t>(y) * depth.Width;
+		for (int32_t x = minX; x <= maxX; x += 4) {
+			const __m128 px = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneOffsets);
+			const __m128 e0 = _mm_add_ps(_mm_mul_ps(a0x4, px), row0);
+			const __m128 e1 = _mm_add_ps(_mm_mul_ps(a1x4, px), row1);
+			const __m128 e2 = _mm_add_ps(_mm_mul_ps(a2x4, px), row2);
+			const __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, zero), _mm_cmpge_ps(e1, zero)), _mm_cmpge_ps(e2, zero));
+			if (_mm_movemask_ps(inside) == 0) {
+				continue;
+			}
+			const __m128 z = _mm_add_ps(_mm_mul_ps(dzdx4, px), rowZ);
+			const __m128 current = _mm_loadu_ps(rowDepth + x);
+			const __m128 nearest = _mm_min_ps(current, z);
+			_mm_storeu_ps(rowDepth + x, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, current)));
+		}
+	}
+}
+
+void OcclusionCuller::Downsample(uint32_t level, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1) {
+	const DepthLevel& source = m_Levels[level - 1];
+	DepthLevel& target = m_Levels[level];
+	for (uint32_t y = y0; y < y1; ++y) {
+		const uint32_t sourceY0 = y * 2;
+		const uint32_t sourceY1 = std::min(sourceY0 + 1, source.Height - 1);
+		for (uint32_t x = x0; x < x1; ++x) {
+			const uint32_t sourceX0 = x * 2;
+			const uint32_t sourceX1 = std::min(sourceX0 + 1, source.Width - 1);
+			const float farthest = std::max(
+				std::max(source.Depth[sourceY0 * source.Width + sourceX0], source.Depth[sourceY0 * source.Width + sourceX1]),
+				std::max(source.Depth[sourceY1 * source.Width + sourceX0], source.Depth[sourceY1 * source.Width + sourceX1]));
+			target.Depth[y * target.Width + x] = farthest;
+		}
+	}
+}
+
+bool OcclusionCuller::IsVisible(const Vec3& boundsMin, const Vec3& boundsMax, const Mat4& transform) const {
+	const Mat4 matrix = m_ViewProjection * transform;
+	float minX = std::numeric_limits<float>::max(), maxX = -std::numeric_limits<float>::max();
+	float minY = std::numeric_limits<float>::max(), maxY = -std::numeric_limits<float>::max();
+	float minZ = std::numeric_limits<float>::max();
+	for (uint32_t corner = 0; corner < 8; ++corner) {
+		const Vec3 position((corner & 1) ? boundsMax.x : boundsMin.x,
+			(corner & 2) ? boundsMax.y : boundsMin.y,
+			(corner & 4) ? boundsMax.z : boundsMin.z);
+		const Vec4 clip = matrix * Vec4(position, 1.0f);
+		// 包围盒跨过近平面，无法给出可靠的屏幕范围
+		if (clip.w <= 0.0f || clip.z < -clip.w) {
+			return true;
+		}
+		const float inverseW = 1.0f / clip.w;
+		minX = std::min(minX, clip.x * inverseW);
+		maxX = std::max(maxX, clip.x * inverseW);
+		minY = std::min(minY, clip.y * inverseW);
+		maxY = std::max(maxY, clip.y * inverseW);
+		minZ = std::min(minZ, clip.z * inverseW);
+	}
+	// 视锥测试
+	if (maxX < -1.0f || minX > 1.0f || maxY < -1.0f || minY > 1.0f || minZ > 1.0f) {
+		return false;
+	}
+	if (!m_Rasterized) {
+		return true;
+	}
+
+	const DepthLevel& base = m_Levels[0];
+	auto toPixel = [](float ndc, uint32_t size) {
+		const float pixel = (ndc * 0.5f + 0.5f) * static_cast<float>(size);
+		return static_cast<uint32_t>(std::clamp(pixel, 0.0f, static_cast<float>(size - 1)));
+	};
+	const uint32_t pixelMinX = toPixel(minX, base.Width), pixelMaxX = toPixel(maxX, base.Width);
+	const uint32_t pixelMinY = toPixel(minY, base.Height), pixelMaxY = toPixel(maxY, base.Height);
+	// 选择使矩形至多覆盖 2×2 个像素跨度（3×3 个像素）的级别
+	uint32_t level = 0;
+	while (level + 1 < m_Levels.size()
+		&& ((pixelMaxX >> level) - (pixelMinX >> level) > 1 || (pixelMaxY >> level) - (pixelMinY >> level) > 1)) {
+		level++;
+	}
+	const DepthLevel& hiz = m_Levels[level];
+	const float nearestDepth = minZ * 0.5f + 0.5f;
+	for (uint32_t y = pixelMinY >> level; y <= (pixelMaxY >> level); ++y) {
+		for (uint32_t x = pixelMinX >> level; x <= (pixelMaxX >> level); ++x) {
+			if (nearestDepth <= hiz.Depth[y * hiz.Width + x]) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+}
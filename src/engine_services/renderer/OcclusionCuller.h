@@ -0,0 +1,116 @@
+#pragma once
+#include "core/Core.h"
+#include "core/CoreMath.h"
+#include <vector>
+
+// ---------------------------------------------------------------------
+// 类: OcclusionCuller
+// 作用: CPU 软件遮挡剔除
+// 描述: 把少量简化的遮挡体网格（墙、地形块等）光栅化到低分辨率的深度缓冲，
+//       再由深度缓冲生成层次深度 (HiZ，每级保存 2×2 中最远的深度)。提交绘制之前，
+//       被遮挡物用包围盒的屏幕矩形与最近深度在 HiZ 的某一级上查询至多 3×3 个像素，
+//       完全落在遮挡体之后的物体不再提交，GPU 不必为看不见的物体付出顶点与过度绘制的开销。
+//
+//       光栅化分三步：各遮挡体的变换在 JobSystem 上并行；三角形按包围矩形分入 TileSize 的瓦片；
+//       各瓦片并行光栅化并生成瓦片内的 HiZ 级别，每个任务只写自己的瓦片，无需同步。
+//       像素以 SSE 每次处理 4 个：边函数与深度平面按行增量求值，深度取最近值。
+//
+//       剔除是保守的：跨过近平面的遮挡三角形被跳过，跨过近平面的被遮挡物总是可见，
+//       因此只会少剔除，不会错误地剔除可见物体（遮挡体本身应不大于它所代表的几何体）。
+//       用法：
+//
+//           culler.BeginFrame(viewProjection);
+//           culler.AddOccluder(...);           // 每个遮挡体
+//           culler.Rasterize();
+//           if (culler.IsVisible(min, max, transform)) Renderer::Submit(...);
+//
+//       IsVisible 是只读的，Rasterize 之后可以在多个线程上同时调用。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+struct OcclusionCullerSpecification {
+	// 深度缓冲的尺寸，必须是 TileSize 的整数倍；远小于屏幕分辨率即可
+	uint32_t Width = 256;
+	uint32_t Height = 128;
+};
+
+struct OcclusionCullerStatistics {
+	uint32_t Occluders = 0;
+	uint32_t Triangles = 0;          // 遮挡体的三角形总数
+	uint32_t RasterizedTriangles = 0; // 通过近平面与屏幕剔除的三角形
+	float RasterizeMilliseconds = 0.0f; // Rasterize 的 CPU 耗时
+};
+
+class OcclusionCuller {
+public:
+	// 瓦片的边长（像素），也是瓦片任务内部生成的 HiZ 级数 log2(TileSize)
+	static constexpr uint32_t TileSize = 32;
+
+	OcclusionCuller(const OcclusionCullerSpecification& specification = {});
+
+	// 清空深度缓冲与遮挡体；viewProjection 为本帧场景相机的矩阵（OpenGL 裁剪空间）
+	void BeginFrame(const Mat4& viewProjection);
+	/**
+	 * @brief 添加一个遮挡体（三角形列表）
+	 *
+	 * 只记录指针，顶点与索引必须保持有效直到 Rasterize 返回。
+	 * transform 为模型矩阵。两种环绕方向都会被光栅化。
+	 */
+	void AddOccluder(const Vec3* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount,
+		const Mat4& transform = Mat4(1.0f));
+	// 光栅化本帧的遮挡体并生成 HiZ
+	void Rasterize();
+
+	/**
+	 * @brief 模型空间的包围盒是否可能可见
+	 *
+	 * 完全在视锥之外或完全被遮挡时返回 false。在 Rasterize 之前调用时只做视锥测试。
+	 */
+	bool IsVisible(const Vec3& boundsMin, const Vec3& boundsMax, const Mat4& transform = Mat4(1.0f)) const;
+
+	inline const OcclusionCullerStatistics& GetStatistics() const { return m_Statistics; }
+	inline const OcclusionCullerSpecification& GetSpecification() const { return m_Specification; }
+	// HiZ 的第 level 级（第 0 级即深度缓冲），深度为 [0, 1]，1 为远平面；用于调试显示
+	inline const std::vector<float>& GetDepthLevel(uint32_t level) const { return m_Levels[level].Depth; }
+	inline uint32_t GetLevelCount() const { return static_cast<uint32_t>(m_Levels.size()); }
+private:
+	struct Occluder {
+		const Vec3* Vertices;
+		uint32_t VertexCount;
+		const uint32_t* Indices;
+		uint32_t IndexCount;
+		Mat4 Transform;
+		uint32_t FirstTriangle; // 在 m_Triangles 中的起始位置
+	};
+	// 屏幕空间的三角形（像素坐标与 [0, 1] 深度），Valid 为 false 时已被剔除
+	struct ScreenTriangle {
+		float X[3];
+		float Y[3];
+		float Z[3];
+		bool Valid;
+	};
+	struct DepthLevel {
+		uint32_t Width;
+		uint32_t Height;
+		std::vector<float> Depth;
+	};
+
+	void RasterizeTile(uint32_t tileX, uint32_t tileY);
+	void RasterizeTriangle(const ScreenTriangle& triangle, uint32_t tileMinX, uint32_t tileMinY);
+	// 由上一级生成 level 级在 [x0, x1) × [y0, y1) 范围内的像素
+	void Downsample(uint32_t level, uint32_t x0, uint32_t y0, uint32_t x1, uint32_t y1);
+private:
+	OcclusionCullerSpecification m_Specification;
+	uint32_t m_TilesX;
+	uint32_t m_TilesY;
+	Mat4 m_ViewProjection{ 1.0f };
+	bool m_Rasterized = false;
+
+	std::vector<Occluder> m_Occluders;
+	std::vector<ScreenTriangle> m_Triangles;
+	std::vector<std::vector<uint32_t>> m_TileBins; // 每个瓦片覆盖到的三角形
+	std::vector<DepthLevel> m_Levels;
+	OcclusionCullerStatistics m_Statistics;
+};
+}
@@ -17,4 +17,9 @@ namespace GE {
 		s_RendererAPI->Init();
 	}
 
+	void RenderCommand::Shutdown()
+	{
+		s_RendererAPI->Shutdown();
+	}
+
 }
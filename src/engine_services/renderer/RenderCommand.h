@@ -1,13 +1,14 @@
 #pragma once
 #include "RendererAPI.h"
+#include "RenderThread.h"
 
 // ---------------------------------------------------------------------
 // 类: RenderCommand
 // 作用: 渲染命令队列 / 代理 (Facade)
 // 描述: 提供了一个静态接口来执行渲染命令。
 //       实际上它并不直接执行逻辑，而是将请求转发给内部持有的 s_RendererAPI 实例。
-//       这种设计允许我们在未来轻松添加多线程渲染或渲染命令队列（Render Queue）功能，
-//       而不必修改上层调用代码。
+//       每个命令都经由 RenderThread 录制，多线程模式下由渲染线程在下一帧执行，
+//       单线程模式下立即执行；上层调用代码不必区分。
 // ---------------------------------------------------------------------
 
 namespace GE {
@@ -16,26 +17,66 @@ class RenderCommand {
 public:
 	// 初始化渲染系统
 	static void Init();
+	// 在主线程持有上下文时调用（渲染线程已停止）
+	static void Shutdown();
 	// 设置视口区域
 	inline static void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
-		s_RendererAPI->SetViewport(x, y, width, height);
+		RenderThread::Submit([=]() { s_RendererAPI->SetViewport(x, y, width, height); });
 	}
 	// 设置清屏颜色
 	inline static void SetClearColor(const Vec4& color) {
-		s_RendererAPI->SetClearColor(color);
+		RenderThread::Submit([=]() { s_RendererAPI->SetClearColor(color); });
 	}
 	// 执行清屏
 	inline static void Clear() {
-		s_RendererAPI->Clear();
+		RenderThread::Submit([]() { s_RendererAPI->Clear(); });
 	}
 	// 执行索引绘制
 	// 自动绑定 VertexArray，然后调用底层 API 的绘制命令
 	inline static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) {
-		vertexArray->Bind();
-		s_RendererAPI->DrawIndexed(vertexArray, indexCount);
+		RenderThread::Submit([=]() {
+			vertexArray->Bind();
+			s_RendererAPI->DrawIndexed(vertexArray, indexCount);
+		});
+	}
+	// 非索引绘制，顶点数组可以为空（顶点由着色器生成）
+	inline static void DrawArrays(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0) {
+		RenderThread::Submit([=]() {
+			s_RendererAPI->DrawArrays(vertexArray, vertexCount, firstVertex);
+		});
+	}
+	// 绘制共享顶点/索引缓冲中的一段区间
+	inline static void DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t firstIndex, int32_t baseVertex) {
+		RenderThread::Submit([=]() {
+			vertexArray->Bind();
+			s_RendererAPI->DrawIndexedBaseVertex(vertexArray, indexCount, firstIndex, baseVertex);
+		});
+	}
+	// 执行多重间接绘制，一次调用提交 indirectBuffer 中的 drawCount 条绘制命令
+	inline static void DrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<IndirectBuffer>& indirectBuffer,
+		uint32_t drawCount, uint32_t firstCommand = 0) {
+		RenderThread::Submit([=]() {
+			vertexArray->Bind();
+			s_RendererAPI->DrawIndexedIndirect(vertexArray, indirectBuffer, drawCount, firstCommand);
+		});
+	}
+	// 调试分组，须成对调用；name 在命令执行时才被读取，需为字符串字面量等长期有效的字符串
+	inline static void PushDebugGroup(const char* name) {
+		RenderThread::Submit([=]() { s_RendererAPI->PushDebugGroup(name); });
+	}
+	inline static void PopDebugGroup() {
+		RenderThread::Submit([]() { s_RendererAPI->PopDebugGroup(); });
+	}
+	// 帧结束，交给后端处理跨帧的工作
+	inline static void EndFrame() {
+		RenderThread::Submit([]() { s_RendererAPI->EndFrame(); });
 	}
 
 private:
+	// Renderer 在渲染线程上回放排序后的绘制时直接调用后端，自行管理状态绑定
+	friend class Renderer;
+	// 回放空后端录制的命令时同样直接调用后端
+	friend class NullCommandReplayer;
 	// 全局唯一的渲染 API 实例指针
 	static Scope<RendererAPI> s_RendererAPI;
 };
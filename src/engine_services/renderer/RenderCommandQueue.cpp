@@ -0,0 +1,68 @@
+#include "RenderCommandQueue.h"
+#include "core/Log.h"
+#include <algorithm>
+#include <cstddef>
+
+namespace GE {
+
+// 页按 max_align_t 对齐，命令的对齐要求不能超过它
+static constexpr size_t s_PageAlignment = alignof(std::max_align_t);
+
+static inline uint32_t AlignUp(uint32_t value, uint32_t alignment) {
+	return (value + alignment - 1) & ~(alignment - 1);
+}
+
+RenderCommandQueue::~RenderCommandQueue() {
+	// 未执行的命令仍需析构，释放它们捕获的资源
+	Execute();
+	for (Page& page : m_Pages) {
+		::operator delete(page.Data, std::align_val_t(s_PageAlignment));
+	}
+}
+
+void* RenderCommandQueue::Allocate(uint32_t size, uint32_t alignment, CommandFn execute) {
+	alignment = std::max<uint32_t>(alignment, alignof(CommandHeader));
+	ASSERT_ENGINE(alignment <= s_PageAlignment, "Render command alignment is not supported!");
+	const uint32_t offset = AlignUp(sizeof(CommandHeader), alignment);
+	const uint32_t total = AlignUp(offset + size, alignof(CommandHeader));
+
+	// 当前页放不下时依次尝试后面保留的页，都不够就新建一页
+	while (m_CurrentPage < m_Pages.size()) {
+		Page& page = m_Pages[m_CurrentPage];
+		if (page.Used + total <= page.Capacity) {
+			break;
+		}
+		m_CurrentPage++;
+	}
+	if (m_CurrentPage == m_Pages.size()) {
+		Page page;
+		page.Capacity = std::max(PageSize, total);
+		page.Data = static_cast<uint8_t*>(::operator new(page.Capacity, std::align_val_t(s_PageAlignment)));
+		m_Pages.push_back(page);
+	}
+	Page& page = m_Pages[m_CurrentPage];
+	CommandHeader* header = reinterpret_cast<CommandHeader*>(page.Data + page.Used);
+	header->Execute = execute;
+	header->Offset = offset;
+	header->Size = total;
+	page.Used += total;
+	m_CommandCount++;
+	m_UsedBytes += total;
+	return reinterpret_cast<uint8_t*>(header) + offset;
+}
+
+void RenderCommandQueue::Execute() {
+	for (Page& page : m_Pages) {
+		uint32_t position = 0;
+		while (position < page.Used) {
+			CommandHeader* header = reinterpret_cast<CommandHeader*>(page.Data + position);
+			header->Execute(reinterpret_cast<uint8_t*>(header) + header->Offset);
+			position += header->Size;
+		}
+		page.Used = 0;
+	}
+	m_CurrentPage = 0;
+	m_CommandCount = 0;
+	m_UsedBytes = 0;
+}
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include "core/Core.h"
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// ---------------------------------------------------------------------
+// 类: RenderCommandQueue
+// 作用: 线性的渲染命令缓冲
+// 描述: 每条命令是一个可调用对象（通常是 lambda），连同执行函数指针一起按顺序
+//       就地构造在大块内存中，不为单条命令分配堆内存。内存按页增长，页在 Execute 之后保留，
+//       稳定运行时录制一帧的命令不再分配内存。已录制的命令不会移动，因此可以捕获任意类型（包括 Ref）。
+//       本身不加锁：由 RenderThread 保证同一时刻只有一个线程录制或执行。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class RenderCommandQueue {
+public:
+	// 每页的大小；超过一页的命令单独占一页
+	static constexpr uint32_t PageSize = 256 * 1024;
+
+	RenderCommandQueue() = default;
+	~RenderCommandQueue();
+	RenderCommandQueue(const RenderCommandQueue&) = delete;
+	RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+	template<typename FuncT>
+	void Submit(FuncT&& func) {
+		using Command = std::decay_t<FuncT>;
+		// 执行后立即析构，释放命令捕获的资源
+		auto execute = [](void* storage) {
+			Command* command = static_cast<Command*>(storage);
+			(*command)();
+			command->~Command();
+		};
+		void* storage = Allocate(sizeof(Command), alignof(Command), execute);
+		new (storage) Command(std::forward<FuncT>(func));
+	}
+
+	// 按录制顺序执行并清空所有命令
+	void Execute();
+
+	inline uint32_t GetCommandCount() const { return m_CommandCount; }
+	// 已录制命令占用的字节数（含对齐与命令头）
+	inline uint64_t GetUsedBytes() const { return m_UsedBytes; }
+private:
+	using CommandFn = void(*)(void*);
+	struct CommandHeader {
+		CommandFn Execute;
+		uint32_t Offset;  // 命令对象相对于命令头的偏移
+		uint32_t Size;    // 命令头到下一条命令的距离
+	};
+	struct Page {
+		uint8_t* Data = nullptr;
+		uint32_t Capacity = 0;
+		uint32_t Used = 0;
+	};
+
+	void* Allocate(uint32_t size, uint32_t alignment, CommandFn execute);
+private:
+	std::vector<Page> m_Pages;
+	uint32_t m_CurrentPage = 0;
+	uint32_t m_CommandCount = 0;
+	uint64_t m_UsedBytes = 0;
+};
+}
@@ -0,0 +1,212 @@
+#include "RenderThread.h"
+#include "engine_services/core/GraphicsContext.h"
+#include "core/Log.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace GE {
+
+struct RenderThreadInvoke {
+	const std::function<void()>* Func = nullptr;
+	bool Done = false;
+};
+
+struct RenderThreadData {
+	IGraphicsContext* Context = nullptr;
+	std::atomic<RenderThreadPolicy> Policy{ RenderThreadPolicy::SingleThreaded };
+	std::thread Thread;
+	std::thread::id RenderThreadID; // 持有上下文的线程，只在切换模式时修改
+	std::thread::id MainThreadID;
+
+	// 主线程录制 Queues[SubmitIndex]，渲染线程执行另一个
+	RenderCommandQueue Queues[2];
+	uint32_t SubmitIndex = 0;
+
+	std::mutex Mutex;
+	std::condition_variable Condition;
+	bool FramePending = false;   // 已交给渲染线程、尚未执行完的一帧
+	bool Running = false;
+	std::deque<RenderThreadInvoke*> Invokes;
+
+	// 其他线程释放的资源，等待主线程提交析构命令
+	std::mutex ReleaseMutex;
+	std::vector<std::function<void()>> DeferredReleases;
+
+	uint32_t LastFrameCommandCount = 0;
+	uint64_t LastFrameCommandBytes = 0;
+};
+static RenderThreadData s_Data;
+
+static void RenderThreadMain() {
+	s_Data.Context->MakeCurrent();
+	std::unique_lock<std::mutex> lock(s_Data.Mutex);
+	while (true) {
+		s_Data.Condition.wait(lock, [] { return s_Data.FramePending || !s_Data.Invokes.empty() || !s_Data.Running; });
+		while (!s_Data.Invokes.empty()) {
+			RenderThreadInvoke* invoke = s_Data.Invokes.front();
+			s_Data.Invokes.pop_front();
+			lock.unlock();
+			(*invoke->Func)();
+			lock.lock();
+			invoke->Done = true;
+			s_Data.Condition.notify_all();
+		}
+		if (s_Data.FramePending) {
+			// 主线程在 FramePending 清除之前不会触碰这个队列
+			RenderCommandQueue& queue = s_Data.Queues[s_Data.SubmitIndex ^ 1];
+			lock.unlock();
+			queue.Execute();
+			lock.lock();
+			s_Data.FramePending = false;
+			s_Data.Condition.notify_all();
+			continue;
+		}
+		if (!s_Data.Running) {
+			break;
+		}
+	}
+	lock.unlock();
+	s_Data.Context->ReleaseCurrent();
+}
+
+// 等待上一帧执行完毕，把已录制的命令交给渲染线程
+static void KickFrame() {
+	std::unique_lock<std::mutex> lock(s_Data.Mutex);
+	s_Data.Condition.wait(lock, [] { return !s_Data.FramePending; });
+	RenderCommandQueue& queue = s_Data.Queues[s_Data.SubmitIndex];
+	s_Data.LastFrameCommandCount = queue.GetCommandCount();
+	s_Data.LastFrameCommandBytes = queue.GetUsedBytes();
+	s_Data.SubmitIndex ^= 1;
+	s_Data.FramePending = true;
+	s_Data.Condition.notify_all();
+}
+
+static void WaitForFrame() {
+	std::unique_lock<std::mutex> lock(s_Data.Mutex);
+	s_Data.Condition.wait(lock, [] { return !s_Data.FramePending; });
+}
+
+void RenderThread::Init(IGraphicsContext* context) {
+	s_Data.Context = context;
+	s_Data.RenderThreadID = std::this_thread::get_id();
+	s_Data.MainThreadID = s_Data.RenderThreadID;
+}
+
+void RenderThread::Shutdown() {
+	SetPolicy(RenderThreadPolicy::SingleThreaded);
+	SubmitDeferredReleases();
+	s_Data.Context = nullptr;
+}
+
+void RenderThread::SetPolicy(RenderThreadPolicy policy) {
+	if (policy == GetPolicy() || !s_Data.Context) {
+		return;
+	}
+	if (policy == RenderThreadPolicy::MultiThreaded) {
+		s_Data.Context->ReleaseCurrent();
+		s_Data.Running = true;
+		s_Data.Thread = std::thread(RenderThreadMain);
+		s_Data.RenderThreadID = s_Data.Thread.get_id();
+		s_Data.Policy = policy;
+		LOG_INFO_ENGINE("Render thread started");
+		return;
+	}
+	Flush();
+	{
+		std::lock_guard<std::mutex> lock(s_Data.Mutex);
+		s_Data.Running = false;
+		s_Data.Condition.notify_all();
+	}
+	s_Data.Thread.join();
+	s_Data.Policy = policy;
+	s_Data.RenderThreadID = std::this_thread::get_id();
+	s_Data.Context->MakeCurrent();
+	LOG_INFO_ENGINE("Render thread stopped");
+}
+
+RenderThreadPolicy RenderThread::GetPolicy() {
+	return s_Data.Policy;
+}
+
+bool RenderThread::IsMultiThreaded() {
+	return s_Data.Policy == RenderThreadPolicy::MultiThreaded;
+}
+
+bool RenderThread::IsRenderThread() {
+	return std::this_thread::get_id() == s_Data.RenderThreadID;
+}
+
+bool RenderThread::IsMainThread() {
+	return std::this_thread::get_id() == s_Data.MainThreadID;
+}
+
+void RenderThread::Invoke(const std::function<void()>& func) {
+	if (!IsMultiThreaded() || IsRenderThread()) {
+		func();
+		return;
+	}
+	RenderThreadInvoke invoke;
+	invoke.Func = &func;
+	std::unique_lock<std::mutex> lock(s_Data.Mutex);
+	s_Data.Invokes.push_back(&invoke);
+	s_Data.Condition.notify_all();
+	s_Data.Condition.wait(lock, [&invoke] { return invoke.Done; });
+}
+
+void RenderThread::EndFrame() {
+	if (!s_Data.Context) {
+		return;
+	}
+	SubmitDeferredReleases();
+	if (!IsMultiThreaded()) {
+		s_Data.Context->SwapBuffers();
+		return;
+	}
+	IGraphicsContext* context = s_Data.Context;
+	Submit([context]() { context->SwapBuffers(); });
+	KickFrame();
+}
+
+void RenderThread::Flush() {
+	SubmitDeferredReleases();
+	if (!IsMultiThreaded()) {
+		return;
+	}
+	KickFrame();
+	WaitForFrame();
+}
+
+uint32_t RenderThread::GetLastFrameCommandCount() {
+	std::lock_guard<std::mutex> lock(s_Data.Mutex);
+	return s_Data.LastFrameCommandCount;
+}
+
+uint64_t RenderThread::GetLastFrameCommandBytes() {
+	std::lock_guard<std::mutex> lock(s_Data.Mutex);
+	return s_Data.LastFrameCommandBytes;
+}
+
+RenderCommandQueue& RenderThread::GetSubmitQueue() {
+	return s_Data.Queues[s_Data.SubmitIndex];
+}
+
+void RenderThread::DeferRelease(std::function<void()>&& release) {
+	std::lock_guard<std::mutex> lock(s_Data.ReleaseMutex);
+	s_Data.DeferredReleases.push_back(std::move(release));
+}
+
+void RenderThread::SubmitDeferredReleases() {
+	std::vector<std::function<void()>> releases;
+	{
+		std::lock_guard<std::mutex> lock(s_Data.ReleaseMutex);
+		releases.swap(s_Data.DeferredReleases);
+	}
+	for (std::function<void()>& release : releases) {
+		Submit(std::move(release));
+	}
+}
+}
@@ -0,0 +1,118 @@
+#pragma once
+#include "core/Core.h"
+#include "RenderCommandQueue.h"
+#include <functional>
+
+// ---------------------------------------------------------------------
+// 类: RenderThread
+// 作用: 渲染线程与双缓冲的命令流
+// 描述: 多线程模式下由专门的渲染线程持有图形上下文，主线程把渲染工作录制为命令，
+//       渲染线程比主线程晚一帧执行：主线程在 EndFrame 处等待渲染线程执行完上一帧，
+//       交换两个命令队列后唤醒它执行本帧，随即返回开始模拟下一帧，模拟与驱动开销因此重叠。
+//       帧边界是唯一的同步点；此外 Invoke 可以同步地在渲染线程上执行一段代码（创建资源、读回数据）。
+//       单线程模式下 Submit 立即在调用线程上执行，行为与不使用命令流完全相同。
+//
+//       多线程模式下所有图形 API 调用都必须在渲染线程上进行：
+//       - RenderCommand、Renderer 及引擎自身的帧流程已经改为录制命令；
+//       - 资源的 Create 工厂在渲染线程上构造对象，最后一个引用释放时对象的析构也推迟到渲染线程；
+//       - 其他直接调用资源方法（Bind、SetData、设置 Uniform 等）的代码需放在 Submit 的命令中，
+//         命令按值捕获所需的数据与 Ref。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+class IGraphicsContext;
+
+enum class RenderThreadPolicy {
+	SingleThreaded = 0,
+	MultiThreaded
+};
+
+class RenderThread {
+public:
+	// 在图形上下文创建之后、主线程上调用；初始为单线程模式
+	static void Init(IGraphicsContext* context);
+	// 停止渲染线程并把上下文交还主线程
+	static void Shutdown();
+
+	/**
+	 * @brief 切换线程模式，只能在两帧之间由主线程调用
+	 *
+	 * 切换到多线程时主线程释放上下文，由新启动的渲染线程获取；
+	 * 切换回单线程时先执行完所有已录制的命令，渲染线程退出后主线程重新获取上下文。
+	 */
+	static void SetPolicy(RenderThreadPolicy policy);
+	static RenderThreadPolicy GetPolicy();
+	static bool IsMultiThreaded();
+	// 当前线程是否持有图形上下文（单线程模式下为主线程）
+	static bool IsRenderThread();
+	// 当前线程是否为调用 Init 的主线程（唯一可以录制命令的线程）
+	static bool IsMainThread();
+
+	// 录制一条命令（只能由主线程录制）；在渲染线程上或单线程模式下立即执行
+	template<typename FuncT>
+	static void Submit(FuncT&& func) {
+		if (!IsMultiThreaded() || IsRenderThread()) {
+			func();
+			return;
+		}
+		GetSubmitQueue().Submit(std::forward<FuncT>(func));
+	}
+
+	// 在渲染线程上执行并等待完成；不参与命令排序，渲染线程在执行两帧之间或空闲时处理
+	static void Invoke(const std::function<void()>& func);
+
+	/**
+	 * @brief 析构一个图形资源，可以在任意线程上调用
+	 *
+	 * 渲染线程上立即析构，主线程上录制为命令。其他线程（例如 JobSystem 的工作线程释放了最后一个引用）
+	 * 不能录制命令，析构先放入加锁的列表，由主线程在下一个帧边界提交。
+	 */
+	template<typename T>
+	static void Release(T* object) {
+		if (IsRenderThread()) {
+			delete object;
+		} else if (IsMainThread()) {
+			GetSubmitQueue().Submit([object]() { delete object; });
+		} else {
+			DeferRelease([object]() { delete object; });
+		}
+	}
+
+	/**
+	 * @brief 主线程的帧边界
+	 *
+	 * 录制交换缓冲区，等待渲染线程执行完上一帧后交换命令队列并开始执行本帧。
+	 * 单线程模式下直接交换缓冲区。
+	 */
+	static void EndFrame();
+	// 等待所有已录制的命令执行完毕（例如在读取渲染结果或销毁大量资源之前）
+	static void Flush();
+
+	// 上一帧录制的命令数与字节数
+	static uint32_t GetLastFrameCommandCount();
+	static uint64_t GetLastFrameCommandBytes();
+private:
+	static RenderCommandQueue& GetSubmitQueue();
+	static void DeferRelease(std::function<void()>&& release);
+	// 主线程上把其他线程推迟的析构提交为命令
+	static void SubmitDeferredReleases();
+};
+
+/**
+ * @brief 创建图形资源
+ *
+ * 对象在渲染线程上构造；最后一个引用释放时，析构经 RenderThread::Release 提交到渲染线程，
+ * 排在此前录制的、可能仍在使用它的命令之后。单线程模式下在主线程上与 CreateRef 相同。
+ */
+template<typename T, typename... Args>
+Ref<T> CreateRenderResource(Args&&... args) {
+	T* resource = nullptr;
+	if (!RenderThread::IsMultiThreaded() || RenderThread::IsRenderThread()) {
+		resource = new T(std::forward<Args>(args)...);
+	} else {
+		RenderThread::Invoke([&]() { resource = new T(std::forward<Args>(args)...); });
+	}
+	return Ref<T>(resource, [](T* object) { RenderThread::Release(object); });
+}
+}
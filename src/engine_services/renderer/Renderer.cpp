@@ -1,6 +1,15 @@
 #include "Renderer.h"
 #include "engine_services/platform/opengl/OpenGLShader.h" // 暂时用于 dynamic_cast，未来应该优化 Shader 接口
 #include "RenderCommand.h"
+#include "RenderThread.h"
+#include "TextureLoader.h"
+#include "GpuProfiler.h"
+#include "RendererStatistics.h"
+#include "core/CoreTime.h"
+#include "core/JobSystem.h"
+#include <algorithm>
+#include <iterator>
+#include <vector>
 // ---------------------------------------------------------------------
 // 文件: Renderer.cpp
 // 作用: 高级渲染器逻辑实现
@@ -8,36 +17,284 @@
 
 namespace GE {
 
+// 一条待排序的绘制；着色器与顶点数组以所在资源列表中的下标表示
+struct DrawCommand {
+	uint64_t SortKey;
+	uint32_t ShaderIndex;
+	uint32_t VertexArrayIndex;
+	int32_t EntityID;
+	Mat4 Transform;
+};
+
+/**
+ * @brief 一个命令桶引用的资源
+ *
+ * 每种资源只保存一份 Ref，之后的提交只记录下标：多个线程提交同一个着色器时
+ * 不会争用它的引用计数。用一个直接映射的小缓存查找已有的下标，录制时不分配内存。
+ */
+template<typename T>
+struct DrawResourceList {
+	static constexpr uint32_t CacheSize = 64;
+
+	std::vector<Ref<T>> Resources;
+	const T* CachedPointers[CacheSize] = {};
+	uint32_t CachedIndices[CacheSize] = {};
+
+	uint32_t Acquire(const Ref<T>& resource, uint64_t hash) {
+		const uint32_t slot = static_cast<uint32_t>(hash % CacheSize);
+		if (CachedPointers[slot] == resource.get()) {
+			return CachedIndices[slot];
+		}
+		// 缓存冲突时同一资源可能被记录多次，只影响引用数量，不影响结果
+		const uint32_t index = static_cast<uint32_t>(Resources.size());
+		Resources.push_back(resource);
+		CachedPointers[slot] = resource.get();
+		CachedIndices[slot] = index;
+		return index;
+	}
+
+	void Clear() {
+		Resources.clear();
+		std::fill(std::begin(CachedPointers), std::end(CachedPointers), nullptr);
+	}
+};
+
+// 每个线程独占一个命令桶（按 JobSystem::GetThreadIndex 索引），录制时不加锁；
+// 按缓存行对齐，避免相邻线程的桶互相干扰
+struct alignas(64) DrawCommandBucket {
+	std::vector<DrawCommand> Commands;
+	DrawResourceList<Shader> Shaders;
+	DrawResourceList<VertexArray> VertexArrays;
+};
+
+// 排序后交给渲染线程的一个场景的绘制
+struct DrawPacket {
+	bool WriteEntityID = false; // 目标带有物体 ID 附件
+	std::vector<DrawCommand> Commands;
+	std::vector<Ref<Shader>> Shaders;
+	std::vector<Ref<VertexArray>> VertexArrays;
+};
+
+struct DrawSortEntry {
+	uint64_t SortKey;
+	uint32_t Bucket;
+	uint32_t Command;
+
+	bool operator<(const DrawSortEntry& other) const {
+		if (SortKey != other.SortKey) return SortKey < other.SortKey;
+		if (Bucket != other.Bucket) return Bucket < other.Bucket;
+		return Command < other.Command;
+	}
+};
+
+struct RendererData {
+	Ref<Framebuffer> SceneTarget; // 当前场景的渲染目标，为空表示窗口
+	bool SceneActive = false;
+	bool SceneHasEntityID = false;
+	uint32_t WindowWidth = 0;
+	uint32_t WindowHeight = 0;
+	std::vector<DrawCommandBucket> Buckets;
+	std::vector<DrawSortEntry> SortEntries;
+};
+static RendererData s_Data;
+
+// 资源指针的散列，用于排序键与资源缓存；指针的低位因对齐总是 0，需要打散
+static inline uint64_t HashResource(const void* resource) {
+	uint64_t hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(resource));
+	hash ^= hash >> 33;
+	hash *= 0xFF51AFD7ED558CCDull;
+	hash ^= hash >> 33;
+	return hash;
+}
+
+// 排序键：高 32 位为着色器，低 32 位为顶点数组，着色器切换比顶点数组切换代价更高
+static inline uint64_t MakeSortKey(uint64_t shaderHash, uint64_t vertexArrayHash) {
+	return (shaderHash << 32) | (vertexArrayHash & 0xFFFFFFFFull);
+}
+
+// 合并所有桶的命令并排序，桶清空后保留容量供下一个场景使用
+static Ref<DrawPacket> BuildDrawPacket() {
+	std::vector<uint32_t> entryOffsets(s_Data.Buckets.size() + 1, 0);
+	for (size_t i = 0; i < s_Data.Buckets.size(); ++i) {
+		entryOffsets[i + 1] = entryOffsets[i] + static_cast<uint32_t>(s_Data.Buckets[i].Commands.size());
+	}
+	const uint32_t commandCount = entryOffsets.back();
+	if (commandCount == 0) {
+		return nullptr;
+	}
+
+	// 各桶在工作线程上并行排序自己的区段，再依次归并
+	s_Data.SortEntries.resize(commandCount);
+	JobContext sortContext;
+	JobSystem::Dispatch(sortContext, static_cast<uint32_t>(s_Data.Buckets.size()), 1, [&entryOffsets](JobDispatchArgs args) {
+		const DrawCommandBucket& bucket = s_Data.Buckets[args.JobIndex];
+		DrawSortEntry* entries = s_Data.SortEntries.data() + entryOffsets[args.JobIndex];
+		for (uint32_t i = 0; i < bucket.Commands.size(); ++i) {
+			entries[i] = { bucket.Commands[i].SortKey, args.JobIndex, i };
+		}
+		std::sort(entries, entries + bucket.Commands.size());
+	});
+	JobSystem::Wait(sortContext);
+	for (size_t i = 1; i + 1 < entryOffsets.size(); ++i) {
+		std::inplace_merge(s_Data.SortEntries.begin(), s_Data.SortEntries.begin() + entryOffsets[i],
+			s_Data.SortEntries.begin() + entryOffsets[i + 1]);
+	}
+
+	// 资源列表按桶拼接，命令中的下标加上所在桶的偏移
+	Ref<DrawPacket> packet = CreateRef<DrawPacket>();
+	std::vector<uint32_t> shaderOffsets(s_Data.Buckets.size());
+	std::vector<uint32_t> vertexArrayOffsets(s_Data.Buckets.size());
+	for (size_t i = 0; i < s_Data.Buckets.size(); ++i) {
+		DrawCommandBucket& bucket = s_Data.Buckets[i];
+		shaderOffsets[i] = static_cast<uint32_t>(packet->Shaders.size());
+		vertexArrayOffsets[i] = static_cast<uint32_t>(packet->VertexArrays.size());
+		std::move(bucket.Shaders.Resources.begin(), bucket.Shaders.Resources.end(), std::back_inserter(packet->Shaders));
+		std::move(bucket.VertexArrays.Resources.begin(), bucket.VertexArrays.Resources.end(), std::back_inserter(packet->VertexArrays));
+	}
+	packet->Commands.reserve(commandCount);
+	for (const DrawSortEntry& entry : s_Data.SortEntries) {
+		DrawCommand command = s_Data.Buckets[entry.Bucket].Commands[entry.Command];
+		command.ShaderIndex += shaderOffsets[entry.Bucket];
+		command.VertexArrayIndex += vertexArrayOffsets[entry.Bucket];
+		packet->Commands.push_back(command);
+	}
+	for (DrawCommandBucket& bucket : s_Data.Buckets) {
+		bucket.Commands.clear();
+		bucket.Shaders.Clear();
+		bucket.VertexArrays.Clear();
+	}
+	return packet;
+}
+
 void Renderer::Init() {
     RenderCommand::Init();
+	GpuProfiler::Init();
+	// 主线程与每个工作线程各一个命令桶
+	s_Data.Buckets.resize(JobSystem::GetWorkerCount() + 1);
+}
+
+void Renderer::Shutdown() {
+	// 等待后台解码任务结束，丢弃尚未创建的纹理
+	TextureLoader::Shutdown();
+	s_Data.SceneTarget = nullptr;
+	s_Data.Buckets.clear();
+	s_Data.SortEntries.clear();
+	GpuProfiler::Shutdown();
+	RenderCommand::Shutdown();
 }
 
 void Renderer::OnWindowResize(uint32_t width, uint32_t height) {
-	// 调整渲染视口以匹配新的窗口尺寸
-	RenderCommand::SetViewport(0, 0, width, height);
+	// 记录窗口尺寸，离屏场景结束后据此恢复视口
+	s_Data.WindowWidth = width;
+	s_Data.WindowHeight = height;
+	// 离屏场景进行中时视口属于目标帧缓冲，留到 EndScene 再恢复
+	if (!s_Data.SceneTarget) {
+		RenderCommand::SetViewport(0, 0, width, height);
+	}
+}
+
+void Renderer::BeginFrame() {
+	GpuProfiler::BeginFrame();
 }
 
-void Renderer::BeginScene() {
+void Renderer::BeginScene(const Ref<Framebuffer>& target) {
+	ASSERT_ENGINE(!s_Data.SceneActive, "Renderer::BeginScene called twice without EndScene!");
+	s_Data.SceneActive = true;
+	s_Data.SceneTarget = target;
+	if (target) {
+		RenderThread::Submit([target]() { target->Bind(); });
+	}
 	// 设置清屏颜色并清屏
 	RenderCommand::SetClearColor({0.2f, 0.3f, 0.3f, 1.0f});
 	RenderCommand::Clear();
+	// 整数附件不能用浮点清屏颜色清除，单独清为 -1（没有物体）
+	s_Data.SceneHasEntityID = false;
+	if (target) {
+		uint32_t colorIndex = 0;
+		for (const FramebufferAttachmentSpecification& attachment : target->GetSpecification().Attachments) {
+			if (attachment.Format == FramebufferTextureFormat::None || IsDepthFormat(attachment.Format)) {
+				continue;
+			}
+			if (attachment.Format == FramebufferTextureFormat::RedInteger) {
+				RenderThread::Submit([target, colorIndex]() { target->ClearAttachment(colorIndex, -1); });
+				s_Data.SceneHasEntityID = true;
+			}
+			colorIndex++;
+		}
+	}
 }
 
 void Renderer::EndScene() {
-	// 结束场景，目前为空
+	s_Data.SceneActive = false;
+	if (Ref<DrawPacket> packet = BuildDrawPacket()) {
+		packet->WriteEntityID = s_Data.SceneHasEntityID;
+		RenderThread::Submit([packet]() {
+			static const std::string transformName = "u_Transform";
+			static const std::string entityIDName = "u_EntityID";
+			const Shader* boundShader = nullptr;
+			const VertexArray* boundVertexArray = nullptr;
+			for (const DrawCommand& command : packet->Commands) {
+				const Ref<Shader>& shader = packet->Shaders[command.ShaderIndex];
+				const Ref<VertexArray>& vertexArray = packet->VertexArrays[command.VertexArrayIndex];
+				if (shader.get() != boundShader) {
+					shader->Bind();
+					boundShader = shader.get();
+				}
+				if (vertexArray.get() != boundVertexArray) {
+					vertexArray->Bind();
+					boundVertexArray = vertexArray.get();
+				}
+				shader->SetMat4(transformName, command.Transform);
+				if (packet->WriteEntityID) {
+					shader->SetInt(entityIDName, command.EntityID);
+				}
+				RenderCommand::s_RendererAPI->DrawIndexed(vertexArray);
+			}
+		});
+	}
+	if (!s_Data.SceneTarget) {
+		return;
+	}
+	RenderThread::Submit([target = s_Data.SceneTarget]() {
+		target->Resolve();
+		target->Unbind();
+	});
+	s_Data.SceneTarget = nullptr;
+	RenderCommand::SetViewport(0, 0, s_Data.WindowWidth, s_Data.WindowHeight);
+}
+
+void Renderer::EndFrame() {
+	// 先为解码完成的图片创建纹理，它们的像素数据随本帧的上传一起处理
+	TextureLoader::Update();
+	{
+		GPU_PROFILE_SCOPE("Texture Uploads");
+		RenderCommand::EndFrame();
+	}
+	GpuProfiler::EndFrame();
+	RenderThread::Submit([frameTime = Time::GetUnscaledDeltaTime() * 1000.0f]() {
+		RendererStatistics::EndFrame(frameTime, GpuProfiler::GetLastFrame().Milliseconds);
+	});
 }
 
 void Renderer::Submit(const Ref<Shader>& shader, 
                       const Ref<VertexArray>& vertexArray, 
-                      const Mat4& transform) {
-	// 1. 绑定 Shader
-	shader->Bind();
-	// 2. 上传矩阵 Uniforms
-	// 使用抽象接口，无需转换类型
-	// 3. 绑定 VertexArray
-	vertexArray->Bind();
-	
-	// 4. 发送绘制命令
-	RenderCommand::DrawIndexed(vertexArray);
+                      const Mat4& transform,
+                      int32_t entityID) {
+	ASSERT_ENGINE(s_Data.SceneActive, "Renderer::Submit must be called between BeginScene and EndScene!");
+	// 其他线程的编号同样为 0，会与主线程无同步地写入同一个桶
+	ASSERT_ENGINE(RenderThread::IsMainThread() || JobSystem::IsWorkerThread(),
+		"Renderer::Submit must be called from the main thread or a JobSystem worker!");
+	const uint32_t threadIndex = JobSystem::GetThreadIndex();
+	ASSERT_ENGINE(threadIndex < s_Data.Buckets.size(), "Renderer::Submit called from an unknown thread!");
+	// 只写入当前线程的桶，绑定与绘制在 EndScene 排序后执行
+	DrawCommandBucket& bucket = s_Data.Buckets[threadIndex];
+	const uint64_t shaderHash = HashResource(shader.get());
+	const uint64_t vertexArrayHash = HashResource(vertexArray.get());
+	DrawCommand& command = bucket.Commands.emplace_back();
+	command.SortKey = MakeSortKey(shaderHash, vertexArrayHash);
+	command.ShaderIndex = bucket.Shaders.Acquire(shader, shaderHash);
+	command.VertexArrayIndex = bucket.VertexArrays.Acquire(vertexArray, vertexArrayHash);
+	command.EntityID = entityID;
+	command.Transform = transform;
 }
 }
\ No newline at end of file
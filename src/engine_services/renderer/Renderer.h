@@ -1,6 +1,7 @@
 #pragma once
 #include "Shader.h"
 #include "RendererAPI.h"
+#include "Framebuffer.h"
 
 namespace GE {
 /**
@@ -9,16 +10,38 @@ namespace GE {
  * 这是引擎渲染系统的对外主要接口。负责管理渲染场景、提交渲染任务。
  * 相比于 RendererAPI (底层绘图命令)，Renderer 更关注“画什么”和“怎么画”的流程控制。
  * 例如：BeginScene（开始场景，设置相机），Submit（提交物体绘制），EndScene（结束场景）。
+ *
+ * Submit 是线程安全的：主线程与 JobSystem 的工作线程可以同时提交，每个线程写入自己的命令桶，
+ * 不加锁。EndScene 合并所有桶，按排序键（着色器、顶点数组）排序后统一录制绘制命令，
+ * 相同状态的绘制因此相邻，减少切换。
  */
 class Renderer {
 public:
 	static void Init();
+	static void Shutdown();
 	static void OnWindowResize(uint32_t width, uint32_t height);
-	static void BeginScene();
+	// 一帧开始时调用（在任何渲染命令之前），读取已完成的 GPU 计时
+	static void BeginFrame();
+	// 开始场景：target 为空时渲染到窗口，否则绑定该帧缓冲（视口随之改为帧缓冲的尺寸）并清屏；
+	// 目标的 RedInteger 附件（物体 ID）清为 -1
+	static void BeginScene(const Ref<Framebuffer>& target = nullptr);
+	// 结束场景：录制本场景提交的全部绘制，解析多重采样的目标帧缓冲，恢复窗口为渲染目标及其视口。
+	// 在工作线程上提交的任务必须在此之前完成（JobSystem::Wait）
 	static void EndScene();
+	// 一帧的所有渲染（包括 ImGui）提交完毕、交换缓冲区之前调用
+	static void EndFrame();
+	/**
+	 * @brief 提交一次绘制，只能在 BeginScene 与 EndScene 之间调用
+	 *
+	 * 绘制推迟到 EndScene 执行，顺序由排序键决定而不是提交顺序；
+	 * 因此同一场景中直接经由 RenderCommand 录制的命令会先于这些绘制执行。
+	 * transform 上传到着色器的 u_Transform。目标带有 RedInteger 附件时，entityID 上传到 u_EntityID，
+	 * 着色器把它写入该附件即可被 ObjectPicker 拾取。
+	 */
 	static void Submit(const Ref<Shader>& shader, 
 		                const Ref<VertexArray>& vertexArray, 
-		                const Mat4& transform = Mat4(1.0f));
+		                const Mat4& transform = Mat4(1.0f),
+		                int32_t entityID = -1);
 
 	// 获取当前使用的图形 API
 	inline static RendererAPI::API GetAPI() { return RendererAPI::GetAPI(); }
@@ -1,5 +1,7 @@
 #include "RendererAPI.h"
 #include "engine_services/platform/opengl/OpenGLRendererAPI.h"
+#include "engine_services/platform/software/SoftwareRendererAPI.h"
+#include "engine_services/platform/null/NullRendererAPI.h"
 #include "core/Core.h"
 #include "core/Log.h"
 namespace GE {
@@ -14,7 +16,15 @@ Scope<RendererAPI> RendererAPI::Create() {
         }
 		case RendererAPI::API::OpenGL:  
             return CreateScope<OpenGLRendererAPI>();
+		case RendererAPI::API::Software:
+            return CreateScope<SoftwareRendererAPI>();
+		case RendererAPI::API::Null:
+            return CreateScope<NullRendererAPI>();
 	}
 	return nullptr;
 }
+
+void RendererAPI::SetAPI(API api) {
+	s_API = api;
+}
 }
\ No newline at end of file
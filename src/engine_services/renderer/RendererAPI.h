@@ -9,19 +9,44 @@ class RendererAPI
 public:
 	// 支持的图形 API 类型枚举
 	enum class API {
-		None = 0, OpenGL = 1
+		None = 0, OpenGL = 1,
+		Software = 2, // CPU 光栅化，不需要 GPU 与图形上下文
+		Null = 3      // 只录制命令，不调用任何图形 API（见 NullRendererAPI）
 	};
 public:
 	virtual ~RendererAPI() = default;
 	virtual void Init() = 0;
+	// 在图形上下文销毁之前调用，释放后端仍持有的对象
+	virtual void Shutdown() = 0;
 	virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
 	inline static API GetAPI() { return s_API; }
+	// 选择图形 API，必须在创建窗口与 Renderer::Init 之前调用
+	static void SetAPI(API api);
 	virtual void SetClearColor(const Vec4& color) = 0;
 	virtual void Clear() = 0;
 	// 执行索引绘制 (Indexed Draw Call)
 	// vertexArray: 包含顶点数据和索引数据的顶点数组对象
 	// indexCount: 如果为0 (默认)，则绘制整个 IndexBuffer，否则绘制指定数量的索引 (用于批处理)
 	virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0) = 0;
+	// 非索引绘制：从第 firstVertex 个顶点开始绘制 vertexCount 个。
+	// 顶点数组由实现负责绑定，可以没有任何缓冲，此时由着色器根据 gl_VertexID 生成顶点（例如全屏三角形）
+	virtual void DrawArrays(const Ref<VertexArray>& vertexArray, uint32_t vertexCount, uint32_t firstVertex = 0) = 0;
+	// 绘制共享 IndexBuffer 中的一个区间：从第 firstIndex 个索引开始绘制 indexCount 个，
+	// 每个索引加上 baseVertex 后再取顶点（用于 GeometryHeap 中子分配的网格）
+	virtual void DrawIndexedBaseVertex(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t firstIndex, int32_t baseVertex) = 0;
+	// 执行多重间接绘制 (Multi-Draw Indirect)
+	// 一次调用执行 indirectBuffer 中从第 firstCommand 条开始的 drawCount 条命令，
+	// 所有命令共享 vertexArray 中的顶点/索引缓冲，逐绘制数据通过 gl_DrawID 或 BaseInstance 索引
+	// （OpenGL 4.2 以下不支持非零的 BaseInstance）
+	virtual void DrawIndexedIndirect(const Ref<VertexArray>& vertexArray, const Ref<IndirectBuffer>& indirectBuffer,
+		uint32_t drawCount, uint32_t firstCommand = 0) = 0;
+
+	// 在命令流中标记一段命令（例如一个渲染通道），RenderDoc / Nsight 等工具按此分组显示；可以嵌套
+	virtual void PushDebugGroup(const char* name) = 0;
+	virtual void PopDebugGroup() = 0;
+
+	// 每帧结束（交换缓冲区之前）调用一次，后端在此处理跨帧的工作，例如分批提交纹理上传
+	virtual void EndFrame() = 0;
 
 	// 静态工厂方法，根据当前 API 类型创建具体的 RendererAPI 实例
 	static Scope<RendererAPI> Create();
@@ -0,0 +1,97 @@
+#include "RendererStatistics.h"
+#include <algorithm>
+#include <mutex>
+
+namespace GE {
+
+// 参与平均值 / 最大值计算的字段
+#define RENDERER_STATISTICS_FIELDS(X) \
+	X(FrameTime) X(GpuFrameTime) \
+	X(DrawCalls) X(IndirectCommands) X(Vertices) X(Triangles) \
+	X(ShaderBinds) X(VertexArrayBinds) X(TextureBinds) X(FramebufferBinds) \
+	X(BufferUploads) X(BufferUploadBytes) X(BufferStalls) X(TextureUploads) X(TextureUploadBytes)
+
+struct RendererStatisticsHistory {
+	RendererFrameStatistics Frames[RendererStatistics::HistorySize];
+	uint32_t Next = 0;   // 下一帧写入的位置
+	uint32_t Count = 0;
+	uint64_t FrameIndex = 0;
+};
+static RendererStatisticsHistory s_History;
+static std::mutex s_HistoryMutex;
+RendererFrameStatistics RendererStatistics::s_Current;
+
+void RendererStatistics::EndFrame(float frameTime, float gpuFrameTime) {
+	std::lock_guard<std::mutex> lock(s_HistoryMutex);
+	s_Current.FrameIndex = ++s_History.FrameIndex;
+	s_Current.FrameTime = frameTime;
+	s_Current.GpuFrameTime = gpuFrameTime;
+	s_History.Frames[s_History.Next] = s_Current;
+	s_History.Next = (s_History.Next + 1) % HistorySize;
+	s_History.Count = std::min(s_History.Count + 1, HistorySize);
+	s_Current = RendererFrameStatistics();
+}
+
+// 调用者持有 s_HistoryMutex
+static const RendererFrameStatistics& GetFrameLocked(uint32_t framesAgo) {
+	static const RendererFrameStatistics s_Empty;
+	if (framesAgo >= s_History.Count) {
+		return s_Empty;
+	}
+	return s_History.Frames[(s_History.Next + RendererStatistics::HistorySize - 1 - framesAgo) % RendererStatistics::HistorySize];
+}
+
+uint32_t RendererStatistics::GetHistoryCount() {
+	std::lock_guard<std::mutex> lock(s_HistoryMutex);
+	return s_History.Count;
+}
+
+RendererFrameStatistics RendererStatistics::GetFrame(uint32_t framesAgo) {
+	std::lock_guard<std::mutex> lock(s_HistoryMutex);
+	return GetFrameLocked(framesAgo);
+}
+
+RendererFrameStatistics RendererStatistics::GetAverage(uint32_t frameCount) {
+	std::lock_guard<std::mutex> lock(s_HistoryMutex);
+	RendererFrameStatistics result;
+	frameCount = std::min(frameCount, s_History.Count);
+	if (frameCount == 0) {
+		return result;
+	}
+	// 整数项先以 double 累加，避免截断
+	#define X(field) double field = 0.0;
+	RENDERER_STATISTICS_FIELDS(X)
+	#undef X
+	for (uint32_t i = 0; i < frameCount; ++i) {
+		const RendererFrameStatistics& frame = GetFrameLocked(i);
+		#define X(field) field += static_cast<double>(frame.field);
+		RENDERER_STATISTICS_FIELDS(X)
+		#undef X
+	}
+	#define X(field) result.field = static_cast<decltype(result.field)>(field / frameCount);
+	RENDERER_STATISTICS_FIELDS(X)
+	#undef X
+	result.FrameIndex = GetFrameLocked(0).FrameIndex;
+	return result;
+}
+
+RendererFrameStatistics RendererStatistics::GetMaximum(uint32_t frameCount) {
+	std::lock_guard<std::mutex> lock(s_HistoryMutex);
+	RendererFrameStatistics result;
+	frameCount = std::min(frameCount, s_History.Count);
+	for (uint32_t i = 0; i < frameCount; ++i) {
+		const RendererFrameStatistics& frame = GetFrameLocked(i);
+		#define X(field) result.field = std::max(result.field, frame.field);
+		RENDERER_STATISTICS_FIELDS(X)
+		#undef X
+	}
+	result.FrameIndex = GetFrameLocked(0).FrameIndex;
+	return result;
+}
+
+void RendererStatistics::Reset() {
+	std::lock_guard<std::mutex> lock(s_HistoryMutex);
+	s_History = RendererStatisticsHistory();
+	s_Current = RendererFrameStatistics();
+}
+}
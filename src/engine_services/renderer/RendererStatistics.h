@@ -0,0 +1,58 @@
+#pragma once
+#include "core/Core.h"
+#include <cstdint>
+
+// ---------------------------------------------------------------------
+// 类: RendererStatistics
+// 作用: 每帧的渲染统计（绘制调用、图元、状态切换、上传字节数）
+// 描述: 后端在绘制、绑定与上传处直接对 Current() 的计数加一，不加锁，只能在渲染线程上使用。
+//       Renderer::EndFrame 在渲染线程上把本帧的计数存入 HistorySize 帧的环并清零；
+//       读取历史的接口加锁并返回副本，可在任意线程上调用。
+//       历史数据供 ImGuiLayer 绘制曲线，GetAverage / GetMaximum 可用于自动化测试中的性能预算检查。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+struct RendererFrameStatistics {
+	uint64_t FrameIndex = 0;
+	float FrameTime = 0.0f;          // 帧间隔（毫秒）
+	float GpuFrameTime = 0.0f;       // GpuProfiler 最近完成的一帧，比本帧晚几帧
+
+	uint32_t DrawCalls = 0;          // 提交给图形 API 的绘制调用，一次多重间接绘制算一次
+	uint32_t IndirectCommands = 0;   // 多重间接绘制中的命令条数
+	uint64_t Vertices = 0;           // 直接绘制的顶点 / 索引数（间接绘制的数量在 GPU 上，不计入）
+	uint64_t Triangles = 0;
+
+	uint32_t ShaderBinds = 0;
+	uint32_t VertexArrayBinds = 0;
+	uint32_t TextureBinds = 0;
+	uint32_t FramebufferBinds = 0;
+
+	uint32_t BufferUploads = 0;
+	uint64_t BufferUploadBytes = 0;
+	uint32_t BufferStalls = 0;       // 流式缓冲等待 GPU 释放区段的次数
+	uint32_t TextureUploads = 0;
+	uint64_t TextureUploadBytes = 0;
+};
+
+class RendererStatistics {
+public:
+	static constexpr uint32_t HistorySize = 300;
+
+	// 本帧正在累计的计数
+	inline static RendererFrameStatistics& Current() { return s_Current; }
+	// 由 Renderer::EndFrame 调用：记录本帧并开始新的一帧
+	static void EndFrame(float frameTime, float gpuFrameTime);
+
+	// 已记录的帧数，不超过 HistorySize
+	static uint32_t GetHistoryCount();
+	// framesAgo 为 0 时是最近完成的一帧
+	static RendererFrameStatistics GetFrame(uint32_t framesAgo = 0);
+	// 最近 frameCount 帧逐项的平均值 / 最大值（FrameIndex 为最近一帧）
+	static RendererFrameStatistics GetAverage(uint32_t frameCount = HistorySize);
+	static RendererFrameStatistics GetMaximum(uint32_t frameCount = HistorySize);
+	static void Reset();
+private:
+	static RendererFrameStatistics s_Current;
+};
+}
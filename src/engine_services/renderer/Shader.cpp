@@ -1,7 +1,10 @@
 #include "Shader.h"
 #include "Renderer.h"
+#include "RenderThread.h"
 #include "RendererAPI.h"
 #include "engine_services/platform/opengl/OpenGLShader.h"
+#include "engine_services/platform/software/SoftwareShader.h"
+#include "engine_services/platform/null/NullShader.h"
 #include "core/Log.h"
 #include "core/Core.h"
 
@@ -10,7 +13,9 @@ namespace GE {
 Ref<Shader> Shader::Create(const std::string& filepath) {
 	switch (Renderer::GetAPI()) {
 		case RendererAPI::API::None:    ASSERT_ENGINE(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLShader>(filepath);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLShader>(filepath);
+		case RendererAPI::API::Software: return CreateRenderResource<SoftwareShader>(filepath);
+		case RendererAPI::API::Null:    return CreateRenderResource<NullShader>(filepath);
 	}
 	ASSERT_ENGINE(false, "Unknown RendererAPI!");
 	return nullptr;
@@ -19,7 +24,9 @@ Ref<Shader> Shader::Create(const std::string& filepath) {
 Ref<Shader> Shader::Create(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc) {
 	switch (Renderer::GetAPI()) {
 		case RendererAPI::API::None:    ASSERT_ENGINE(false, "RendererAPI::None is currently not supported!"); return nullptr;
-		case RendererAPI::API::OpenGL:  return CreateRef<OpenGLShader>(name, vertexSrc, fragmentSrc);
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLShader>(name, vertexSrc, fragmentSrc);
+		case RendererAPI::API::Software: return CreateRenderResource<SoftwareShader>(name, vertexSrc, fragmentSrc);
+		case RendererAPI::API::Null:    return CreateRenderResource<NullShader>(name, vertexSrc, fragmentSrc);
 	}
 	ASSERT_ENGINE(false, "Unknown RendererAPI!");
 	return nullptr;
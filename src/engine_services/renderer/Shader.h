@@ -23,6 +23,8 @@ public:
 	
     virtual void SetInt(const std::string& name, int value) = 0;
 	virtual void SetIntArray(const std::string& name, int* values, uint32_t count) = 0;
+	virtual void SetFloat(const std::string& name, float value) = 0;
+	virtual void SetFloat2(const std::string& name, const Vec2& value) = 0;
 	virtual void SetFloat4(const std::string& name, const Vec4& value) = 0;
 	virtual void SetMat4(const std::string& name, const Mat4& value) = 0;
 	virtual const std::string& GetName() const = 0;
@@ -0,0 +1,35 @@
+#include "Texture.h"
+#include "Renderer.h"
+#include "RenderThread.h"
+#include "TextureLoader.h"
+#include "engine_services/platform/opengl/OpenGLTexture.h"
+#include "engine_services/platform/null/NullTexture.h"
+
+namespace GE {
+
+Ref<Texture2D> Texture2D::Create(const TextureSpecification& specification) {
+	switch (Renderer::GetAPI()) {
+		case RendererAPI::API::None:    ASSERT_ENGINE(false, "RendererAPI::None is currently not supported!"); return nullptr;
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLTexture2D>(specification);
+		case RendererAPI::API::Software: ASSERT_ENGINE(false, "Textures are not supported by the software renderer!"); return nullptr;
+		case RendererAPI::API::Null:    return CreateRenderResource<NullTexture2D>(specification);
+	}
+	ASSERT_ENGINE(false, "Unknown RendererAPI!");
+	return nullptr;
+}
+
+Ref<Texture2D> Texture2D::Create(const std::filesystem::path& path) {
+	return TextureLoader::Load(path);
+}
+
+Ref<Texture2DArray> Texture2DArray::Create(const TextureSpecification& specification, uint32_t layerCount) {
+	switch (Renderer::GetAPI()) {
+		case RendererAPI::API::None:    ASSERT_ENGINE(false, "RendererAPI::None is currently not supported!"); return nullptr;
+		case RendererAPI::API::OpenGL:  return CreateRenderResource<OpenGLTexture2DArray>(specification, layerCount);
+		case RendererAPI::API::Software: ASSERT_ENGINE(false, "Textures are not supported by the software renderer!"); return nullptr;
+		case RendererAPI::API::Null:    return CreateRenderResource<NullTexture2DArray>(specification, layerCount);
+	}
+	ASSERT_ENGINE(false, "Unknown RendererAPI!");
+	return nullptr;
+}
+}
\ No newline at end of file
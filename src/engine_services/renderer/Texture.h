@@ -0,0 +1,136 @@
+#pragma once
+#include "core/Core.h"
+#include "core/Buffer.h"
+#include <filesystem>
+
+// ---------------------------------------------------------------------
+// 文件: Texture.h
+// 作用: 纹理抽象 (Texture / Texture2D / Texture2DArray)
+// 描述: 纹理使用不可变存储，尺寸、格式与 mip 层数在创建时确定。
+//       像素数据通过 SetData 提交后进入上传队列，由后端在之后的帧中分批、异步地传到 GPU，
+//       数据到达之前 Bind 会绑定占位纹理，因此一次加载大量纹理也不会卡住某一帧。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+enum class ImageFormat {
+	None = 0,
+	R8, RG8, RGB8, RGBA8,
+	SRGB8, SRGB8_Alpha8,
+	RGBA16F, RGBA32F
+};
+
+// 每个像素的字节数
+static constexpr uint32_t ImageFormatBytesPerPixel(ImageFormat format) {
+	switch (format) {
+		case ImageFormat::R8:           return 1;
+		case ImageFormat::RG8:          return 2;
+		case ImageFormat::RGB8:         return 3;
+		case ImageFormat::RGBA8:        return 4;
+		case ImageFormat::SRGB8:        return 3;
+		case ImageFormat::SRGB8_Alpha8: return 4;
+		case ImageFormat::RGBA16F:      return 8;
+		case ImageFormat::RGBA32F:      return 16;
+		case ImageFormat::None:         break;
+	}
+	return 0;
+}
+
+enum class TextureFilter { Nearest = 0, Linear };
+enum class TextureWrap { Repeat = 0, MirroredRepeat, ClampToEdge };
+
+// mip 链的生成方式
+enum class MipmapMode {
+	None = 0, // 只有第 0 层
+	GPU,      // 第 0 层上传后由 GPU 生成 (glGenerateMipmap)
+	CPU,      // 在 CPU 上用盒式滤波逐层生成后一并上传（仅支持 8 位格式）
+	Manual    // 由调用者通过 SetData(…, mipLevel) 逐层提供
+};
+
+// 采样状态，相同的状态在后端共用同一个采样器对象
+struct SamplerSpecification {
+	TextureFilter MinFilter = TextureFilter::Linear;
+	TextureFilter MagFilter = TextureFilter::Linear;
+	TextureWrap WrapS = TextureWrap::Repeat;
+	TextureWrap WrapT = TextureWrap::Repeat;
+	uint32_t MaxAnisotropy = 1; // 1 表示关闭各向异性过滤，最大 16
+
+	bool operator==(const SamplerSpecification& other) const = default;
+};
+
+struct TextureSpecification {
+	uint32_t Width = 1;
+	uint32_t Height = 1;
+	ImageFormat Format = ImageFormat::RGBA8;
+	MipmapMode Mipmaps = MipmapMode::GPU;
+	SamplerSpecification Sampler;
+};
+
+class Texture {
+public:
+	virtual ~Texture() = default;
+
+	virtual const TextureSpecification& GetSpecification() const = 0;
+	virtual uint32_t GetWidth() const = 0;
+	virtual uint32_t GetHeight() const = 0;
+	virtual uint32_t GetMipLevelCount() const = 0;
+	virtual uint32_t GetRendererID() const = 0;
+
+	// 提交第 mipLevel 层的完整像素数据（紧密排列，无行对齐），数据会被复制
+	virtual void SetData(const void* data, uint32_t size, uint32_t mipLevel = 0) = 0;
+	// 接管像素缓冲区的所有权，省去一次复制（例如由图片解码器产生的数据）
+	virtual void SetData(Buffer&& pixels, uint32_t mipLevel = 0) = 0;
+	// 更新第 mipLevel 层中的一个矩形区域，pixels 为该区域紧密排列的像素。
+	// 第 0 层更新后按 MipmapMode::GPU 重新生成 mip；MipmapMode::CPU 的纹理不会重新生成下层
+	virtual void SetSubData(Buffer&& pixels, uint32_t x, uint32_t y, uint32_t width, uint32_t height, uint32_t mipLevel = 0) = 0;
+	// 已提交的数据是否全部到达 GPU。首次提交的数据到达之前 Bind 会绑定占位纹理，
+	// 之后的更新在到达前继续显示旧内容
+	virtual bool IsLoaded() const = 0;
+
+	virtual void Bind(uint32_t slot = 0) const = 0;
+	// 无绑定纹理句柄（已常驻，连同采样状态），写入 BindlessTextureTable 供着色器直接采样。
+	// 数据到达之前返回占位纹理的句柄；不支持无绑定纹理时返回 0
+	virtual uint64_t GetBindlessHandle() const = 0;
+
+	virtual bool operator==(const Texture& other) const = 0;
+};
+
+class Texture2D : public Texture {
+public:
+	static Ref<Texture2D> Create(const TextureSpecification& specification);
+	// 同步读取并解码图片文件 (PNG / QOI)，RGBA、sRGB、GPU 生成 mip；需要异步加载或其他选项时使用 TextureLoader
+	static Ref<Texture2D> Create(const std::filesystem::path& path);
+};
+
+/**
+ * @brief 二维纹理数组
+ *
+ * 所有层尺寸、格式相同，着色器中以 sampler2DArray 采样，层号作为第三个纹理坐标。
+ * 同尺寸的一组素材（地形图层、同规格的材质贴图、精灵帧）放进一个数组后只占用一个纹理槽位，
+ * 合批不再受槽位数量限制。继承自 Texture 的 SetData / SetSubData 作用于所有层，
+ * 数据按层依次排列；单独提交某一层使用 SetLayerData。
+ */
+class Texture2DArray : public Texture {
+public:
+	virtual uint32_t GetLayerCount() const = 0;
+
+	// 提交第 layer 层第 mipLevel 层的完整像素数据
+	virtual void SetLayerData(Buffer&& pixels, uint32_t layer, uint32_t mipLevel = 0) = 0;
+	void SetLayerData(const void* data, uint32_t size, uint32_t layer, uint32_t mipLevel = 0) {
+		SetLayerData(Buffer::Copy(data, size), layer, mipLevel);
+	}
+
+	static Ref<Texture2DArray> Create(const TextureSpecification& specification, uint32_t layerCount);
+};
+
+// 完整 mip 链的层数: floor(log2(max(width, height))) + 1
+static inline uint32_t CalculateMipLevelCount(uint32_t width, uint32_t height) {
+	uint32_t levels = 1;
+	uint32_t size = width > height ? width : height;
+	while (size > 1) {
+		size >>= 1;
+		++levels;
+	}
+	return levels;
+}
+}
@@ -0,0 +1,298 @@
+#include "TextureAtlas.h"
+#include "core/Log.h"
+#include <algorithm>
+
+namespace GE {
+
+static constexpr uint32_t s_AtlasChannels = 4;
+
+TextureAtlas::TextureAtlas(const TextureAtlasSpecification& specification)
+	: m_Specification(specification) {
+	ASSERT_ENGINE(specification.InitialSize > 0 && specification.InitialSize <= specification.MaxSize,
+		"TextureAtlas: InitialSize must be in (0, MaxSize]!");
+	ASSERT_ENGINE(specification.Padding + 2 * specification.Extrusion < specification.InitialSize,
+		"TextureAtlas: Padding and Extrusion are too large for InitialSize!");
+}
+
+uint32_t TextureAtlas::AddPage(uint32_t width, uint32_t height) {
+	Page& page = m_Pages.emplace_back();
+	page.Width = width;
+	page.Height = height;
+	// 左上角留出 Padding，每个区域自带右侧和下方的 Padding，区域之间与页边缘都有间隔
+	page.Packer.Reset(width - m_Specification.Padding, height - m_Specification.Padding);
+	page.Pixels.Allocate(static_cast<uint64_t>(width) * height * s_AtlasChannels);
+	page.Pixels.ZeroInitialize();
+	return static_cast<uint32_t>(m_Pages.size() - 1);
+}
+
+bool TextureAtlas::GrowPage(uint32_t pageIndex) {
+	Page& page = m_Pages[pageIndex];
+	const uint32_t maxSize = m_Specification.MaxSize;
+	if (page.Width >= maxSize && page.Height >= maxSize) {
+		return false;
+	}
+	// 先加倍较短的一边，保持页接近正方形
+	uint32_t width = page.Width;
+	uint32_t height = page.Height;
+	if ((width <= height && width < maxSize) || height >= maxSize) {
+		width = std::min(width * 2, maxSize);
+	} else {
+		height = std::min(height * 2, maxSize);
+	}
+
+	Buffer pixels(static_cast<uint64_t>(width) * height * s_AtlasChannels);
+	pixels.ZeroInitialize();
+	const size_t oldRowSize = static_cast<size_t>(page.Width) * s_AtlasChannels;
+	const size_t newRowSize = static_cast<size_t>(width) * s_AtlasChannels;
+	for (uint32_t y = 0; y < page.Height; ++y) {
+		memcpy(pixels.Data + y * newRowSize, page.Pixels.Data + y * oldRowSize, oldRowSize);
+	}
+	page.Pixels = std::move(pixels);
+	page.Width = width;
+	page.Height = height;
+	page.Packer.Grow(width - m_Specification.Padding, height - m_Specification.Padding);
+	// 纹理是不可变存储，尺寸变化后在 Flush 中重建并整页上传
+	page.NeedsFullUpload = true;
+
+	for (AtlasRegion& region : m_Regions) {
+		if (region.Page == pageIndex) {
+			UpdateRegionUVs(region);
+		}
+	}
+	return true;
+}
+
+void TextureAtlas::UpdateRegionUVs(AtlasRegion& region) const {
+	const Page& page = m_Pages[region.Page];
+	const Vec2 size(static_cast<float>(page.Width), static_cast<float>(page.Height));
+	region.UVMin = Vec2(static_cast<float>(region.X), static_cast<float>(region.Y)) / size;
+	region.UVMax = Vec2(static_cast<float>(region.X + region.Width), static_cast<float>(region.Y + region.Height)) / size;
+}
+
+AtlasHandle TextureAtlas::Place(uint32_t pageIndex, const RectPacker::Rect& slot, const uint8_t* rgba, uint32_t width, uint32_t height) {
+	Page& page = m_Pages[pageIndex];
+	const uint32_t extrusion = m_Specification.Extrusion;
+	const uint32_t originX = slot.X + m_Specification.Padding;
+	const uint32_t originY = slot.Y + m_Specification.Padding;
+	const uint32_t extendedWidth = width + 2 * extrusion;
+	const size_t pageRowSize = static_cast<size_t>(page.Width) * s_AtlasChannels;
+	const size_t srcRowSize = static_cast<size_t>(width) * s_AtlasChannels;
+	auto pixelAt = [&](uint32_t x, uint32_t y) { return page.Pixels.Data + y * pageRowSize + static_cast<size_t>(x) * s_AtlasChannels; };
+
+	// 每行左右各复制 extrusion 个边缘像素
+	for (uint32_t row = 0; row < height; ++row) {
+		const uint8_t* src = rgba + row * srcRowSize;
+		uint8_t* dst = pixelAt(originX, originY + extrusion + row);
+		for (uint32_t e = 0; e < extrusion; ++e) {
+			memcpy(dst + e * s_AtlasChannels, src, s_AtlasChannels);
+			memcpy(dst + (extrusion + width + e) * s_AtlasChannels, src + srcRowSize - s_AtlasChannels, s_AtlasChannels);
+		}
+		memcpy(dst + extrusion * s_AtlasChannels, src, srcRowSize);
+	}
+	// 上下各复制 extrusion 行（已包含左右挤出的像素，角落因此也被填充）
+	const size_t extendedRowSize = static_cast<size_t>(extendedWidth) * s_AtlasChannels;
+	for (uint32_t e = 0; e < extrusion; ++e) {
+		memcpy(pixelAt(originX, originY + e), pixelAt(originX, originY + extrusion), extendedRowSize);
+		memcpy(pixelAt(originX, originY + extrusion + height + e), pixelAt(originX, originY + extrusion + height - 1), extendedRowSize);
+	}
+
+	page.DirtyMinX = std::min(page.DirtyMinX, originX);
+	page.DirtyMinY = std::min(page.DirtyMinY, originY);
+	page.DirtyMaxX = std::max(page.DirtyMaxX, originX + extendedWidth);
+	page.DirtyMaxY = std::max(page.DirtyMaxY, originY + height + 2 * extrusion);
+
+	AtlasRegion& region = m_Regions.emplace_back();
+	region.Page = pageIndex;
+	region.X = originX + extrusion;
+	region.Y = originY + extrusion;
+	region.Width = width;
+	region.Height = height;
+	UpdateRegionUVs(region);
+	return { static_cast<uint32_t>(m_Regions.size() - 1) };
+}
+
+AtlasHandle TextureAtlas::Add(const void* rgba, uint32_t width, uint32_t height) {
+	if (!rgba || width == 0 || height == 0) {
+		return {};
+	}
+	const uint32_t slotWidth = GetSlotSize(width);
+	const uint32_t slotHeight = GetSlotSize(height);
+	const uint32_t usableSize = m_Specification.MaxSize - m_Specification.Padding;
+	if (slotWidth > usableSize || slotHeight > usableSize) {
+		LOG_WARN_ENGINE("TextureAtlas: {0}x{1} image does not fit into a {2}x{2} page", width, height, m_Specification.MaxSize);
+		return {};
+	}
+	const uint8_t* pixels = static_cast<const uint8_t*>(rgba);
+	RectPacker::Rect slot;
+	// 从最新的页开始尝试，旧页通常已经接近填满
+	for (uint32_t i = static_cast<uint32_t>(m_Pages.size()); i-- > 0;) {
+		if (m_Pages[i].Packer.Pack(slotWidth, slotHeight, slot)) {
+			return Place(i, slot, pixels, width, height);
+		}
+	}
+	// 加倍最后一页，仍放不下再开新页
+	uint32_t pageIndex = m_Pages.empty() ? AddPage(m_Specification.InitialSize, m_Specification.InitialSize)
+		: static_cast<uint32_t>(m_Pages.size() - 1);
+	while (!m_Pages[pageIndex].Packer.Pack(slotWidth, slotHeight, slot)) {
+		if (!GrowPage(pageIndex)) {
+			pageIndex = AddPage(m_Specification.InitialSize, m_Specification.InitialSize);
+		}
+	}
+	return Place(pageIndex, slot, pixels, width, height);
+}
+
+AtlasHandle TextureAtlas::Add(const Image& image) {
+	if (!image || image.Channels == s_AtlasChannels) {
+		return Add(image.Pixels.Data, image.Width, image.Height);
+	}
+	Buffer rgba(static_cast<uint64_t>(image.Width) * image.Height * s_AtlasChannels);
+	ImageDecoder::ConvertChannels(image.Pixels.Data, image.Channels, rgba.Data, s_AtlasChannels,
+		static_cast<size_t>(image.Width) * image.Height);
+	return Add(rgba.Data, image.Width, image.Height);
+}
+
+Ref<TextureAtlas> TextureAtlas::Build(std::span<const Image> images, const TextureAtlasSpecification& specification,
+	std::vector<AtlasHandle>& handles) {
+	Ref<TextureAtlas> atlas = CreateRef<TextureAtlas>(specification);
+	handles.assign(images.size(), AtlasHandle());
+	const uint32_t padding = specification.Padding;
+	const uint32_t maxSize = specification.MaxSize;
+
+	// 非 RGBA 的图片先转换
+	std::vector<Buffer> converted(images.size());
+	std::vector<uint32_t> remaining;
+	for (uint32_t i = 0; i < images.size(); ++i) {
+		const Image& image = images[i];
+		if (!image) {
+			continue;
+		}
+		if (atlas->GetSlotSize(image.Width) > maxSize - padding || atlas->GetSlotSize(image.Height) > maxSize - padding) {
+			LOG_WARN_ENGINE("TextureAtlas: {0}x{1} image does not fit into a {2}x{2} page", image.Width, image.Height, maxSize);
+			continue;
+		}
+		if (image.Channels != s_AtlasChannels) {
+			converted[i].Allocate(static_cast<uint64_t>(image.Width) * image.Height * s_AtlasChannels);
+			ImageDecoder::ConvertChannels(image.Pixels.Data, image.Channels, converted[i].Data, s_AtlasChannels,
+				static_cast<size_t>(image.Width) * image.Height);
+		}
+		remaining.push_back(i);
+	}
+
+	auto grow = [maxSize](uint32_t& width, uint32_t& height) {
+		if ((width <= height && width < maxSize) || height >= maxSize) {
+			width = std::min(width * 2, maxSize);
+		} else {
+			height = std::min(height * 2, maxSize);
+		}
+	};
+
+	// 每页从能容纳剩余总面积的尺寸开始，放不下全部就加倍重试；到达 MaxSize 后剩余的进入下一页
+	while (!remaining.empty()) {
+		uint64_t totalArea = 0;
+		std::vector<RectPacker::BatchEntry> entries(remaining.size());
+		for (size_t i = 0; i < remaining.size(); ++i) {
+			const Image& image = images[remaining[i]];
+			entries[i].Width = atlas->GetSlotSize(image.Width);
+			entries[i].Height = atlas->GetSlotSize(image.Height);
+			totalArea += static_cast<uint64_t>(entries[i].Width) * entries[i].Height;
+		}
+		uint32_t width = std::min(specification.InitialSize, maxSize);
+		uint32_t height = width;
+		while (static_cast<uint64_t>(width - padding) * (height - padding) < totalArea && (width < maxSize || height < maxSize)) {
+			grow(width, height);
+		}
+		RectPacker packer;
+		uint32_t packedCount = 0;
+		while (true) {
+			packer.Reset(width - padding, height - padding);
+			packedCount = packer.PackBatch(entries);
+			if (packedCount == entries.size() || (width >= maxSize && height >= maxSize)) {
+				break;
+			}
+			grow(width, height);
+		}
+
+		const uint32_t pageIndex = atlas->AddPage(width, height);
+		atlas->m_Pages[pageIndex].Packer = packer;
+		std::vector<uint32_t> unpacked;
+		for (size_t i = 0; i < entries.size(); ++i) {
+			const uint32_t imageIndex = remaining[i];
+			if (!entries[i].Packed) {
+				unpacked.push_back(imageIndex);
+				continue;
+			}
+			const Image& image = images[imageIndex];
+			const uint8_t* pixels = converted[imageIndex] ? converted[imageIndex].Data : image.Pixels.Data;
+			handles[imageIndex] = atlas->Place(pageIndex, entries[i].Result, pixels, image.Width, image.Height);
+		}
+		remaining = std::move(unpacked);
+	}
+	return atlas;
+}
+
+void TextureAtlas::Flush() {
+	const ImageFormat format = m_Specification.SRGB ? ImageFormat::SRGB8_Alpha8 : ImageFormat::RGBA8;
+	for (Page& page : m_Pages) {
+		if (!page.Texture || page.Texture->GetWidth() != page.Width || page.Texture->GetHeight() != page.Height) {
+			TextureSpecification specification;
+			specification.Width = page.Width;
+			specification.Height = page.Height;
+			specification.Format = format;
+			specification.Mipmaps = m_Specification.Mipmaps;
+			specification.Sampler = m_Specification.Sampler;
+			page.Texture = Texture2D::Create(specification);
+			page.NeedsFullUpload = true;
+		}
+		// CPU 生成的 mip 只在整层提交时重新计算，因此这种模式下总是整页上传
+		const bool fullUpload = page.NeedsFullUpload || m_Specification.Mipmaps == MipmapMode::CPU;
+		if (fullUpload && (page.NeedsFullUpload || page.DirtyMaxX > 0)) {
+			page.Texture->SetData(Buffer(page.Pixels));
+		} else if (page.DirtyMaxX > page.DirtyMinX && page.DirtyMaxY > page.DirtyMinY) {
+			const uint32_t width = page.DirtyMaxX - page.DirtyMinX;
+			const uint32_t height = page.DirtyMaxY - page.DirtyMinY;
+			const size_t rowSize = static_cast<size_t>(width) * s_AtlasChannels;
+			const size_t pageRowSize = static_cast<size_t>(page.Width) * s_AtlasChannels;
+			Buffer pixels(rowSize * height);
+			for (uint32_t y = 0; y < height; ++y) {
+				memcpy(pixels.Data + y * rowSize,
+					page.Pixels.Data + (page.DirtyMinY + y) * pageRowSize + static_cast<size_t>(page.DirtyMinX) * s_AtlasChannels, rowSize);
+			}
+			page.Texture->SetSubData(std::move(pixels), page.DirtyMinX, page.DirtyMinY, width, height);
+		}
+		page.NeedsFullUpload = false;
+		page.DirtyMinX = page.DirtyMinY = UINT32_MAX;
+		page.DirtyMaxX = page.DirtyMaxY = 0;
+	}
+}
+
+const AtlasRegion& TextureAtlas::GetRegion(AtlasHandle handle) const {
+	ASSERT_ENGINE(handle.Index < m_Regions.size(), "TextureAtlas: invalid handle!");
+	return m_Regions[handle.Index];
+}
+
+const Ref<Texture2D>& TextureAtlas::GetTexture(uint32_t page) const {
+	ASSERT_ENGINE(page < m_Pages.size(), "TextureAtlas: page index out of range!");
+	return m_Pages[page].Texture;
+}
+
+const Buffer& TextureAtlas::GetPagePixels(uint32_t page) const {
+	ASSERT_ENGINE(page < m_Pages.size(), "TextureAtlas: page index out of range!");
+	return m_Pages[page].Pixels;
+}
+
+void TextureAtlas::GetPageSize(uint32_t page, uint32_t& width, uint32_t& height) const {
+	ASSERT_ENGINE(page < m_Pages.size(), "TextureAtlas: page index out of range!");
+	width = m_Pages[page].Width;
+	height = m_Pages[page].Height;
+}
+
+float TextureAtlas::GetOccupancy() const {
+	uint64_t usedArea = 0;
+	uint64_t totalArea = 0;
+	for (const Page& page : m_Pages) {
+		usedArea += page.Packer.GetUsedArea();
+		totalArea += static_cast<uint64_t>(page.Width) * page.Height;
+	}
+	return totalArea ? static_cast<float>(static_cast<double>(usedArea) / totalArea) : 0.0f;
+}
+}
@@ -0,0 +1,107 @@
+#pragma once
+#include "core/Core.h"
+#include "core/CoreMath.h"
+#include "core/ImageDecoder.h"
+#include "core/RectPacker.h"
+#include "Texture.h"
+#include <span>
+#include <vector>
+
+// ---------------------------------------------------------------------
+// 类: TextureAtlas
+// 作用: 把大量小图合并到少数几张大纹理（页）中
+// 描述: 每个区域四周复制 Extrusion 圈边缘像素，区域之间再留 Padding 像素空白，
+//       线性过滤和 mip 采样不会混入相邻区域的颜色。区域用 RectPacker 放置；
+//       当前页放不下时先把页的尺寸加倍（直到 MaxSize），仍放不下再开新页。
+//       页的像素在 CPU 端保留一份，新增区域只上传包含它们的脏矩形，加倍时整页重新上传。
+//       区域通过 AtlasHandle 引用，页加倍后 UV 会变化，因此应每次绘制时通过 GetRegion 取得。
+//       只能在主线程（GL 线程）上使用。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+struct TextureAtlasSpecification {
+	uint32_t InitialSize = 512; // 新页的初始边长
+	uint32_t MaxSize = 4096;    // 页的最大边长
+	uint32_t Padding = 2;       // 区域之间、区域与页边缘之间的空白像素
+	uint32_t Extrusion = 1;     // 区域四周复制的边缘像素圈数
+	bool SRGB = true;
+	MipmapMode Mipmaps = MipmapMode::None;
+	SamplerSpecification Sampler = { TextureFilter::Linear, TextureFilter::Linear, TextureWrap::ClampToEdge, TextureWrap::ClampToEdge };
+};
+
+struct AtlasHandle {
+	static constexpr uint32_t Invalid = 0xFFFFFFFF;
+	uint32_t Index = Invalid;
+
+	inline bool IsValid() const { return Index != Invalid; }
+};
+
+struct AtlasRegion {
+	uint32_t Page = 0;
+	uint32_t X = 0;      // 页内像素坐标，不含挤出的边缘
+	uint32_t Y = 0;
+	uint32_t Width = 0;
+	uint32_t Height = 0;
+	Vec2 UVMin = Vec2(0.0f);
+	Vec2 UVMax = Vec2(0.0f);
+};
+
+class TextureAtlas {
+public:
+	TextureAtlas(const TextureAtlasSpecification& specification = {});
+
+	// 添加一张 RGBA8 图片（紧密排列），放不下（超过 MaxSize）时返回无效句柄
+	AtlasHandle Add(const void* rgba, uint32_t width, uint32_t height);
+	// 添加解码后的图片，非 4 通道时先转换
+	AtlasHandle Add(const Image& image);
+
+	/**
+	 * @brief 离线/加载时构建：一次放入全部图片
+	 *
+	 * 先按高度排序批量放置，并为每页选择能放下的最小尺寸，比逐个 Add 的利用率更高。
+	 * 资源烘焙工具可以调用它后用 GetPagePixels 与 GetRegion 导出页图片和区域表。
+	 * handles 与 images 一一对应。
+	 */
+	static Ref<TextureAtlas> Build(std::span<const Image> images, const TextureAtlasSpecification& specification,
+		std::vector<AtlasHandle>& handles);
+
+	// 把新增或加倍后的页内容提交给纹理；每帧绘制前调用一次
+	void Flush();
+
+	const AtlasRegion& GetRegion(AtlasHandle handle) const;
+	const Ref<Texture2D>& GetTexture(uint32_t page) const;
+	inline uint32_t GetPageCount() const { return static_cast<uint32_t>(m_Pages.size()); }
+	inline uint32_t GetRegionCount() const { return static_cast<uint32_t>(m_Regions.size()); }
+	// 页的 CPU 端像素 (RGBA8)，尺寸为 GetPageSize
+	const Buffer& GetPagePixels(uint32_t page) const;
+	void GetPageSize(uint32_t page, uint32_t& width, uint32_t& height) const;
+	// 所有页的平均占用率（包含 Padding 与 Extrusion）
+	float GetOccupancy() const;
+
+	inline const TextureAtlasSpecification& GetSpecification() const { return m_Specification; }
+private:
+	struct Page {
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		RectPacker Packer;
+		Buffer Pixels;
+		Ref<Texture2D> Texture;
+		bool NeedsFullUpload = true;
+		// 尚未上传的脏矩形 [Min, Max)
+		uint32_t DirtyMinX = UINT32_MAX, DirtyMinY = UINT32_MAX;
+		uint32_t DirtyMaxX = 0, DirtyMaxY = 0;
+	};
+
+	uint32_t AddPage(uint32_t width, uint32_t height);
+	bool GrowPage(uint32_t pageIndex);
+	// 把区域（含挤出边缘）写入页，并记录句柄
+	AtlasHandle Place(uint32_t pageIndex, const RectPacker::Rect& slot, const uint8_t* rgba, uint32_t width, uint32_t height);
+	void UpdateRegionUVs(AtlasRegion& region) const;
+	inline uint32_t GetSlotSize(uint32_t size) const { return size + 2 * m_Specification.Extrusion + m_Specification.Padding; }
+private:
+	TextureAtlasSpecification m_Specification;
+	std::vector<Page> m_Pages;
+	std::vector<AtlasRegion> m_Regions;
+};
+}
@@ -0,0 +1,191 @@
+#include "TextureLoader.h"
+#include "core/FileSystem.h"
+#include "core/JobSystem.h"
+#include "core/Log.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+namespace GE {
+
+// 一次异步加载：任务在工作线程上填写 Result，完成后置位 Done，主线程只读取 Done 为 true 的条目
+struct PendingTextureLoad {
+	std::filesystem::path Path;
+	TextureLoadOptions Options;
+	TextureLoader::LoadCallback Callback;
+	Image Result;
+	bool Succeeded = false;
+	std::atomic<bool> Done{ false };
+};
+
+struct TextureLoaderData {
+	std::vector<Ref<PendingTextureLoad>> Pending;
+	JobContext Jobs;
+	ImageDecodeStatistics Statistics;
+	std::mutex StatisticsMutex;
+};
+static TextureLoaderData s_Loader;
+
+ImageFormat TextureLoader::SelectFormat(uint32_t channels, bool srgb) {
+	switch (channels) {
+		case 1: return ImageFormat::R8;
+		case 2: return ImageFormat::RG8;
+		case 3: return srgb ? ImageFormat::SRGB8 : ImageFormat::RGB8;
+		case 4: return srgb ? ImageFormat::SRGB8_Alpha8 : ImageFormat::RGBA8;
+	}
+	ASSERT_ENGINE(false, "Unsupported channel count!");
+	return ImageFormat::None;
+}
+
+static void RecordDecode(uint64_t compressedBytes, uint64_t decodedBytes, double seconds) {
+	std::lock_guard<std::mutex> lock(s_Loader.StatisticsMutex);
+	s_Loader.Statistics.ImageCount++;
+	s_Loader.Statistics.CompressedBytes += compressedBytes;
+	s_Loader.Statistics.DecodedBytes += decodedBytes;
+	s_Loader.Statistics.Seconds += seconds;
+}
+
+// 解码一段内存中的文件并计时，可在任意线程调用
+static bool DecodeTimed(const Buffer& file, const ImageDecodeOptions& options, Image& image, double& seconds) {
+	const auto start = std::chrono::steady_clock::now();
+	const bool succeeded = ImageDecoder::Decode(file.Data, file.Size, options, image);
+	seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	return succeeded;
+}
+
+static bool ReadAndDecode(const std::filesystem::path& path, const ImageDecodeOptions& options, Image& image) {
+	Buffer file = FileSystem::ReadFileBinary(path);
+	if (!file) {
+		LOG_ERROR_ENGINE("TextureLoader: could not read '{0}'", path.string());
+		return false;
+	}
+	double seconds = 0.0;
+	if (!DecodeTimed(file, options, image, seconds)) {
+		LOG_ERROR_ENGINE("TextureLoader: failed to decode '{0}'", path.string());
+		return false;
+	}
+	RecordDecode(file.Size, image.Pixels.Size, seconds);
+	return true;
+}
+
+// 主线程：用解码结果创建纹理，像素缓冲区的所有权转交给上传队列
+static Ref<Texture2D> CreateTexture(Image&& image, const TextureLoadOptions& options) {
+	TextureSpecification specification;
+	specification.Width = image.Width;
+	specification.Height = image.Height;
+	specification.Format = TextureLoader::SelectFormat(image.Channels, options.Decode.SRGB);
+	specification.Mipmaps = options.Mipmaps == MipmapMode::Manual ? MipmapMode::None : options.Mipmaps;
+	specification.Sampler = options.Sampler;
+	Ref<Texture2D> texture = Texture2D::Create(specification);
+	if (texture) {
+		texture->SetData(std::move(image.Pixels));
+	}
+	return texture;
+}
+
+Ref<Texture2D> TextureLoader::Load(const std::filesystem::path& path, const TextureLoadOptions& options) {
+	Image image;
+	if (!ReadAndDecode(path, options.Decode, image)) {
+		return nullptr;
+	}
+	return CreateTexture(std::move(image), options);
+}
+
+void TextureLoader::LoadAsync(const std::filesystem::path& path, const TextureLoadOptions& options, LoadCallback callback) {
+	Ref<PendingTextureLoad> load = CreateRef<PendingTextureLoad>();
+	load->Path = path;
+	load->Options = options;
+	load->Callback = std::move(callback);
+	s_Loader.Pending.push_back(load);
+	JobSystem::Execute(s_Loader.Jobs, [load]() {
+		load->Succeeded = ReadAndDecode(load->Path, load->Options.Decode, load->Result);
+		load->Done.store(true, std::memory_order_release);
+	});
+}
+
+void TextureLoader::Update() {
+	// 回调中可能再次调用 LoadAsync，先把已完成的条目移出列表
+	std::vector<Ref<PendingTextureLoad>> completed;
+	auto it = std::stable_partition(s_Loader.Pending.begin(), s_Loader.Pending.end(),
+		[](const Ref<PendingTextureLoad>& load) { return !load->Done.load(std::memory_order_acquire); });
+	completed.assign(std::make_move_iterator(it), std::make_move_iterator(s_Loader.Pending.end()));
+	s_Loader.Pending.erase(it, s_Loader.Pending.end());
+
+	for (const Ref<PendingTextureLoad>& load : completed) {
+		Ref<Texture2D> texture = load->Succeeded ? CreateTexture(std::move(load->Result), load->Options) : nullptr;
+		if (load->Callback) {
+			load->Callback(texture);
+		}
+	}
+}
+
+void TextureLoader::Shutdown() {
+	JobSystem::Wait(s_Loader.Jobs);
+	s_Loader.Pending.clear();
+}
+
+uint32_t TextureLoader::GetPendingCount() {
+	return static_cast<uint32_t>(s_Loader.Pending.size());
+}
+
+ImageDecodeStatistics TextureLoader::GetStatistics() {
+	std::lock_guard<std::mutex> lock(s_Loader.StatisticsMutex);
+	return s_Loader.Statistics;
+}
+
+void TextureLoader::ResetStatistics() {
+	std::lock_guard<std::mutex> lock(s_Loader.StatisticsMutex);
+	s_Loader.Statistics = ImageDecodeStatistics();
+}
+
+ImageDecodeStatistics TextureLoader::Benchmark(const std::filesystem::path& directory, uint32_t iterations) {
+	std::vector<Buffer> files;
+	std::error_code error;
+	for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+		std::string extension = entry.path().extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		if (entry.is_regular_file() && (extension == ".png" || extension == ".qoi")) {
+			if (Buffer file = FileSystem::ReadFileBinary(entry.path())) {
+				files.push_back(std::move(file));
+			}
+		}
+	}
+	ImageDecodeStatistics result;
+	if (files.empty()) {
+		LOG_WARN_ENGINE("TextureLoader::Benchmark: no .png/.qoi files in '{0}'", directory.string());
+		return result;
+	}
+
+	// 每个任务解码一张图片，各自计时后在结束时汇总，避免任务之间争用锁
+	const uint32_t jobCount = static_cast<uint32_t>(files.size()) * iterations;
+	std::vector<ImageDecodeStatistics> perJob(jobCount);
+	ImageDecodeOptions options;
+	JobContext context;
+	const auto start = std::chrono::steady_clock::now();
+	JobSystem::Dispatch(context, jobCount, 1, [&](JobDispatchArgs args) {
+		const Buffer& file = files[args.JobIndex % files.size()];
+		Image image;
+		double seconds = 0.0;
+		if (DecodeTimed(file, options, image, seconds)) {
+			perJob[args.JobIndex] = { 1, file.Size, image.Pixels.Size, seconds };
+		}
+	});
+	JobSystem::Wait(context);
+	const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	for (const ImageDecodeStatistics& job : perJob) {
+		result.ImageCount += job.ImageCount;
+		result.CompressedBytes += job.CompressedBytes;
+		result.DecodedBytes += job.DecodedBytes;
+		result.Seconds += job.Seconds;
+	}
+	const double decodedMegabytes = static_cast<double>(result.DecodedBytes) / (1024.0 * 1024.0);
+	LOG_INFO_ENGINE("Image decode benchmark: {0} images, {1:.1f} MB decoded, {2:.1f} MB/s per core, {3:.1f} MB/s total on {4} threads",
+		result.ImageCount, decodedMegabytes, result.GetMegabytesPerSecondPerCore(),
+		wallSeconds > 0.0 ? decodedMegabytes / wallSeconds : 0.0, JobSystem::GetWorkerCount() + 1);
+	return result;
+}
+}
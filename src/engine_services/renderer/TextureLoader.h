@@ -0,0 +1,66 @@
+#pragma once
+#include "core/Core.h"
+#include "core/ImageDecoder.h"
+#include "Texture.h"
+#include <filesystem>
+#include <functional>
+
+// ---------------------------------------------------------------------
+// 文件: TextureLoader.h
+// 作用: 从图片文件创建纹理 (同步 / 异步)
+// 描述: 异步加载时，读文件与解码作为一个任务交给 JobSystem，每个工作线程一次解码一张图片，
+//       解码结果直接是紧密排列的 8 位像素，所有权随 SetData(Buffer&&) 转交给纹理的上传队列。
+//       纹理对象必须在 GL 线程上创建，因此完成的任务在主线程的 Update 中收尾并调用回调。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+struct TextureLoadOptions {
+	ImageDecodeOptions Decode;             // Decode.SRGB 同时决定纹理是否使用 sRGB 格式
+	MipmapMode Mipmaps = MipmapMode::GPU;
+	SamplerSpecification Sampler;
+};
+
+// 解码吞吐统计。Seconds 为各任务解码耗时之和（即占用的核心时间），不含读文件
+struct ImageDecodeStatistics {
+	uint32_t ImageCount = 0;
+	uint64_t CompressedBytes = 0;
+	uint64_t DecodedBytes = 0;
+	double Seconds = 0.0;
+
+	// 每个核心每秒解码出的像素数据量 (MB/s)
+	double GetMegabytesPerSecondPerCore() const {
+		return Seconds > 0.0 ? static_cast<double>(DecodedBytes) / (1024.0 * 1024.0) / Seconds : 0.0;
+	}
+};
+
+class TextureLoader {
+public:
+	using LoadCallback = std::function<void(const Ref<Texture2D>& texture)>;
+
+	// 在当前线程上读取并解码，失败时返回 nullptr
+	static Ref<Texture2D> Load(const std::filesystem::path& path, const TextureLoadOptions& options = {});
+	// 在工作线程上读取并解码；纹理在之后某一帧的 Update 中创建，失败时回调收到 nullptr
+	static void LoadAsync(const std::filesystem::path& path, const TextureLoadOptions& options, LoadCallback callback);
+
+	// 主线程每帧调用（Renderer::EndFrame）：为已解码完成的图片创建纹理并调用回调
+	static void Update();
+	// 等待进行中的任务并丢弃结果，在销毁图形上下文之前调用
+	static void Shutdown();
+	static uint32_t GetPendingCount();
+
+	// 解码结果的通道数对应的纹理格式，srgb 只影响 3、4 通道
+	static ImageFormat SelectFormat(uint32_t channels, bool srgb);
+
+	static ImageDecodeStatistics GetStatistics();
+	static void ResetStatistics();
+
+	/**
+	 * @brief 解码基准测试
+	 *
+	 * 读入目录中所有 .png / .qoi 文件后，用全部工作线程、每个任务一张图片解码 iterations 遍，
+	 * 记录每核心吞吐与整体吞吐到日志。文件读取不计入耗时。
+	 */
+	static ImageDecodeStatistics Benchmark(const std::filesystem::path& directory, uint32_t iterations = 1);
+};
+}
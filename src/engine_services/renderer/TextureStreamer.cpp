@@ -0,0 +1,378 @@
+#include "TextureStreamer.h"
+#include "core/FileSystem.h"
+#include "core/ImageDecoder.h"
+#include "core/Log.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace GE {
+
+// 改变全局 mip 偏移的最短间隔，给替换后的纹理留出释放显存的时间，避免来回振荡
+static constexpr uint64_t s_MipBiasCooldownFrames = 30;
+static constexpr uint32_t s_MaxMipBias = 4;
+
+// 一次后台加载：任务在工作线程上填写结果，完成后置位 Done，主线程只读取 Done 为 true 的加载
+struct TextureStreamer::StreamingLoad {
+	std::filesystem::path Path;
+	ImageDecodeOptions Options;
+	uint32_t TailSize = 0;
+	uint32_t TargetMip = InvalidMip; // InvalidMip 表示只加载 mip 尾
+	bool NeedTail = false;           // 同时输出 mip 尾供 CPU 端保留
+
+	uint32_t Width = 0;
+	uint32_t Height = 0;
+	uint32_t Channels = 0;
+	uint32_t TailMip = 0;
+	uint32_t ResultMip = 0;
+	Buffer Pixels;
+	Buffer TailPixels;
+	bool Succeeded = false;
+	std::atomic<bool> Done{ false };
+};
+
+// 第一个边长不超过 tailSize 的 mip 层
+static uint32_t CalculateTailMip(uint32_t width, uint32_t height, uint32_t tailSize) {
+	uint32_t mip = 0;
+	while (std::max(width >> mip, height >> mip) > std::max(tailSize, 1u)) {
+		++mip;
+	}
+	return mip;
+}
+
+// 屏幕上一个像素大约对应原图的几个像素，取 log2 即为所需的 mip 层
+static uint32_t SelectMip(uint32_t width, uint32_t height, float screenSize) {
+	const float ratio = static_cast<float>(std::max(width, height)) / std::max(screenSize, 1.0f);
+	return ratio <= 1.0f ? 0 : static_cast<uint32_t>(std::floor(std::log2(ratio)));
+}
+
+TextureStreamer::TextureStreamer(const TextureStreamerSpecification& specification)
+	: m_Specification(specification) {
+	m_Statistics.BudgetBytes = specification.BudgetBytes;
+}
+
+TextureStreamer::~TextureStreamer() {
+	// 任务持有的是 StreamingLoad 的引用，但完成计数在 m_Jobs 中
+	JobSystem::Wait(m_Jobs);
+}
+
+StreamedTextureHandle TextureStreamer::Register(const std::filesystem::path& path) {
+	uint32_t index = 0;
+	if (!m_FreeIndices.empty()) {
+		index = m_FreeIndices.back();
+		m_FreeIndices.pop_back();
+	} else {
+		index = static_cast<uint32_t>(m_Entries.size());
+		m_Entries.emplace_back();
+	}
+	Entry& entry = m_Entries[index];
+	entry = Entry();
+	entry.Path = path;
+	entry.Active = true;
+	StartLoad(entry, InvalidMip);
+	return { index };
+}
+
+void TextureStreamer::Unregister(StreamedTextureHandle handle) {
+	if (!handle.IsValid() || handle.Index >= m_Entries.size() || !m_Entries[handle.Index].Active) {
+		return;
+	}
+	Entry& entry = m_Entries[handle.Index];
+	if (entry.Texture) {
+		m_CommittedBytes -= GetTextureBytes(entry, entry.ResidentMip);
+	}
+	if (entry.Incoming) {
+		m_CommittedBytes -= GetTextureBytes(entry, entry.IncomingMip);
+	}
+	// 进行中的任务仍会执行完，结果随 StreamingLoad 一起释放
+	if (entry.Load) {
+		m_CommittedBytes -= entry.ReservedBytes;
+		m_LoadsInFlight--;
+	}
+	entry = Entry();
+	m_FreeIndices.push_back(handle.Index);
+}
+
+void TextureStreamer::Request(StreamedTextureHandle handle, float screenSize, float distance) {
+	ASSERT_ENGINE(handle.IsValid() && handle.Index < m_Entries.size() && m_Entries[handle.Index].Active, "Invalid streamed texture handle!");
+	Entry& entry = m_Entries[handle.Index];
+	if (entry.LastUsedFrame != m_Frame) {
+		entry.LastUsedFrame = m_Frame;
+		entry.ScreenSize = screenSize;
+		entry.Distance = distance;
+	} else {
+		entry.ScreenSize = std::max(entry.ScreenSize, screenSize);
+		entry.Distance = std::min(entry.Distance, distance);
+	}
+}
+
+float TextureStreamer::EstimateScreenSize(float worldSize, float distance, float fovY, uint32_t viewportHeight) {
+	if (distance <= 0.0f) {
+		return static_cast<float>(viewportHeight);
+	}
+	return worldSize / (2.0f * distance * std::tan(fovY * 0.5f)) * static_cast<float>(viewportHeight);
+}
+
+void TextureStreamer::Update() {
+	m_Statistics.LoadsThisFrame = 0;
+	m_Statistics.EvictionsThisFrame = 0;
+
+	// 1. 收尾已完成的解码任务，创建新纹理并开始上传
+	for (Entry& entry : m_Entries) {
+		if (entry.Load && entry.Load->Done.load(std::memory_order_acquire)) {
+			CompleteLoad(entry);
+		}
+	}
+
+	// 2. 新纹理的数据全部到达 GPU 后替换旧纹理
+	for (Entry& entry : m_Entries) {
+		if (entry.Incoming && entry.Incoming->IsLoaded()) {
+			if (entry.Texture) {
+				m_CommittedBytes -= GetTextureBytes(entry, entry.ResidentMip);
+			}
+			entry.Texture = std::move(entry.Incoming);
+			entry.ResidentMip = entry.IncomingMip;
+			entry.IncomingMip = InvalidMip;
+		}
+	}
+
+	// 3. 计算本帧用到的纹理所需的 mip 层；最近未使用且高于 mip 尾的纹理可以驱逐
+	std::vector<uint32_t> candidates;
+	std::vector<uint32_t> evictable;
+	for (uint32_t i = 0; i < static_cast<uint32_t>(m_Entries.size()); ++i) {
+		Entry& entry = m_Entries[i];
+		if (!entry.Active || entry.Failed || !entry.Texture) {
+			continue;
+		}
+		const bool busy = entry.Load || entry.Incoming;
+		if (IsUsedThisFrame(entry)) {
+			entry.WantedMip = std::min(SelectMip(entry.Width, entry.Height, entry.ScreenSize) + m_MipBias, entry.TailMip);
+			if (!busy && entry.WantedMip != entry.ResidentMip) {
+				candidates.push_back(i);
+			}
+		} else if (!busy && entry.ResidentMip < entry.TailMip) {
+			evictable.push_back(i);
+		}
+	}
+	// 屏幕尺寸大的优先，相同时近的优先
+	std::sort(candidates.begin(), candidates.end(), [this](uint32_t a, uint32_t b) {
+		const Entry& ea = m_Entries[a];
+		const Entry& eb = m_Entries[b];
+		return ea.ScreenSize != eb.ScreenSize ? ea.ScreenSize > eb.ScreenSize : ea.Distance < eb.Distance;
+	});
+	std::sort(evictable.begin(), evictable.end(), [this](uint32_t a, uint32_t b) {
+		return m_Entries[a].LastUsedFrame < m_Entries[b].LastUsedFrame;
+	});
+
+	// 4. 按优先级调度。降低精度不受预算限制（替换后反而释放显存）；
+	//    提高精度时新旧纹理会短暂共存，放不下就先驱逐最久未使用的纹理，再不行就降低目标精度
+	const uint64_t budget = m_Specification.BudgetBytes;
+	size_t nextEviction = 0;
+	uint32_t degraded = 0;
+	for (uint32_t index : candidates) {
+		Entry& entry = m_Entries[index];
+		if (entry.WantedMip == entry.TailMip) {
+			// mip 尾在 CPU 端有现成的数据，不需要解码
+			entry.Incoming = CreateMipTexture(entry, entry.TailMip, Buffer(entry.TailPixels));
+			entry.IncomingMip = entry.TailMip;
+			m_CommittedBytes += GetTextureBytes(entry, entry.TailMip);
+			continue;
+		}
+		if (m_LoadsInFlight >= m_Specification.MaxLoadsInFlight) {
+			continue;
+		}
+		if (entry.WantedMip > entry.ResidentMip) {
+			StartLoad(entry, entry.WantedMip);
+			continue;
+		}
+		uint32_t target = entry.WantedMip;
+		while (m_CommittedBytes + GetTextureBytes(entry, target) > budget && nextEviction < evictable.size()) {
+			Evict(m_Entries[evictable[nextEviction++]]);
+		}
+		while (target < entry.ResidentMip && m_CommittedBytes + GetTextureBytes(entry, target) > budget) {
+			++target;
+		}
+		if (target != entry.WantedMip) {
+			degraded++;
+		}
+		if (target < entry.ResidentMip) {
+			StartLoad(entry, target);
+		}
+	}
+
+	// 5. 正在使用的纹理本身就超出预算时整体降低一级精度；
+	//    用量降到预算的四分之一以下（提高一级约占四倍显存）再恢复
+	if (m_Frame - m_LastBiasChangeFrame >= s_MipBiasCooldownFrames) {
+		if (m_CommittedBytes > budget && m_MipBias < s_MaxMipBias) {
+			m_MipBias++;
+			m_LastBiasChangeFrame = m_Frame;
+			LOG_WARN_ENGINE("TextureStreamer over budget ({0} / {1} MB), mip bias raised to {2}",
+				m_CommittedBytes / (1024 * 1024), budget / (1024 * 1024), m_MipBias);
+		} else if (m_MipBias > 0 && degraded == 0 && m_CommittedBytes < budget / 4) {
+			m_MipBias--;
+			m_LastBiasChangeFrame = m_Frame;
+		}
+	}
+
+	// 6. 统计
+	m_Statistics.BudgetBytes = budget;
+	m_Statistics.CommittedBytes = m_CommittedBytes;
+	m_Statistics.TextureCount = 0;
+	m_Statistics.FullyResidentCount = 0;
+	m_Statistics.DegradedCount = degraded;
+	m_Statistics.LoadsInFlight = m_LoadsInFlight;
+	m_Statistics.MipBias = m_MipBias;
+	for (const Entry& entry : m_Entries) {
+		if (!entry.Active) {
+			continue;
+		}
+		m_Statistics.TextureCount++;
+		if (entry.Texture && (entry.WantedMip == InvalidMip || entry.ResidentMip <= entry.WantedMip)) {
+			m_Statistics.FullyResidentCount++;
+		}
+	}
+	m_Frame++;
+}
+
+const Ref<Texture2D>& TextureStreamer::GetTexture(StreamedTextureHandle handle) const {
+	static const Ref<Texture2D> s_Null;
+	if (!handle.IsValid() || handle.Index >= m_Entries.size()) {
+		return s_Null;
+	}
+	return m_Entries[handle.Index].Texture;
+}
+
+uint32_t TextureStreamer::GetResidentMip(StreamedTextureHandle handle) const {
+	return handle.IsValid() && handle.Index < m_Entries.size() ? m_Entries[handle.Index].ResidentMip : InvalidMip;
+}
+
+uint32_t TextureStreamer::GetWantedMip(StreamedTextureHandle handle) const {
+	return handle.IsValid() && handle.Index < m_Entries.size() ? m_Entries[handle.Index].WantedMip : InvalidMip;
+}
+
+void TextureStreamer::SetBudget(uint64_t bytes) {
+	m_Specification.BudgetBytes = bytes;
+	m_Statistics.BudgetBytes = bytes;
+}
+
+void TextureStreamer::RunLoad(StreamingLoad& load) {
+	Image image;
+	{
+		Buffer file = FileSystem::ReadFileBinary(load.Path);
+		if (!file || !ImageDecoder::Decode(file.Data, file.Size, load.Options, image)) {
+			LOG_ERROR_ENGINE("TextureStreamer: failed to load '{0}'", load.Path.string());
+			load.Done.store(true, std::memory_order_release);
+			return;
+		}
+	}
+	load.Width = image.Width;
+	load.Height = image.Height;
+	load.Channels = image.Channels;
+	load.TailMip = CalculateTailMip(image.Width, image.Height, load.TailSize);
+	load.ResultMip = load.TargetMip == InvalidMip ? load.TailMip : std::min(load.TargetMip, load.TailMip);
+
+	// 逐层缩小到目标层；需要 mip 尾时继续缩小到 mip 尾
+	const bool srgb = load.Options.SRGB && image.Channels >= 3;
+	uint32_t width = image.Width;
+	uint32_t height = image.Height;
+	Buffer level = std::move(image.Pixels);
+	for (uint32_t mip = 0;; ++mip) {
+		const bool keepTail = load.NeedTail && mip == load.TailMip;
+		const bool last = mip == load.TailMip || (mip == load.ResultMip && !load.NeedTail);
+		if (mip == load.ResultMip) {
+			load.Pixels = last && !keepTail ? std::move(level) : Buffer(level);
+		}
+		if (keepTail) {
+			load.TailPixels = std::move(level);
+		}
+		if (last) {
+			break;
+		}
+		level = ImageDecoder::Downsample(level.Data, width, height, image.Channels, srgb);
+		width = std::max(1u, width / 2);
+		height = std::max(1u, height / 2);
+	}
+	load.Succeeded = true;
+	load.Done.store(true, std::memory_order_release);
+}
+
+void TextureStreamer::StartLoad(Entry& entry, uint32_t mip) {
+	Ref<StreamingLoad> load = CreateRef<StreamingLoad>();
+	load->Path = entry.Path;
+	load->Options = m_Specification.Load.Decode;
+	load->TailSize = m_Specification.TailSize;
+	load->TargetMip = mip;
+	load->NeedTail = !entry.TailPixels;
+	entry.Load = load;
+	// 首次加载时还不知道尺寸，在完成时再计入
+	entry.ReservedBytes = mip == InvalidMip ? 0 : GetTextureBytes(entry, mip);
+	m_CommittedBytes += entry.ReservedBytes;
+	m_LoadsInFlight++;
+	m_Statistics.LoadsThisFrame++;
+	m_Statistics.TotalLoads++;
+	JobSystem::Execute(m_Jobs, [load]() { RunLoad(*load); });
+}
+
+void TextureStreamer::CompleteLoad(Entry& entry) {
+	Ref<StreamingLoad> load = std::move(entry.Load);
+	m_CommittedBytes -= entry.ReservedBytes;
+	entry.ReservedBytes = 0;
+	m_LoadsInFlight--;
+	if (!load->Succeeded) {
+		entry.Failed = true;
+		return;
+	}
+	entry.Width = load->Width;
+	entry.Height = load->Height;
+	entry.Channels = load->Channels;
+	entry.TailMip = load->TailMip;
+	if (load->TailPixels) {
+		entry.TailPixels = std::move(load->TailPixels);
+	}
+	entry.Incoming = CreateMipTexture(entry, load->ResultMip, std::move(load->Pixels));
+	entry.IncomingMip = load->ResultMip;
+	m_CommittedBytes += GetTextureBytes(entry, entry.IncomingMip);
+}
+
+void TextureStreamer::Evict(Entry& entry) {
+	m_CommittedBytes -= GetTextureBytes(entry, entry.ResidentMip);
+	// 被驱逐的纹理最近没有绘制，直接替换即可，不必等新纹理上传完成
+	entry.Texture = CreateMipTexture(entry, entry.TailMip, Buffer(entry.TailPixels));
+	entry.ResidentMip = entry.TailMip;
+	m_CommittedBytes += GetTextureBytes(entry, entry.TailMip);
+	m_Statistics.EvictionsThisFrame++;
+	m_Statistics.TotalEvictions++;
+}
+
+Ref<Texture2D> TextureStreamer::CreateMipTexture(const Entry& entry, uint32_t mip, Buffer&& pixels) const {
+	const TextureLoadOptions& options = m_Specification.Load;
+	TextureSpecification specification;
+	specification.Width = std::max(1u, entry.Width >> mip);
+	specification.Height = std::max(1u, entry.Height >> mip);
+	specification.Format = TextureLoader::SelectFormat(entry.Channels, options.Decode.SRGB);
+	specification.Mipmaps = options.Mipmaps == MipmapMode::Manual ? MipmapMode::None : options.Mipmaps;
+	specification.Sampler = options.Sampler;
+	Ref<Texture2D> texture = Texture2D::Create(specification);
+	if (texture) {
+		texture->SetData(std::move(pixels));
+	}
+	return texture;
+}
+
+uint64_t TextureStreamer::GetTextureBytes(const Entry& entry, uint32_t mip) const {
+	const MipmapMode mipmaps = m_Specification.Load.Mipmaps;
+	const bool mipmapped = mipmaps == MipmapMode::GPU || mipmaps == MipmapMode::CPU;
+	uint32_t width = std::max(1u, entry.Width >> mip);
+	uint32_t height = std::max(1u, entry.Height >> mip);
+	uint64_t bytes = 0;
+	while (true) {
+		bytes += static_cast<uint64_t>(width) * height * entry.Channels;
+		if (!mipmapped || (width == 1 && height == 1)) {
+			break;
+		}
+		width = std::max(1u, width / 2);
+		height = std::max(1u, height / 2);
+	}
+	return bytes;
+}
+}
@@ -0,0 +1,134 @@
+#pragma once
+#include "core/Core.h"
+#include "core/JobSystem.h"
+#include "TextureLoader.h"
+#include <filesystem>
+#include <vector>
+
+// ---------------------------------------------------------------------
+// 类: TextureStreamer
+// 作用: 按显存预算流送纹理的 mip 层
+// 描述: 每张纹理只保留当前需要的分辨率：从所需的 mip 层开始到最小层的一条 mip 链。
+//       每帧用 Request 报告纹理在屏幕上的大小与距离，Update 据此算出所需的 mip 层，
+//       按优先级（屏幕尺寸大的优先，相同时近的优先）在工作线程上解码、缩小后创建新纹理，
+//       新纹理的数据全部到达 GPU 后才替换旧纹理，切换时不会闪烁。
+//       最小的几层 (mip 尾，边长不超过 TailSize) 在 CPU 端保留一份并始终常驻，是纹理最低的精度。
+//       已用量（常驻 + 传输中 + 为进行中的加载预留）超出预算时，先把最久未使用的纹理降回 mip 尾，
+//       仍放不下则以更低的精度加载；正在使用的纹理本身就超出预算时，逐步增大全局 mip 偏移，
+//       让所有纹理整体降低一级精度，而不是阻塞等待。
+//       由主线程调用，本身不直接调用图形 API：纹理经 Create 工厂在渲染线程上创建，
+//       像素数据放入纹理的上传队列，由渲染线程上传；是否到达 GPU 通过 IsLoaded 查询。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+struct TextureStreamerSpecification {
+	uint64_t BudgetBytes = 256ull * 1024 * 1024; // 所有流送纹理的显存预算（按像素数据估算）
+	uint32_t TailSize = 64;                      // 边长不超过此值的 mip 层常驻，不参与流送
+	uint32_t MaxLoadsInFlight = 4;               // 同时进行的解码任务上限
+	TextureLoadOptions Load;
+};
+
+struct StreamedTextureHandle {
+	static constexpr uint32_t Invalid = 0xFFFFFFFF;
+	uint32_t Index = Invalid;
+
+	inline bool IsValid() const { return Index != Invalid; }
+};
+
+struct TextureStreamerStatistics {
+	uint64_t BudgetBytes = 0;
+	uint64_t CommittedBytes = 0;   // 常驻 + 传输中 + 为进行中的加载预留
+	uint32_t TextureCount = 0;
+	uint32_t FullyResidentCount = 0; // 常驻精度已达到所需精度的纹理
+	uint32_t DegradedCount = 0;      // 因预算不足以低于所需的精度加载的纹理（本帧）
+	uint32_t LoadsInFlight = 0;
+	uint32_t MipBias = 0;
+	uint32_t LoadsThisFrame = 0;
+	uint32_t EvictionsThisFrame = 0;
+	uint64_t TotalLoads = 0;
+	uint64_t TotalEvictions = 0;
+};
+
+class TextureStreamer {
+public:
+	static constexpr uint32_t InvalidMip = 0xFFFFFFFF;
+
+	TextureStreamer(const TextureStreamerSpecification& specification = {});
+	~TextureStreamer();
+
+	// 注册一张图片文件，随即在后台加载它的 mip 尾
+	StreamedTextureHandle Register(const std::filesystem::path& path);
+	void Unregister(StreamedTextureHandle handle);
+
+	/**
+	 * @brief 报告本帧要绘制该纹理
+	 *
+	 * screenSize 为纹理在屏幕上覆盖的像素数（沿较长的一边），决定所需的 mip 层；
+	 * distance 为到相机的距离，用于屏幕尺寸相同时的加载顺序。同一帧多次调用时取最大的需求。
+	 */
+	void Request(StreamedTextureHandle handle, float screenSize, float distance);
+	// 按透视投影估算物体在屏幕上的像素尺寸
+	static float EstimateScreenSize(float worldSize, float distance, float fovY, uint32_t viewportHeight);
+
+	// 每帧调用一次：完成加载、替换纹理、按预算调度新的加载与驱逐
+	void Update();
+
+	// 当前常驻的纹理，mip 尾加载完成之前为 nullptr
+	const Ref<Texture2D>& GetTexture(StreamedTextureHandle handle) const;
+	// 常驻纹理的第 0 层对应原图的第几层 mip，尚未加载时为 InvalidMip
+	uint32_t GetResidentMip(StreamedTextureHandle handle) const;
+	uint32_t GetWantedMip(StreamedTextureHandle handle) const;
+
+	void SetBudget(uint64_t bytes);
+	inline const TextureStreamerStatistics& GetStatistics() const { return m_Statistics; }
+	inline const TextureStreamerSpecification& GetSpecification() const { return m_Specification; }
+private:
+	struct StreamingLoad;
+
+	struct Entry {
+		std::filesystem::path Path;
+		bool Active = false;
+		bool Failed = false;
+		// 原图信息，首次加载完成后才知道
+		uint32_t Width = 0;
+		uint32_t Height = 0;
+		uint32_t Channels = 0;
+		uint32_t TailMip = 0;
+		Buffer TailPixels;
+
+		Ref<Texture2D> Texture;
+		uint32_t ResidentMip = InvalidMip;
+		Ref<Texture2D> Incoming;          // 已创建、数据仍在上传的新纹理
+		uint32_t IncomingMip = InvalidMip;
+		Ref<StreamingLoad> Load;          // 进行中的解码任务
+		uint64_t ReservedBytes = 0;
+
+		uint32_t WantedMip = InvalidMip;
+		float ScreenSize = 0.0f;
+		float Distance = 0.0f;
+		uint64_t LastUsedFrame = 0;
+	};
+
+	// 在工作线程上读文件、解码并缩小到目标层
+	static void RunLoad(StreamingLoad& load);
+	void StartLoad(Entry& entry, uint32_t mip);
+	void CompleteLoad(Entry& entry);
+	// 立即降回 mip 尾（使用 CPU 端保留的数据）
+	void Evict(Entry& entry);
+	Ref<Texture2D> CreateMipTexture(const Entry& entry, uint32_t mip, Buffer&& pixels) const;
+	uint64_t GetTextureBytes(const Entry& entry, uint32_t mip) const;
+	inline bool IsUsedThisFrame(const Entry& entry) const { return entry.LastUsedFrame == m_Frame; }
+private:
+	TextureStreamerSpecification m_Specification;
+	std::vector<Entry> m_Entries;
+	std::vector<uint32_t> m_FreeIndices;
+	JobContext m_Jobs;
+	uint64_t m_Frame = 1;
+	uint64_t m_CommittedBytes = 0;
+	uint32_t m_LoadsInFlight = 0;
+	uint32_t m_MipBias = 0;
+	uint64_t m_LastBiasChangeFrame = 0;
+	TextureStreamerStatistics m_Statistics;
+};
+}
@@ -0,0 +1,153 @@
+#pragma once
+#include "Buffer.h"
+#include "VertexPacking.h"
+#include "core/CoreMath.h"
+#include <type_traits>
+
+// ---------------------------------------------------------------------
+// 文件: VertexLayout.h
+// 作用: 由顶点结构体在编译期生成 BufferLayout
+// 描述: MakeLayout<&Vertex::Position, &Vertex::Normal, ...>() 根据成员类型推导 ShaderDataType，
+//       按 C++ 的对齐规则计算各成员偏移与步幅，并用 static_assert 校验成员的顺序与步幅等于 sizeof(Vertex)。
+//       成员必须按声明顺序全部列出，顶点结构体需可在常量求值中默认构造；
+//       结果是 constexpr 的 BufferLayout，创建网格时无需任何分配。
+//
+//       struct Vertex { Vec3 Position; PackedSnorm1010102 Normal; PackedHalf2 UV; };
+//       static constexpr BufferLayout s_Layout = MakeLayout<&Vertex::Position, &Vertex::Normal, &Vertex::UV>();
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+// 成员类型到 ShaderDataType 的映射；未特化的类型在编译期报错
+template<typename T>
+struct VertexAttributeTraits;
+
+#define GE_VERTEX_ATTRIBUTE(type, shaderType, normalized) \
+	template<> struct VertexAttributeTraits<type> { \
+		static constexpr ShaderDataType Type = ShaderDataType::shaderType; \
+		static constexpr bool Normalized = normalized; \
+	}
+
+GE_VERTEX_ATTRIBUTE(float, Float, false);
+GE_VERTEX_ATTRIBUTE(Vec2, Float2, false);
+GE_VERTEX_ATTRIBUTE(Vec3, Float3, false);
+GE_VERTEX_ATTRIBUTE(Vec4, Float4, false);
+GE_VERTEX_ATTRIBUTE(Mat3, Mat3, false);
+GE_VERTEX_ATTRIBUTE(Mat4, Mat4, false);
+GE_VERTEX_ATTRIBUTE(int32_t, Int, false);
+GE_VERTEX_ATTRIBUTE(glm::ivec2, Int2, false);
+GE_VERTEX_ATTRIBUTE(glm::ivec3, Int3, false);
+GE_VERTEX_ATTRIBUTE(glm::ivec4, Int4, false);
+GE_VERTEX_ATTRIBUTE(bool, Bool, false);
+GE_VERTEX_ATTRIBUTE(PackedHalf2, Half2, false);
+GE_VERTEX_ATTRIBUTE(PackedHalf4, Half4, false);
+GE_VERTEX_ATTRIBUTE(PackedUByte4, UByte4, false);
+GE_VERTEX_ATTRIBUTE(PackedUByte4Norm, UByte4Norm, true);
+GE_VERTEX_ATTRIBUTE(PackedByte4Norm, Byte4Norm, true);
+GE_VERTEX_ATTRIBUTE(PackedUShort2Norm, UShort2Norm, true);
+GE_VERTEX_ATTRIBUTE(PackedShort2Norm, Short2Norm, true);
+GE_VERTEX_ATTRIBUTE(PackedShort4Norm, Short4Norm, true);
+GE_VERTEX_ATTRIBUTE(PackedSnorm1010102, Int2_10_10_10_Rev, true);
+
+#undef GE_VERTEX_ATTRIBUTE
+
+// 从成员指针 &Class::Member 中取出类类型与成员类型
+template<auto MemberPointer>
+struct MemberPointerTraits;
+
+template<typename Class, typename Member, Member Class::* MemberPointer>
+struct MemberPointerTraits<MemberPointer> {
+	using ClassType = Class;
+	using MemberType = Member;
+};
+
+template<auto First, auto... Rest>
+struct FirstMember {
+	static constexpr auto Value = First;
+};
+
+/**
+ * @brief 成员指针是否按声明顺序列出
+ *
+ * 偏移按列出的顺序模拟计算，顺序与声明不一致时结果是错误的。
+ * 在常量求值中比较各成员的地址：同一对象中声明越靠后的成员地址越大。
+ */
+template<auto... Members>
+constexpr bool MembersInDeclarationOrder() {
+	typename MemberPointerTraits<FirstMember<Members...>::Value>::ClassType vertex;
+	const std::array<const void*, sizeof...(Members)> addresses = { &(vertex.*Members)... };
+	for (size_t i = 1; i < addresses.size(); ++i) {
+		if (!(addresses[i - 1] < addresses[i])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+template<auto... Members>
+struct VertexLayoutInfo {
+	static constexpr size_t Count = sizeof...(Members);
+	static_assert(Count > 0, "MakeLayout requires at least one member");
+	static_assert(Count <= BufferLayout::MaxElements, "Too many vertex attributes");
+
+	using Vertex = typename MemberPointerTraits<FirstMember<Members...>::Value>::ClassType;
+	static_assert((std::is_same_v<typename MemberPointerTraits<Members>::ClassType, Vertex> && ...),
+		"All members passed to MakeLayout must belong to the same vertex struct");
+	static_assert(std::is_standard_layout_v<Vertex>, "Vertex struct must be standard layout");
+	static_assert(((sizeof(typename MemberPointerTraits<Members>::MemberType)
+		== ShaderDataTypeSize(VertexAttributeTraits<typename MemberPointerTraits<Members>::MemberType>::Type)) && ...),
+		"Vertex member size does not match its ShaderDataType");
+
+	static_assert(MembersInDeclarationOrder<Members...>(), "MakeLayout members must be listed in declaration order");
+
+	static constexpr std::array<ShaderDataType, Count> Types = {
+		VertexAttributeTraits<typename MemberPointerTraits<Members>::MemberType>::Type... };
+	static constexpr std::array<bool, Count> Normalized = {
+		VertexAttributeTraits<typename MemberPointerTraits<Members>::MemberType>::Normalized... };
+	static constexpr std::array<size_t, Count> Sizes = {
+		sizeof(typename MemberPointerTraits<Members>::MemberType)... };
+	static constexpr std::array<size_t, Count> Alignments = {
+		alignof(typename MemberPointerTraits<Members>::MemberType)... };
+
+	// 按声明顺序模拟编译器的成员排布：每个成员对齐到自身的 alignof
+	static constexpr std::array<size_t, Count> Offsets = [] {
+		std::array<size_t, Count> offsets{};
+		size_t offset = 0;
+		for (size_t i = 0; i < Count; ++i) {
+			offset = (offset + Alignments[i] - 1) / Alignments[i] * Alignments[i];
+			offsets[i] = offset;
+			offset += Sizes[i];
+		}
+		return offsets;
+	}();
+
+	static constexpr size_t Stride = [] {
+		size_t maxAlignment = 1;
+		for (size_t alignment : Alignments) {
+			maxAlignment = alignment > maxAlignment ? alignment : maxAlignment;
+		}
+		const size_t end = Offsets[Count - 1] + Sizes[Count - 1];
+		return (end + maxAlignment - 1) / maxAlignment * maxAlignment;
+	}();
+	static_assert(Stride == sizeof(Vertex),
+		"Vertex layout does not cover the whole struct: list every member in declaration order");
+};
+
+/**
+ * @brief 由顶点结构体的成员指针在编译期生成 BufferLayout
+ *
+ * @tparam Members 顶点结构体的成员指针，按声明顺序全部列出
+ * @param names 各属性的名称（字符串字面量），可省略
+ * @return 偏移、步幅、类型都已确定的 BufferLayout，可用于 constexpr 变量
+ */
+template<auto... Members>
+constexpr BufferLayout MakeLayout(const std::array<const char*, sizeof...(Members)>& names = {}) {
+	using Info = VertexLayoutInfo<Members...>;
+	std::array<BufferElement, Info::Count> elements{};
+	for (size_t i = 0; i < Info::Count; ++i) {
+		elements[i] = BufferElement(Info::Types[i], names[i] ? names[i] : "", Info::Normalized[i]);
+		elements[i].Offset = Info::Offsets[i];
+	}
+	return BufferLayout(std::span<const BufferElement>(elements), static_cast<uint32_t>(Info::Stride));
+}
+}
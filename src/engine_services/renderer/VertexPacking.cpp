@@ -0,0 +1,329 @@
+#include "VertexPacking.h"
+#include <algorithm>
+#include <cstring>
+
+// 批量转换只有 SSE2 实现（x86-64 的基线指令集，MSVC x64 不定义 __SSE2__），其他架构需要先补上对应的实现
+#if !defined(__SSE2__) && !defined(_M_X64) && !(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#error "VertexPacking requires SSE2"
+#endif
+#include <emmintrin.h>
+
+// MSVC 在 /arch:AVX2 下定义 __AVX2__，支持 AVX2 的 CPU 都带有 F16C
+#if defined(__F16C__) || defined(__AVX2__)
+#define GE_VERTEX_PACKING_F16C 1
+#include <immintrin.h>
+#endif
+
+namespace GE {
+
+// ==================== 加载 / 存储 ====================
+// 批量接口每次处理 4 个分量，末尾不足 4 个时经由临时数组补零读写
+
+static inline __m128 LoadFloat4(const float* src, size_t n) {
+	if (n == 4) {
+		return _mm_loadu_ps(src);
+	}
+	float temp[4] = {};
+	memcpy(temp, src, n * sizeof(float));
+	return _mm_loadu_ps(temp);
+}
+
+static inline void StoreFloat4(float* dst, __m128 value, size_t n) {
+	if (n == 4) {
+		_mm_storeu_ps(dst, value);
+		return;
+	}
+	float temp[4];
+	_mm_storeu_ps(temp, value);
+	memcpy(dst, temp, n * sizeof(float));
+}
+
+// 4 个 32 位值
+static inline __m128i LoadInt4(const void* src, size_t n) {
+	if (n == 4) {
+		return _mm_loadu_si128(static_cast<const __m128i*>(src));
+	}
+	uint32_t temp[4] = {};
+	memcpy(temp, src, n * sizeof(uint32_t));
+	return _mm_loadu_si128(reinterpret_cast<const __m128i*>(temp));
+}
+
+static inline void StoreInt4(void* dst, __m128i value, size_t n) {
+	if (n == 4) {
+		_mm_storeu_si128(static_cast<__m128i*>(dst), value);
+		return;
+	}
+	uint32_t temp[4];
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(temp), value);
+	memcpy(dst, temp, n * sizeof(uint32_t));
+}
+
+// 4 个 16 位值，位于寄存器低 64 位
+static inline __m128i LoadShort4(const void* src, size_t n) {
+	if (n == 4) {
+		return _mm_loadl_epi64(static_cast<const __m128i*>(src));
+	}
+	uint16_t temp[4] = {};
+	memcpy(temp, src, n * sizeof(uint16_t));
+	return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(temp));
+}
+
+static inline void StoreShort4(void* dst, __m128i value, size_t n) {
+	if (n == 4) {
+		_mm_storel_epi64(static_cast<__m128i*>(dst), value);
+		return;
+	}
+	uint16_t temp[4];
+	_mm_storel_epi64(reinterpret_cast<__m128i*>(temp), value);
+	memcpy(dst, temp, n * sizeof(uint16_t));
+}
+
+// 4 个 8 位值，位于寄存器低 32 位
+static inline __m128i LoadByte4(const void* src, size_t n) {
+	uint32_t packed = 0;
+	memcpy(&packed, src, n);
+	return _mm_cvtsi32_si128(static_cast<int>(packed));
+}
+
+static inline void StoreByte4(void* dst, __m128i value, size_t n) {
+	const uint32_t packed = static_cast<uint32_t>(_mm_cvtsi128_si32(value));
+	memcpy(dst, &packed, n);
+}
+
+static inline __m128 Clamp(__m128 value, float minValue, float maxValue) {
+	// max 的第一个操作数为 NaN 时返回第二个操作数，因此 NaN 会被截断为 minValue
+	return _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(minValue)), _mm_set1_ps(maxValue));
+}
+
+// 取每个 32 位通道的低 16 位并压缩到低 64 位（先符号扩展，packs 就不会饱和）
+static inline __m128i PackLow16(__m128i value) {
+	value = _mm_srai_epi32(_mm_slli_epi32(value, 16), 16);
+	return _mm_packs_epi32(value, value);
+}
+
+// ==================== 半精度浮点 ====================
+
+static inline __m128i FloatToHalf4(__m128 value) {
+#if GE_VERTEX_PACKING_F16C
+	return _mm_cvtps_ph(value, _MM_FROUND_TO_NEAREST_INT);
+#else
+	// 舍入到最近偶数，结果与 F16C 一致
+	const __m128i signMask      = _mm_set1_epi32(static_cast<int>(0x80000000u));
+	const __m128i f16Max        = _mm_set1_epi32((127 + 16) << 23);          // 不小于它的值舍入为 Inf
+	const __m128i nanBit        = _mm_set1_epi32(0x200);
+	const __m128i infinity16    = _mm_set1_epi32(0x7C00);
+	const __m128i minNormal     = _mm_set1_epi32((127 - 14) << 23);          // 能得到规格化半精度数的最小值
+	const __m128i subnormMagic  = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+	const __m128i normalBias    = _mm_set1_epi32(0xFFF - ((127 - 15) << 23)); // 调整指数并加上舍入量
+
+	const __m128 sign = _mm_and_ps(_mm_castsi128_ps(signMask), value);
+	const __m128 absValue = _mm_xor_ps(value, sign);
+	const __m128i absBits = _mm_castps_si128(absValue);
+	const __m128i isNaN = _mm_castps_si128(_mm_cmpunord_ps(absValue, absValue));
+	const __m128i isRegular = _mm_cmpgt_epi32(f16Max, absBits);
+	const __m128i special = _mm_or_si128(_mm_and_si128(isNaN, nanBit), infinity16);
+
+	// 结果为非规格化数：借助浮点加法完成对齐与舍入
+	const __m128i isSubnormal = _mm_cmpgt_epi32(minNormal, absBits);
+	const __m128 subnormalSum = _mm_add_ps(absValue, _mm_castsi128_ps(subnormMagic));
+	const __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(subnormalSum), subnormMagic);
+
+	// 结果为规格化数：尾数最低位为奇数时多加 1，实现舍入到偶数
+	const __m128i mantissaOdd = _mm_srai_epi32(_mm_slli_epi32(absBits, 31 - 13), 31);
+	const __m128i rounded = _mm_sub_epi32(_mm_add_epi32(absBits, normalBias), mantissaOdd);
+	const __m128i normal = _mm_srli_epi32(rounded, 13);
+
+	const __m128i finite = _mm_or_si128(_mm_and_si128(isSubnormal, subnormal), _mm_andnot_si128(isSubnormal, normal));
+	const __m128i joined = _mm_or_si128(_mm_and_si128(isRegular, finite), _mm_andnot_si128(isRegular, special));
+	const __m128i result = _mm_or_si128(joined, _mm_srli_epi32(_mm_castps_si128(sign), 16));
+	return PackLow16(result);
+#endif
+}
+
+static inline __m128 HalfToFloat4(__m128i value) {
+#if GE_VERTEX_PACKING_F16C
+	return _mm_cvtph_ps(value);
+#else
+	const __m128i noSignMask = _mm_set1_epi32(0x7FFF);
+	const __m128 magic = _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23));
+	const __m128i maxFinite = _mm_set1_epi32(0x7BFF);
+	const __m128 infNaNExponent = _mm_castsi128_ps(_mm_set1_epi32(255 << 23));
+
+	const __m128i bits = _mm_unpacklo_epi16(value, _mm_setzero_si128());
+	const __m128i exponentMantissa = _mm_and_si128(bits, noSignMask);
+	const __m128i sign = _mm_slli_epi32(_mm_xor_si128(bits, exponentMantissa), 16);
+	// 移位到 float 的位置后乘以 2^112 修正指数偏移，非规格化数也随之规格化
+	const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exponentMantissa, 13)), magic);
+	const __m128i wasInfNaN = _mm_cmpgt_epi32(exponentMantissa, maxFinite);
+	const __m128 infNaN = _mm_and_ps(_mm_castsi128_ps(wasInfNaN), infNaNExponent);
+	return _mm_or_ps(scaled, _mm_or_ps(_mm_castsi128_ps(sign), infNaN));
+#endif
+}
+
+uint16_t FloatToHalf(float value) {
+	return static_cast<uint16_t>(_mm_cvtsi128_si32(FloatToHalf4(_mm_set1_ps(value))) & 0xFFFF);
+}
+
+float HalfToFloat(uint16_t value) {
+	return _mm_cvtss_f32(HalfToFloat4(_mm_cvtsi32_si128(value)));
+}
+
+void PackHalf(const float* src, uint16_t* dst, size_t count) {
+	for (size_t i = 0; i < count; i += 4) {
+		const size_t n = std::min<size_t>(4, count - i);
+		StoreShort4(dst + i, FloatToHalf4(LoadFloat4(src + i, n)), n);
+	}
+}
+
+void UnpackHalf(const uint16_t* src, float* dst, size_t count) {
+	for (size_t i = 0; i < count; i += 4) {
+		const size_t n = std::min<size_t>(4, count - i);
+		StoreFloat4(dst + i, HalfToFloat4(LoadShort4(src + i, n)), n);
+	}
+}
+
+// ==================== 归一化整数 ====================
+// 与 GL 4.2+ 的定义一致：unorm = c / (2^b - 1)，snorm = max(c / (2^(b-1) - 1), -1)
+// _mm_cvtps_epi32 使用默认的舍入到最近偶数
+
+void PackUnorm8(const float* src, uint8_t* dst, size_t count) {
+	const __m128 scale = _mm_set1_ps(255.0f);
+	for (size_t i = 0; i < count; i += 4) {
+		const size_t n = std::min<size_t>(4, count - i);
+		__m128i value = _mm_cvtps_epi32(_mm_mul_ps(Clamp(LoadFloat4(src + i, n), 0.0f, 1.0f), scale));
+		value = _mm_packs_epi32(value, value);
+		StoreByte4(dst + i, _mm_packus_epi16(value, value), n);
+	}
+}
+
+void UnpackUnorm8(const uint8_t* src, float* dst, size_t count) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128 scale = _mm_set1_ps(1.0f / 255.0f);
+	for (size_t i = 0; i < count; i += 4) {
+		const size_t n = std::min<size_t>(4, count - i);
+		const __m128i value = _mm_unpacklo_epi16(_mm_unpacklo_epi8(LoadByte4(src + i, n), zero), zero);
+		StoreFloat4(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(value), scale), n);
+	}
+}
+
+void PackSnorm8(const float* src, int8_t* dst, size_t count) {
+	const __m128 scale = _mm_set1_ps(127.0f);
+	for (size_t i = 0; i < count; i += 4) {
+		const size_t n = std::min<size_t>(4, count - i);
+		__m128i value = _mm_cvtps_epi32(_mm_mul_ps(Clamp(LoadFloat4(src + i, n), -1.0f, 1.0f), scale));
+		value = _mm_packs_epi32(value, value);
+		StoreByte4(dst + i, _mm_packs_epi16(value, value), n);
+	}
+}
+
+void UnpackSnorm8(const int8_t* src, float* dst, size_t count) {
+	const __m128 scale = _mm_set1_ps(1.0f / 127.0f);
+	const __m128 minusOne = _mm_set1_ps(-1.0f);
+	for (size_t i = 0; i < count; i += 4) {
+		const size_t n = std::min<size_t>(4, count - i);
+		const __m128i bytes = LoadByte4(src + i, n);
+		// 把字节放到高位再算术右移完成符号扩展
+		const __m128i shorts = _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+		const __m128i ints = _mm_srai_epi32(_mm_unpacklo_epi16(shorts, shorts), 16);
+		StoreFloat4(dst + i, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(ints), scale), minusOne), n);
+	}
+}
+
+void PackUnorm16(const float* src, uint16_t* dst, size_t count) {
+	const __m128 scale = _mm_set1_ps(65535.0f);
+	const __m128i bias = _mm_set1_epi32(32768);
+	const __m128i flip = _mm_set1_epi16(static_cast<short>(0x8000));
+	for (size_t i = 0; i < count; i += 4) {
+		const size_t n = std::min<size_t>(4, count - i);
+		__m128i value = _mm_cvtps_epi32(_mm_mul_ps(Clamp(LoadFloat4(src + i, n), 0.0f, 1.0f), scale));
+		// SSE2 没有无符号 32→16 的饱和打包，平移到有符号范围后打包再翻转最高位
+		value = _mm_packs_epi32(_mm_sub_epi32(value, bias), _mm_setzero_si128());
+		StoreShort4(dst + i, _mm_xor_si128(value, flip), n);
+	}
+}
+
+void UnpackUnorm16(const uint16_t* src, float* dst, size_t count) {
+	const __m128 scale = _mm_set1_ps(1.0f / 65535.0f);
+	for (size_t i = 0; i < count; i += 4) {
+		const size_t n = std::min<size_t>(4, count - i);
+		const __m128i value = _mm_unpacklo_epi16(LoadShort4(src + i, n), _mm_setzero_si128());
+		StoreFloat4(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(value), scale), n);
+	}
+}
+
+void PackSnorm16(const float* src, int16_t* dst, size_t count) {
+	const __m128 scale = _mm_set1_ps(32767.0f);
+	for (size_t i = 0; i < count; i += 4) {
+		const size_t n = std::min<size_t>(4, count - i);
+		const __m128i value = _mm_cvtps_epi32(_mm_mul_ps(Clamp(LoadFloat4(src + i, n), -1.0f, 1.0f), scale));
+		StoreShort4(dst + i, _mm_packs_epi32(value, value), n);
+	}
+}
+
+void UnpackSnorm16(const int16_t* src, float* dst, size_t count) {
+	const __m128 scale = _mm_set1_ps(1.0f / 32767.0f);
+	const __m128 minusOne = _mm_set1_ps(-1.0f);
+	for (size_t i = 0; i < count; i += 4) {
+		const size_t n = std::min<size_t>(4, count - i);
+		const __m128i shorts = LoadShort4(src + i, n);
+		const __m128i ints = _mm_srai_epi32(_mm_unpacklo_epi16(shorts, shorts), 16);
+		StoreFloat4(dst + i, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(ints), scale), minusOne), n);
+	}
+}
+
+// ==================== 10-10-10-2 ====================
+// 一次处理 4 个向量：转置成 SoA 后每个寄存器只含一种分量，位移量就都是常数
+
+void PackSnorm1010102(const float* src, uint32_t* dst, size_t vectorCount) {
+	const __m128 scaleXYZ = _mm_set1_ps(511.0f);
+	const __m128i mask10 = _mm_set1_epi32(0x3FF);
+	for (size_t i = 0; i < vectorCount; i += 4) {
+		const size_t n = std::min<size_t>(4, vectorCount - i);
+		__m128 rows[4] = {};
+		for (size_t row = 0; row < n; ++row) {
+			rows[row] = _mm_loadu_ps(src + (i + row) * 4);
+		}
+		_MM_TRANSPOSE4_PS(rows[0], rows[1], rows[2], rows[3]);
+		const __m128i x = _mm_cvtps_epi32(_mm_mul_ps(Clamp(rows[0], -1.0f, 1.0f), scaleXYZ));
+		const __m128i y = _mm_cvtps_epi32(_mm_mul_ps(Clamp(rows[1], -1.0f, 1.0f), scaleXYZ));
+		const __m128i z = _mm_cvtps_epi32(_mm_mul_ps(Clamp(rows[2], -1.0f, 1.0f), scaleXYZ));
+		const __m128i w = _mm_cvtps_epi32(Clamp(rows[3], -1.0f, 1.0f));
+		__m128i packed = _mm_and_si128(x, mask10);
+		packed = _mm_or_si128(packed, _mm_slli_epi32(_mm_and_si128(y, mask10), 10));
+		packed = _mm_or_si128(packed, _mm_slli_epi32(_mm_and_si128(z, mask10), 20));
+		packed = _mm_or_si128(packed, _mm_slli_epi32(w, 30));
+		StoreInt4(dst + i, packed, n);
+	}
+}
+
+void UnpackSnorm1010102(const uint32_t* src, float* dst, size_t vectorCount) {
+	const __m128 scaleXYZ = _mm_set1_ps(1.0f / 511.0f);
+	const __m128 minusOne = _mm_set1_ps(-1.0f);
+	for (size_t i = 0; i < vectorCount; i += 4) {
+		const size_t n = std::min<size_t>(4, vectorCount - i);
+		const __m128i packed = LoadInt4(src + i, n);
+		// 先左移把字段推到最高位，再算术右移完成符号扩展
+		const __m128i x = _mm_srai_epi32(_mm_slli_epi32(packed, 22), 22);
+		const __m128i y = _mm_srai_epi32(_mm_slli_epi32(packed, 12), 22);
+		const __m128i z = _mm_srai_epi32(_mm_slli_epi32(packed, 2), 22);
+		const __m128i w = _mm_srai_epi32(packed, 30);
+		__m128 rows[4] = {
+			_mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(x), scaleXYZ), minusOne),
+			_mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(y), scaleXYZ), minusOne),
+			_mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(z), scaleXYZ), minusOne),
+			_mm_max_ps(_mm_cvtepi32_ps(w), minusOne)
+		};
+		_MM_TRANSPOSE4_PS(rows[0], rows[1], rows[2], rows[3]);
+		for (size_t row = 0; row < n; ++row) {
+			_mm_storeu_ps(dst + (i + row) * 4, rows[row]);
+		}
+	}
+}
+
+uint32_t PackSnorm1010102(float x, float y, float z, float w) {
+	const float value[4] = { x, y, z, w };
+	uint32_t packed = 0;
+	PackSnorm1010102(value, &packed, 1);
+	return packed;
+}
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+
+// ---------------------------------------------------------------------
+// 文件: VertexPacking.h
+// 作用: 紧凑顶点格式的打包 / 解包工具
+// 描述: 把网格导入时的 32 位浮点数据转换为 ShaderDataType 中的紧凑格式
+//       (Half*, *Norm, Int2_10_10_10_Rev)，以及反向转换。
+//       批量接口使用 SSE2 一次处理 4 个值（编译器开启 F16C/AVX2 时半精度转换使用硬件指令），
+//       单值接口与批量接口的结果逐位一致。
+// ---------------------------------------------------------------------
+
+namespace GE {
+
+// ==================== 紧凑格式的存储类型 ====================
+// 可直接作为顶点结构体的成员，MakeLayout (VertexLayout.h) 会把它们映射到对应的 ShaderDataType
+
+struct PackedHalf2 { uint16_t X = 0, Y = 0; };                        // Half2
+struct PackedHalf4 { uint16_t X = 0, Y = 0, Z = 0, W = 0; };          // Half4
+struct PackedUByte4 { uint8_t X = 0, Y = 0, Z = 0, W = 0; };          // UByte4，着色器中为 uvec4
+struct PackedUByte4Norm { uint8_t R = 0, G = 0, B = 0, A = 0; };      // UByte4Norm，例如顶点颜色
+struct PackedByte4Norm { int8_t X = 0, Y = 0, Z = 0, W = 0; };        // Byte4Norm
+struct PackedUShort2Norm { uint16_t X = 0, Y = 0; };                  // UShort2Norm，例如 [0, 1] 内的 UV
+struct PackedShort2Norm { int16_t X = 0, Y = 0; };                    // Short2Norm
+struct PackedShort4Norm { int16_t X = 0, Y = 0, Z = 0, W = 0; };      // Short4Norm
+struct PackedSnorm1010102 { uint32_t Bits = 0; };                     // 归一化的 Int2_10_10_10_Rev，例如法线、切线
+
+// ==================== 单值转换 ====================
+/**
+ * @brief float 转 16 位半精度浮点
+ *
+ * 超出半精度范围的值变为 ±Inf，NaN 保持为 NaN，过小的值转换为非规格化数。
+ */
+uint16_t FloatToHalf(float value);
+
+/**
+ * @brief 16 位半精度浮点转 float
+ */
+float HalfToFloat(uint16_t value);
+
+/**
+ * @brief 将 [-1, 1] 范围内的 4 个分量打包为 GL_INT_2_10_10_10_REV 格式
+ *
+ * x/y/z 各占 10 位，w 占 2 位（w 通常为切线的手性符号 ±1）。输入会先被截断到 [-1, 1]。
+ */
+uint32_t PackSnorm1010102(float x, float y, float z, float w);
+
+// ==================== 批量转换 ====================
+/**
+ * @brief 批量 float → 半精度浮点
+ *
+ * @param src 源数据，count 个 float
+ * @param dst 目标数据，count 个 uint16_t
+ * @param count 分量个数（不要求是 4 的倍数）
+ */
+void PackHalf(const float* src, uint16_t* dst, size_t count);
+void UnpackHalf(const uint16_t* src, float* dst, size_t count);
+
+/**
+ * @brief 批量 [0, 1] float → 8 位无符号归一化整数 (UByte4Norm，例如顶点颜色)
+ */
+void PackUnorm8(const float* src, uint8_t* dst, size_t count);
+void UnpackUnorm8(const uint8_t* src, float* dst, size_t count);
+
+/**
+ * @brief 批量 [-1, 1] float → 8 位有符号归一化整数 (Byte4Norm)
+ */
+void PackSnorm8(const float* src, int8_t* dst, size_t count);
+void UnpackSnorm8(const int8_t* src, float* dst, size_t count);
+
+/**
+ * @brief 批量 [0, 1] float → 16 位无符号归一化整数 (UShort2Norm，例如 UV)
+ */
+void PackUnorm16(const float* src, uint16_t* dst, size_t count);
+void UnpackUnorm16(const uint16_t* src, float* dst, size_t count);
+
+/**
+ * @brief 批量 [-1, 1] float → 16 位有符号归一化整数 (Short2Norm / Short4Norm)
+ */
+void PackSnorm16(const float* src, int16_t* dst, size_t count);
+void UnpackSnorm16(const int16_t* src, float* dst, size_t count);
+
+/**
+ * @brief 批量打包法线 / 切线为 Int2_10_10_10_Rev
+ *
+ * @param src 源数据，每个向量 4 个 float (x, y, z, w)，共 vectorCount * 4 个
+ * @param dst 目标数据，vectorCount 个 uint32_t
+ * @param vectorCount 向量个数
+ */
+void PackSnorm1010102(const float* src, uint32_t* dst, size_t vectorCount);
+void UnpackSnorm1010102(const uint32_t* src, float* dst, size_t vectorCount);
+}
@@ -0,0 +1,72 @@
+#include "TestUtils.h"
+#include "core/Log.h"
+#include "engine_services/core/Application.h"
+#include "engine_services/core/Layer.h"
+#include "engine_services/platform/headless/OpenGLHeadlessContext.h"
+#include <glad/glad.h>
+#include <cstdlib>
+
+using namespace GE;
+
+// 渲染一帧后关闭应用
+class SmokeTestLayer : public Layer {
+public:
+	SmokeTestLayer() : Layer("SmokeTestLayer") {}
+
+	virtual void OnUpdate(Timestep) override { m_Updates++; }
+	virtual void OnRender() override {
+		m_Renders++;
+		Application::Get().Close();
+	}
+
+	uint32_t m_Updates = 0;
+	uint32_t m_Renders = 0;
+};
+
+static SmokeTestLayer* s_Layer = nullptr;
+
+class SmokeTestApp : public Application {
+public:
+	SmokeTestApp() : Application(WindowProps("Headless Smoke Test", 64, 32, true)) {
+		auto layer = CreateScope<SmokeTestLayer>();
+		s_Layer = layer.get();
+		PushLayer(std::move(layer));
+	}
+};
+
+Ref<Application> GE::CreateApplication() {
+	static Ref<Application> instance = nullptr;
+	if (!instance) {
+		Application::s_allowConstruction = true;
+		instance = CreateRef<SmokeTestApp>();
+		Application::s_allowConstruction = false;
+		Application::SetInstance(instance);
+	}
+	return instance;
+}
+
+int main() {
+	Log::Init();
+	Ref<Application> app = CreateApplication();
+	app->Run();
+
+	EXPECT(s_Layer->m_Updates == 1);
+	EXPECT(s_Layer->m_Renders == 1);
+	EXPECT(glGetError() == GL_NO_ERROR);
+	// pbuffer 表面保留了 Renderer::BeginScene 的清屏颜色 (0.2, 0.3, 0.3)
+	const auto* context = static_cast<const OpenGLHeadlessContext*>(app->GetWindow().GetContext());
+	EXPECT(context->IsValid());
+	if (context->HasDefaultFramebuffer()) {
+		uint8_t pixel[4] = {};
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+		glReadPixels(32, 16, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+		// 0.3 * 255 = 76.5，取整方式由实现决定
+		const uint8_t expected[4] = { 51, 77, 77, 255 };
+		for (uint32_t i = 0; i < 4; ++i) {
+			EXPECT(std::abs(pixel[i] - expected[i]) <= 1);
+		}
+	}
+
+	app->Shutdown();
+	return GE::Test::TestResult();
+}
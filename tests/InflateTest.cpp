@@ -0,0 +1,76 @@
+#include "TestUtils.h"
+#include "core/Inflate.h"
+#include <vector>
+
+using namespace GE;
+
+// 追加一个存储块：块头（BFINAL + BTYPE=00）单独占一个字节，之后是 LEN / NLEN 与原始数据
+static void AppendStoredBlock(std::vector<uint8_t>& stream, const std::vector<uint8_t>& data, bool final) {
+	stream.push_back(final ? 0x01 : 0x00);
+	const uint16_t length = static_cast<uint16_t>(data.size());
+	stream.push_back(static_cast<uint8_t>(length & 0xFF));
+	stream.push_back(static_cast<uint8_t>(length >> 8));
+	stream.push_back(static_cast<uint8_t>(~length & 0xFF));
+	stream.push_back(static_cast<uint8_t>((~length >> 8) & 0xFF));
+	stream.insert(stream.end(), data.begin(), data.end());
+}
+
+static std::vector<uint8_t> MakeData(size_t size, uint8_t seed) {
+	std::vector<uint8_t> data(size);
+	for (size_t i = 0; i < size; ++i) {
+		data[i] = static_cast<uint8_t>(seed + i * 7);
+	}
+	return data;
+}
+
+static bool Decompress(const std::vector<uint8_t>& stream, std::vector<uint8_t>& output, size_t capacity) {
+	output.assign(capacity, 0);
+	size_t outSize = 0;
+	const bool result = Inflate::DecompressDeflate(stream.data(), stream.size(), output.data(), output.size(), outSize);
+	output.resize(outSize);
+	return result;
+}
+
+// 多个存储块：跳过存储数据后位缓冲中预读的旧数据不能被当作下一个块头
+static void TestMultipleStoredBlocks() {
+	const std::vector<uint8_t> blocks[] = { MakeData(100, 1), MakeData(3, 50), MakeData(257, 9) };
+	std::vector<uint8_t> stream;
+	std::vector<uint8_t> expected;
+	for (size_t i = 0; i < std::size(blocks); ++i) {
+		AppendStoredBlock(stream, blocks[i], i + 1 == std::size(blocks));
+		expected.insert(expected.end(), blocks[i].begin(), blocks[i].end());
+	}
+	std::vector<uint8_t> output;
+	EXPECT(Decompress(stream, output, expected.size()));
+	EXPECT(output == expected);
+}
+
+// 存储块之后接一个只含块结束符的固定 Huffman 块（BFINAL=1, BTYPE=01, 码字 0000000）
+static void TestStoredThenFixedBlock() {
+	const std::vector<uint8_t> data = MakeData(40, 3);
+	std::vector<uint8_t> stream;
+	AppendStoredBlock(stream, data, false);
+	stream.push_back(0x03);
+	stream.push_back(0x00);
+	std::vector<uint8_t> output;
+	EXPECT(Decompress(stream, output, data.size()));
+	EXPECT(output == data);
+}
+
+// 空的存储块与输出空间不足
+static void TestStoredBlockEdgeCases() {
+	std::vector<uint8_t> stream;
+	AppendStoredBlock(stream, {}, false);
+	AppendStoredBlock(stream, MakeData(16, 5), true);
+	std::vector<uint8_t> output;
+	EXPECT(Decompress(stream, output, 16));
+	EXPECT(output == MakeData(16, 5));
+	EXPECT(!Decompress(stream, output, 15));
+}
+
+int main() {
+	TestMultipleStoredBlocks();
+	TestStoredThenFixedBlock();
+	TestStoredBlockEdgeCases();
+	return GE::Test::TestResult();
+}
@@ -0,0 +1,108 @@
+#include "TestUtils.h"
+#include "core/Log.h"
+#include "engine_services/platform/null/NullCommandLog.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+using namespace GE;
+
+// 录制两帧：带 payload 的资源创建、多段拼接的 uniform、未保存内容的缓冲更新与绘制
+static void RecordFrames(NullCommandLog& log) {
+	const float vertices[6] = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+	log.Record(NullCommand(NullCommandType::CreateBuffer, 1, { sizeof(vertices) }, static_cast<uint8_t>(NullBufferKind::Vertex)),
+		vertices, sizeof(vertices), true);
+	log.Record(NullCommand(NullCommandType::CreateVertexArray, 2));
+	log.Record(NullCommand(NullCommandType::AddVertexBuffer, 2, { 1 }));
+	const char name[] = "u_Color";
+	const float color[4] = { 0.25f, 0.5f, 0.75f, 1.0f };
+	log.Record(NullCommand(NullCommandType::SetUniform, 3, { sizeof(name) - 1, 1 }, static_cast<uint8_t>(NullUniformType::Float4)),
+		{ { name, static_cast<uint32_t>(sizeof(name) - 1) }, { color, static_cast<uint32_t>(sizeof(color)) } });
+	log.Record(NullCommand(NullCommandType::DrawArrays, 2, { 3, 0 }));
+	log.Record(NullCommand(NullCommandType::EndFrame));
+
+	log.SetCapturePayloads(false);
+	log.Record(NullCommand(NullCommandType::SetBufferData, 1, { 0 }), vertices, sizeof(vertices), true);
+	log.SetCapturePayloads(true);
+	log.Record(NullCommand(NullCommandType::PushDebugGroup), "Scene", 5);
+	log.Record(NullCommand(NullCommandType::DrawIndexedBaseVertex, 2, { 6, 3, static_cast<uint32_t>(-2) }));
+	log.Record(NullCommand(NullCommandType::PopDebugGroup));
+	log.Record(NullCommand(NullCommandType::EndFrame));
+	log.Record(NullCommand(NullCommandType::Destroy, 1));
+}
+
+static void ExpectEqual(const NullCommandLog& expected, const NullCommandLog& actual) {
+	EXPECT(actual.GetCommandCount() == expected.GetCommandCount());
+	EXPECT(actual.GetFrameCount() == expected.GetFrameCount());
+	EXPECT(actual.GetStoredBytes() == expected.GetStoredBytes());
+	EXPECT(actual.GetTotalBytes() == expected.GetTotalBytes());
+	if (actual.GetCommandCount() != expected.GetCommandCount()) {
+		return;
+	}
+	for (uint32_t i = 0; i < expected.GetCommandCount(); ++i) {
+		const NullCommand& a = expected.GetCommands()[i];
+		const NullCommand& b = actual.GetCommands()[i];
+		EXPECT(std::memcmp(&a, &b, sizeof(NullCommand)) == 0);
+		EXPECT(a.HasPayload() == b.HasPayload());
+		if (a.HasPayload() && b.HasPayload()) {
+			EXPECT(std::memcmp(expected.GetPayload(a), actual.GetPayload(b), a.PayloadSize) == 0);
+		}
+	}
+	for (uint32_t type = 0; type < NullCommandLog::TypeCount; ++type) {
+		EXPECT(actual.GetCount(static_cast<NullCommandType>(type)) == expected.GetCount(static_cast<NullCommandType>(type)));
+		EXPECT(actual.GetBytes(static_cast<NullCommandType>(type)) == expected.GetBytes(static_cast<NullCommandType>(type)));
+	}
+	for (uint32_t frame = 0; frame < expected.GetFrameCount(); ++frame) {
+		uint32_t expectedBegin = 0, expectedEnd = 0, actualBegin = 0, actualEnd = 0;
+		expected.GetFrameRange(frame, expectedBegin, expectedEnd);
+		actual.GetFrameRange(frame, actualBegin, actualEnd);
+		EXPECT(actualBegin == expectedBegin && actualEnd == expectedEnd);
+	}
+}
+
+static void TestSaveLoadRoundTrip(const std::filesystem::path& path) {
+	NullCommandLog recorded;
+	RecordFrames(recorded);
+	EXPECT(recorded.GetFrameCount() == 2);
+	EXPECT(recorded.GetCount(NullCommandType::EndFrame) == 2);
+	// 未保存内容的 SetBufferData 仍计入字节数
+	EXPECT(recorded.GetBytes(NullCommandType::SetBufferData) == 6 * sizeof(float));
+	EXPECT(!recorded.GetCommands()[6].HasPayload());
+	EXPECT(recorded.GetString(recorded.GetCommands()[3], 0, 7) == "u_Color");
+
+	EXPECT(recorded.Save(path));
+	NullCommandLog loaded;
+	EXPECT(loaded.Load(path));
+	ExpectEqual(recorded, loaded);
+	EXPECT(loaded.GetString(loaded.GetCommands()[7], 0, 5) == "Scene");
+}
+
+// 截断或损坏的文件被拒绝，已加载的内容被清空
+static void TestRejectsCorruptFile(const std::filesystem::path& path) {
+	NullCommandLog recorded;
+	RecordFrames(recorded);
+	EXPECT(recorded.Save(path));
+	std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+	NullCommandLog loaded;
+	EXPECT(!loaded.Load(path));
+	EXPECT(loaded.GetCommandCount() == 0);
+
+	EXPECT(recorded.Save(path));
+	{
+		// 把第一条命令的类型改为越界值
+		std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+		file.seekp(24);
+		file.put(static_cast<char>(0xFF));
+	}
+	EXPECT(!loaded.Load(path));
+	EXPECT(loaded.GetCommandCount() == 0);
+}
+
+int main() {
+	Log::Init();
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / "NullCommandLogTest.bin";
+	TestSaveLoadRoundTrip(path);
+	TestRejectsCorruptFile(path);
+	std::filesystem::remove(path);
+	return GE::Test::TestResult();
+}
@@ -0,0 +1,173 @@
+#include "TestUtils.h"
+#include "core/OffsetAllocator.h"
+#include "core/Log.h"
+#include <algorithm>
+#include <vector>
+
+using namespace GE;
+
+// 空间完全空闲：总空闲量等于容量，且可以一次分配整个空间
+static bool IsEntirelyFree(OffsetAllocator& allocator) {
+	const OffsetAllocator::StorageReport report = allocator.GetStorageReport();
+	if (report.TotalFreeSpace != allocator.GetSize()) {
+		return false;
+	}
+	OffsetAllocator::Allocation all = allocator.Allocate(allocator.GetSize());
+	const bool whole = all.IsValid() && all.Offset == 0;
+	allocator.Free(all);
+	return whole;
+}
+
+static void TestAllocateAndFree() {
+	OffsetAllocator allocator(1024);
+	OffsetAllocator::Allocation a = allocator.Allocate(100);
+	OffsetAllocator::Allocation b = allocator.Allocate(200);
+	EXPECT(a.IsValid() && b.IsValid());
+	EXPECT(a.Offset == 0);
+	EXPECT(b.Offset == 100);
+	EXPECT(allocator.GetAllocationSize(a) == 100);
+	EXPECT(allocator.GetAllocationSize(b) == 200);
+	EXPECT(allocator.GetStorageReport().TotalFreeSpace == 724);
+
+	allocator.Free(a);
+	allocator.Free(b);
+	EXPECT(IsEntirelyFree(allocator));
+
+	// 无效的分配：大小为 0，释放无效分配不做任何事
+	EXPECT(!allocator.Allocate(0).IsValid());
+	allocator.Free(OffsetAllocator::Allocation{});
+	EXPECT(allocator.GetAllocationSize(OffsetAllocator::Allocation{}) == 0);
+	EXPECT(IsEntirelyFree(allocator));
+}
+
+// 释放时与前后相邻的空闲块合并，按任意顺序释放最终都恢复为一整块
+static void TestNeighborMerging() {
+	const uint32_t orders[][3] = { { 0, 1, 2 }, { 2, 1, 0 }, { 0, 2, 1 }, { 1, 0, 2 }, { 1, 2, 0 }, { 2, 0, 1 } };
+	for (const auto& order : orders) {
+		OffsetAllocator allocator(1024);
+		OffsetAllocator::Allocation blocks[4];
+		for (uint32_t i = 0; i < 4; ++i) {
+			blocks[i] = allocator.Allocate(256);
+			EXPECT(blocks[i].Offset == i * 256);
+		}
+		// 最后一块一直占用，前三块的合并不依赖末尾的空闲空间
+		for (uint32_t index : order) {
+			allocator.Free(blocks[index]);
+		}
+		const OffsetAllocator::StorageReport report = allocator.GetStorageReport();
+		EXPECT(report.TotalFreeSpace == 768);
+		EXPECT(report.LargestFreeRegion == 768);
+		OffsetAllocator::Allocation merged = allocator.Allocate(768);
+		EXPECT(merged.IsValid() && merged.Offset == 0);
+		allocator.Free(merged);
+		allocator.Free(blocks[3]);
+		EXPECT(IsEntirelyFree(allocator));
+	}
+}
+
+// 间隔释放后空闲总量足够，但没有足够大的连续区间
+static void TestFragmentation() {
+	OffsetAllocator allocator(1024);
+	std::vector<OffsetAllocator::Allocation> blocks;
+	for (uint32_t i = 0; i < 16; ++i) {
+		blocks.push_back(allocator.Allocate(64));
+	}
+	EXPECT(allocator.GetStorageReport().TotalFreeSpace == 0);
+	for (uint32_t i = 0; i < 16; i += 2) {
+		allocator.Free(blocks[i]);
+	}
+	OffsetAllocator::StorageReport report = allocator.GetStorageReport();
+	EXPECT(report.TotalFreeSpace == 512);
+	EXPECT(report.LargestFreeRegion == 64);
+	EXPECT(!allocator.Allocate(128).IsValid());
+
+	// 空洞可以被同样大小的分配复用
+	OffsetAllocator::Allocation reused = allocator.Allocate(64);
+	EXPECT(reused.IsValid() && reused.Offset % 128 == 0);
+	allocator.Free(reused);
+
+	// 释放其余的块后空洞两两合并
+	for (uint32_t i = 1; i < 16; i += 2) {
+		allocator.Free(blocks[i]);
+	}
+	EXPECT(IsEntirelyFree(allocator));
+}
+
+static void TestOutOfSpace() {
+	OffsetAllocator allocator(1024);
+	EXPECT(!allocator.Allocate(1025).IsValid());
+	OffsetAllocator::Allocation all = allocator.Allocate(1024);
+	EXPECT(all.IsValid());
+	EXPECT(!allocator.Allocate(1).IsValid());
+	const OffsetAllocator::StorageReport report = allocator.GetStorageReport();
+	EXPECT(report.TotalFreeSpace == 0 && report.LargestFreeRegion == 0);
+	allocator.Free(all);
+	EXPECT(allocator.Allocate(1).IsValid());
+
+	// 节点耗尽：每次拆分都需要一个节点保存剩余空间
+	OffsetAllocator limited(1024, 4);
+	uint32_t allocations = 0;
+	while (limited.Allocate(1).IsValid()) {
+		allocations++;
+	}
+	EXPECT(allocations == 3);
+
+	// Reset 释放全部分配
+	limited.Reset();
+	EXPECT(IsEntirelyFree(limited));
+}
+
+// 随机分配与释放：活跃区间互不重叠且都在空间内，全部释放后恢复为一整块
+static void TestRandomStress() {
+	OffsetAllocator allocator(1 << 16);
+	std::vector<OffsetAllocator::Allocation> live;
+	uint32_t state = 12345;
+	auto next = [&state]() {
+		state = state * 1664525u + 1013904223u;
+		return state >> 8;
+	};
+	for (uint32_t step = 0; step < 4000; ++step) {
+		if (live.empty() || next() % 3 != 0) {
+			OffsetAllocator::Allocation allocation = allocator.Allocate(1 + next() % 1000);
+			if (allocation.IsValid()) {
+				live.push_back(allocation);
+			}
+		} else {
+			const size_t index = next() % live.size();
+			allocator.Free(live[index]);
+			live[index] = live.back();
+			live.pop_back();
+		}
+	}
+
+	std::vector<std::pair<uint32_t, uint32_t>> ranges;
+	uint32_t used = 0;
+	for (const OffsetAllocator::Allocation& allocation : live) {
+		const uint32_t size = allocator.GetAllocationSize(allocation);
+		ranges.emplace_back(allocation.Offset, allocation.Offset + size);
+		used += size;
+	}
+	std::sort(ranges.begin(), ranges.end());
+	for (size_t i = 0; i < ranges.size(); ++i) {
+		EXPECT(ranges[i].second <= allocator.GetSize());
+		if (i > 0) {
+			EXPECT(ranges[i - 1].second <= ranges[i].first);
+		}
+	}
+	EXPECT(allocator.GetStorageReport().TotalFreeSpace + used == allocator.GetSize());
+
+	for (const OffsetAllocator::Allocation& allocation : live) {
+		allocator.Free(allocation);
+	}
+	EXPECT(IsEntirelyFree(allocator));
+}
+
+int main() {
+	Log::Init();
+	TestAllocateAndFree();
+	TestNeighborMerging();
+	TestFragmentation();
+	TestOutOfSpace();
+	TestRandomStress();
+	return GE::Test::TestResult();
+}
@@ -0,0 +1,166 @@
+#include "TestUtils.h"
+#include "core/RectPacker.h"
+#include <vector>
+
+using namespace GE;
+
+// 逐像素标记已放置的矩形，检查每个矩形都在区域内且互不重叠
+class CoverageGrid {
+public:
+	CoverageGrid(uint32_t width, uint32_t height)
+		: m_Width(width), m_Height(height), m_Cells(static_cast<size_t>(width) * height, false) {}
+
+	bool Add(const RectPacker::Rect& rect) {
+		if (rect.X + rect.Width > m_Width || rect.Y + rect.Height > m_Height) {
+			return false;
+		}
+		for (uint32_t y = rect.Y; y < rect.Y + rect.Height; ++y) {
+			for (uint32_t x = rect.X; x < rect.X + rect.Width; ++x) {
+				const size_t cell = static_cast<size_t>(y) * m_Width + x;
+				if (m_Cells[cell]) {
+					return false;
+				}
+				m_Cells[cell] = true;
+			}
+		}
+		return true;
+	}
+
+	void Resize(uint32_t width, uint32_t height) {
+		std::vector<bool> cells(static_cast<size_t>(width) * height, false);
+		for (uint32_t y = 0; y < m_Height; ++y) {
+			for (uint32_t x = 0; x < m_Width; ++x) {
+				cells[static_cast<size_t>(y) * width + x] = m_Cells[static_cast<size_t>(y) * m_Width + x];
+			}
+		}
+		m_Width = width;
+		m_Height = height;
+		m_Cells = std::move(cells);
+	}
+private:
+	uint32_t m_Width;
+	uint32_t m_Height;
+	std::vector<bool> m_Cells;
+};
+
+static uint32_t NextRandom(uint32_t& state) {
+	state = state * 1664525u + 1013904223u;
+	return state >> 8;
+}
+
+// 随机尺寸逐个放置直到连续放不下：放下的矩形都在区域内且互不重叠，已用面积与之相符
+static void TestPackedRectsDoNotOverlap() {
+	RectPacker packer(256, 256);
+	CoverageGrid grid(256, 256);
+	uint32_t state = 7;
+	uint64_t area = 0;
+	uint32_t packed = 0;
+	for (uint32_t i = 0; i < 2000; ++i) {
+		const uint32_t width = 1 + NextRandom(state) % 40;
+		const uint32_t height = 1 + NextRandom(state) % 40;
+		RectPacker::Rect rect;
+		if (!packer.Pack(width, height, rect)) {
+			continue;
+		}
+		EXPECT(rect.Width == width && rect.Height == height);
+		EXPECT(grid.Add(rect));
+		area += static_cast<uint64_t>(width) * height;
+		packed++;
+	}
+	EXPECT(packed > 50);
+	EXPECT(packer.GetUsedArea() == area);
+	EXPECT(packer.GetOccupancy() > 0.5f && packer.GetOccupancy() <= 1.0f);
+}
+
+static void TestFullBin() {
+	RectPacker packer(128, 128);
+	CoverageGrid grid(128, 128);
+	// 超出区域的矩形总是失败
+	RectPacker::Rect rect;
+	EXPECT(!packer.Pack(129, 1, rect));
+	EXPECT(!packer.Pack(1, 129, rect));
+
+	for (uint32_t i = 0; i < 4; ++i) {
+		EXPECT(packer.Pack(64, 64, rect));
+		EXPECT(grid.Add(rect));
+	}
+	EXPECT(packer.GetOccupancy() == 1.0f);
+	// 区域已满：任何非空矩形都放不下
+	EXPECT(!packer.Pack(1, 1, rect));
+	EXPECT(packer.GetUsedArea() == 128u * 128u);
+
+	// 空矩形不占空间
+	EXPECT(packer.Pack(0, 5, rect));
+	EXPECT(rect.Width == 0 && rect.Height == 0);
+
+	// 空间不足的那一块失败，其余的照常放下
+	RectPacker almostFull(100, 10);
+	EXPECT(almostFull.Pack(60, 10, rect));
+	EXPECT(!almostFull.Pack(41, 1, rect));
+	EXPECT(almostFull.Pack(40, 10, rect) && rect.X == 60);
+	EXPECT(!almostFull.Pack(1, 1, rect));
+}
+
+static void TestPackBatch() {
+	std::vector<RectPacker::BatchEntry> entries;
+	uint32_t state = 99;
+	for (uint32_t i = 0; i < 300; ++i) {
+		RectPacker::BatchEntry entry;
+		entry.Width = 4 + NextRandom(state) % 28;
+		entry.Height = 4 + NextRandom(state) % 28;
+		entries.push_back(entry);
+	}
+	RectPacker packer(256, 256);
+	const uint32_t packedCount = packer.PackBatch(entries);
+
+	CoverageGrid grid(256, 256);
+	uint32_t counted = 0;
+	for (const RectPacker::BatchEntry& entry : entries) {
+		if (!entry.Packed) {
+			continue;
+		}
+		counted++;
+		EXPECT(entry.Result.Width == entry.Width && entry.Result.Height == entry.Height);
+		EXPECT(grid.Add(entry.Result));
+	}
+	EXPECT(counted == packedCount);
+	// 总面积大于区域，一定有放不下的
+	EXPECT(packedCount > 0 && packedCount < entries.size());
+}
+
+// 扩大区域后已放置的矩形不动，新矩形放在新增的空间里
+static void TestGrow() {
+	RectPacker packer(128, 128);
+	CoverageGrid grid(128, 128);
+	RectPacker::Rect rect;
+	EXPECT(packer.Pack(128, 128, rect));
+	EXPECT(grid.Add(rect));
+	EXPECT(!packer.Pack(1, 1, rect));
+
+	packer.Grow(256, 128);
+	grid.Resize(256, 128);
+	EXPECT(packer.Pack(128, 128, rect));
+	EXPECT(rect.X == 128 && rect.Y == 0);
+	EXPECT(grid.Add(rect));
+
+	packer.Grow(256, 200);
+	grid.Resize(256, 200);
+	EXPECT(packer.Pack(256, 72, rect));
+	EXPECT(rect.X == 0 && rect.Y == 128);
+	EXPECT(grid.Add(rect));
+	EXPECT(!packer.Pack(1, 1, rect));
+
+	// 从空区域开始扩大
+	RectPacker empty;
+	EXPECT(!empty.Pack(1, 1, rect));
+	empty.Grow(16, 16);
+	EXPECT(empty.Pack(16, 16, rect) && rect.X == 0 && rect.Y == 0);
+}
+
+int main() {
+	TestPackedRectsDoNotOverlap();
+	TestFullBin();
+	TestPackBatch();
+	TestGrow();
+	return GE::Test::TestResult();
+}
@@ -0,0 +1,145 @@
+#include "TestUtils.h"
+#include "core/JobSystem.h"
+#include "core/Log.h"
+#include "engine_services/platform/software/SoftwareBuffer.h"
+#include "engine_services/platform/software/SoftwareRendererAPI.h"
+#include "engine_services/platform/software/SoftwareShader.h"
+#include "engine_services/platform/software/SoftwareVertexArray.h"
+#include <cmath>
+#include <vector>
+
+using namespace GE;
+
+static constexpr uint32_t s_Size = 64;
+
+// 每个顶点：裁剪空间位置 (x, y, z, w) 与一个 varying
+struct TestVertex {
+	float X, Y, Z, W;
+	float U;
+};
+
+// 窗口坐标转换为 NDC（视口为 s_Size × s_Size）
+static float ToNdc(float window) {
+	return window / (s_Size * 0.5f) - 1.0f;
+}
+
+static Ref<VertexArray> MakeTriangles(std::vector<TestVertex> vertices) {
+	Ref<SoftwareVertexBuffer> buffer = CreateRef<SoftwareVertexBuffer>(reinterpret_cast<float*>(vertices.data()),
+		static_cast<uint32_t>(vertices.size() * sizeof(TestVertex)));
+	buffer->SetLayout({ { ShaderDataType::Float4, "a_Position" }, { ShaderDataType::Float, "a_U" } });
+	Ref<SoftwareVertexArray> vertexArray = CreateRef<SoftwareVertexArray>();
+	vertexArray->AddVertexBuffer(buffer);
+	return vertexArray;
+}
+
+static SoftwareShaderStages MakeStages(bool outputVarying) {
+	SoftwareShaderStages stages;
+	stages.VaryingCount = 1;
+	stages.Vertex = [](const SoftwareShaderConstants&, const SoftwareVertexInput& input, float* varyings) {
+		varyings[0] = input.Attributes[1].x;
+		return input.Attributes[0];
+	};
+	if (outputVarying) {
+		stages.Fragment = [](const SoftwareShaderConstants&, const float* varyings) { return Vec4(varyings[0], 0.0f, 0.0f, 1.0f); };
+	} else {
+		// 半透明白色：覆盖一次为 128，覆盖两次为 192
+		stages.Fragment = [](const SoftwareShaderConstants&, const float*) { return Vec4(1.0f, 1.0f, 1.0f, 0.5f); };
+	}
+	return stages;
+}
+
+static uint32_t Red(const SoftwareFramebuffer& framebuffer, uint32_t x, uint32_t y) {
+	return framebuffer.GetPixel(x, y) & 0xFF;
+}
+
+// 统计覆盖一次的像素；任何像素被覆盖两次都算失败
+static uint32_t CountCoverage(const SoftwareFramebuffer& framebuffer) {
+	uint32_t covered = 0;
+	for (uint32_t y = 0; y < framebuffer.Height; ++y) {
+		for (uint32_t x = 0; x < framebuffer.Width; ++x) {
+			const uint32_t red = Red(framebuffer, x, y);
+			EXPECT(red == 0 || red == 128);
+			covered += red == 128;
+		}
+	}
+	return covered;
+}
+
+// 两个三角形组成的矩形，四条边都落在像素中心上：
+// top-left 规则下每个像素中心恰好属于一个三角形，共享的对角线不重复绘制，也不留缝隙
+static void TestSharedEdge(SoftwareRendererAPI& api, const Ref<Shader>& shader) {
+	const float left = ToNdc(8.5f), right = ToNdc(40.5f), bottom = ToNdc(4.5f), top = ToNdc(52.5f);
+	const Ref<VertexArray> quad = MakeTriangles({
+		{ left, bottom, 0.0f, 1.0f, 0.0f }, { right, bottom, 0.0f, 1.0f, 0.0f }, { right, top, 0.0f, 1.0f, 0.0f },
+		{ left, bottom, 0.0f, 1.0f, 0.0f }, { right, top, 0.0f, 1.0f, 0.0f }, { left, top, 0.0f, 1.0f, 0.0f },
+	});
+	api.Clear();
+	shader->Bind();
+	api.DrawArrays(quad, 6);
+	EXPECT(CountCoverage(api.GetFramebuffer()) == 32 * 48);
+}
+
+// 一个顶点在近平面 (z = -w) 之后：A→C 与 B→C 在 t = 1/3 处被裁剪，
+// 剩下的梯形上边位于 NDC y = -1/6，拆成的两个三角形也不能重复覆盖
+static void TestNearPlaneClip(SoftwareRendererAPI& api, const Ref<Shader>& shader) {
+	const Ref<VertexArray> triangle = MakeTriangles({
+		{ -0.5f, -0.5f, 0.0f, 1.0f, 0.0f }, { 0.5f, -0.5f, 0.0f, 1.0f, 0.0f }, { 0.0f, 0.5f, -3.0f, 1.0f, 0.0f },
+	});
+	api.Clear();
+	shader->Bind();
+	api.DrawArrays(triangle, 3);
+	const SoftwareFramebuffer& framebuffer = api.GetFramebuffer();
+	EXPECT(CountCoverage(framebuffer) > 0);
+	// 窗口 y：下边 16，裁剪后的上边 32 * (1 - 1/6) ≈ 26.67
+	EXPECT(Red(framebuffer, 32, 20) == 128);
+	EXPECT(Red(framebuffer, 32, 26) == 128);
+	EXPECT(Red(framebuffer, 32, 27) == 0);
+	// 未裁剪时会被覆盖的位置
+	EXPECT(Red(framebuffer, 32, 40) == 0);
+	for (uint32_t y = 27; y < s_Size; ++y) {
+		for (uint32_t x = 0; x < s_Size; ++x) {
+			EXPECT(Red(framebuffer, x, y) == 0);
+		}
+	}
+}
+
+// 左侧 w = 1、右侧 w = 3 的全屏矩形，u 从 0 变到 1（位置乘以 w，屏幕上仍覆盖整个视口）。
+// 透视校正插值下屏幕位置 s 处 u = (s / 3) / ((1 - s) + s / 3)，而不是线性的 s
+static void TestPerspectiveCorrectVaryings(SoftwareRendererAPI& api, const Ref<Shader>& shader) {
+	const float w0 = 1.0f, w1 = 3.0f;
+	const Ref<VertexArray> quad = MakeTriangles({
+		{ -w0, -w0, 0.0f, w0, 0.0f }, { w1, -w1, 0.0f, w1, 1.0f }, { w1, w1, 0.0f, w1, 1.0f },
+		{ -w0, -w0, 0.0f, w0, 0.0f }, { w1, w1, 0.0f, w1, 1.0f }, { -w0, w0, 0.0f, w0, 0.0f },
+	});
+	api.Clear();
+	shader->Bind();
+	api.DrawArrays(quad, 6);
+	const SoftwareFramebuffer& framebuffer = api.GetFramebuffer();
+	for (uint32_t x = 0; x < s_Size; x += 7) {
+		const float s = (static_cast<float>(x) + 0.5f) / s_Size;
+		const float u = (s / w1) / ((1.0f - s) / w0 + s / w1);
+		for (uint32_t y : { 1u, 31u, 62u }) {
+			EXPECT(std::abs(static_cast<float>(Red(framebuffer, x, y)) - u * 255.0f) <= 1.0f);
+		}
+	}
+	// 中心处线性插值为 0.5，透视校正为 0.25
+	EXPECT(Red(framebuffer, 32, 32) < 70);
+}
+
+int main() {
+	Log::Init();
+	JobSystem::Init(3);
+	{
+		SoftwareRendererAPI api;
+		api.Init();
+		api.SetViewport(0, 0, s_Size, s_Size);
+		api.SetClearColor(Vec4(0.0f, 0.0f, 0.0f, 1.0f));
+		const Ref<Shader> coverage = CreateRef<SoftwareShader>("Coverage", MakeStages(false));
+		const Ref<Shader> varying = CreateRef<SoftwareShader>("Varying", MakeStages(true));
+		TestSharedEdge(api, coverage);
+		TestNearPlaneClip(api, coverage);
+		TestPerspectiveCorrectVaryings(api, varying);
+	}
+	JobSystem::Shutdown();
+	return GE::Test::TestResult();
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdio>
+
+// ---------------------------------------------------------------------
+// 文件: TestUtils.h
+// 作用: 单元测试共用的检查宏
+// 描述: 每个测试是一个独立的可执行文件，EXPECT 失败时打印位置并计数，
+//       main 返回 TestResult()，由 CTest 根据退出码判断是否通过。
+// ---------------------------------------------------------------------
+
+namespace GE::Test {
+
+inline int& Failures() {
+	static int failures = 0;
+	return failures;
+}
+
+inline int TestResult() {
+	if (Failures() == 0) {
+		std::printf("All checks passed\n");
+	}
+	return Failures() == 0 ? 0 : 1;
+}
+}
+
+#define EXPECT(x) do { \
+		if (!(x)) { \
+			std::fprintf(stderr, "%s:%d: EXPECT(%s) failed\n", __FILE__, __LINE__, #x); \
+			GE::Test::Failures()++; \
+		} \
+	} while (0)
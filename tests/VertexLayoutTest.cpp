@@ -0,0 +1,68 @@
+#include "TestUtils.h"
+#include "engine_services/renderer/VertexLayout.h"
+#include <cstddef>
+
+using namespace GE;
+
+// 紧凑顶点：无填充
+struct CompactVertex {
+	Vec3 Position;
+	PackedSnorm1010102 Normal;
+	PackedHalf2 UV;
+};
+
+// 1 字节的成员之后是 4 字节对齐的成员，中间与末尾都有填充
+struct PaddedVertex {
+	bool Visible;
+	float Weight;
+	PackedShort4Norm Tangent;
+	bool Selected;
+};
+
+// 计算出的布局在编译期即可使用
+static constexpr BufferLayout s_CompactLayout = MakeLayout<&CompactVertex::Position, &CompactVertex::Normal, &CompactVertex::UV>(
+	{ "a_Position", "a_Normal", "a_UV" });
+static_assert(s_CompactLayout.GetStride() == sizeof(CompactVertex));
+static_assert(s_CompactLayout.GetElements()[1].Offset == offsetof(CompactVertex, Normal));
+static_assert(s_CompactLayout.GetElements()[2].Type == ShaderDataType::Half2);
+
+static void TestCompactLayout() {
+	const std::span<const BufferElement> elements = s_CompactLayout.GetElements();
+	EXPECT(elements.size() == 3);
+	EXPECT(elements[0].Offset == offsetof(CompactVertex, Position));
+	EXPECT(elements[1].Offset == offsetof(CompactVertex, Normal));
+	EXPECT(elements[2].Offset == offsetof(CompactVertex, UV));
+	EXPECT(elements[0].Type == ShaderDataType::Float3 && !elements[0].Normalized);
+	EXPECT(elements[1].Type == ShaderDataType::Int2_10_10_10_Rev && elements[1].Normalized);
+	EXPECT(std::string_view(elements[2].Name) == "a_UV");
+}
+
+// 偏移必须与编译器的实际排布一致，包括对齐产生的填充
+static void TestPaddedLayout() {
+	constexpr BufferLayout layout = MakeLayout<&PaddedVertex::Visible, &PaddedVertex::Weight, &PaddedVertex::Tangent,
+		&PaddedVertex::Selected>();
+	const std::span<const BufferElement> elements = layout.GetElements();
+	EXPECT(layout.GetStride() == sizeof(PaddedVertex));
+	EXPECT(elements[0].Offset == offsetof(PaddedVertex, Visible));
+	EXPECT(elements[1].Offset == offsetof(PaddedVertex, Weight));
+	EXPECT(elements[2].Offset == offsetof(PaddedVertex, Tangent));
+	EXPECT(elements[3].Offset == offsetof(PaddedVertex, Selected));
+	EXPECT(elements[2].Type == ShaderDataType::Short4Norm && elements[2].Normalized);
+	EXPECT(std::string_view(elements[0].Name).empty());
+}
+
+// 顺序错误的 MakeLayout 无法通过编译，这里直接检查它所用的编译期条件
+static void TestMemberOrderCheck() {
+	static_assert(MembersInDeclarationOrder<&CompactVertex::Position, &CompactVertex::Normal, &CompactVertex::UV>());
+	static_assert(MembersInDeclarationOrder<&CompactVertex::Position, &CompactVertex::UV>());
+	static_assert(!MembersInDeclarationOrder<&CompactVertex::Normal, &CompactVertex::Position, &CompactVertex::UV>());
+	static_assert(!MembersInDeclarationOrder<&PaddedVertex::Weight, &PaddedVertex::Visible>());
+	static_assert(!MembersInDeclarationOrder<&PaddedVertex::Weight, &PaddedVertex::Weight>());
+}
+
+int main() {
+	TestCompactLayout();
+	TestPaddedLayout();
+	TestMemberOrderCheck();
+	return GE::Test::TestResult();
+}
@@ -0,0 +1,222 @@
+#include "TestUtils.h"
+#include "engine_services/renderer/VertexPacking.h"
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+using namespace GE;
+
+static constexpr float s_Infinity = std::numeric_limits<float>::infinity();
+static const float s_NaN = std::numeric_limits<float>::quiet_NaN();
+
+static bool IsHalfNaN(uint16_t half) {
+	return (half & 0x7C00) == 0x7C00 && (half & 0x03FF) != 0;
+}
+
+// 按定义解码半精度数，作为参照
+static float DecodeHalf(uint16_t half) {
+	const float sign = (half & 0x8000) ? -1.0f : 1.0f;
+	const int exponent = (half >> 10) & 0x1F;
+	const int mantissa = half & 0x3FF;
+	if (exponent == 0) {
+		return sign * std::ldexp(static_cast<float>(mantissa), -24);
+	}
+	return sign * std::ldexp(static_cast<float>(mantissa + 1024), exponent - 25);
+}
+
+// 所有有限值（包括非规格化数）往返无损，Inf 保持，NaN 仍是 NaN 且符号不变
+static void TestHalfRoundTrip() {
+	for (uint32_t bits = 0; bits <= 0xFFFF; ++bits) {
+		const uint16_t half = static_cast<uint16_t>(bits);
+		const float value = HalfToFloat(half);
+		if (IsHalfNaN(half)) {
+			EXPECT(std::isnan(value));
+			const uint16_t back = FloatToHalf(value);
+			EXPECT(IsHalfNaN(back) && (back & 0x8000) == (half & 0x8000));
+			continue;
+		}
+		if ((half & 0x7FFF) == 0x7C00) {
+			EXPECT(std::isinf(value) && std::signbit(value) == ((half & 0x8000) != 0));
+		} else {
+			EXPECT(value == DecodeHalf(half));
+		}
+		EXPECT(FloatToHalf(value) == half);
+	}
+}
+
+// 两个相邻半精度数的中点舍入到尾数为偶数的一方，偏离中点时舍入到较近的一方
+static void TestHalfRounding() {
+	for (uint32_t bits = 0; bits < 0x7BFF; ++bits) {
+		const uint16_t low = static_cast<uint16_t>(bits);
+		const uint16_t high = static_cast<uint16_t>(bits + 1);
+		const float lowValue = DecodeHalf(low);
+		const float highValue = DecodeHalf(high);
+		const float middle = (lowValue + highValue) * 0.5f;
+		EXPECT(FloatToHalf(middle) == ((low & 1) == 0 ? low : high));
+		EXPECT(FloatToHalf(std::nextafter(middle, 0.0f)) == low);
+		EXPECT(FloatToHalf(std::nextafter(middle, s_Infinity)) == high);
+		EXPECT(FloatToHalf(-middle) == static_cast<uint16_t>(FloatToHalf(middle) | 0x8000));
+	}
+}
+
+static void TestHalfSpecialValues() {
+	// 非规格化数的边界
+	EXPECT(FloatToHalf(std::ldexp(1.0f, -24)) == 0x0001);
+	EXPECT(FloatToHalf(std::ldexp(1.0f, -25)) == 0x0000);
+	EXPECT(FloatToHalf(std::ldexp(1.5f, -25)) == 0x0001);
+	EXPECT(FloatToHalf(std::ldexp(1.0f, -14)) == 0x0400);
+	EXPECT(FloatToHalf(std::ldexp(1023.0f, -24)) == 0x03FF);
+	EXPECT(FloatToHalf(1e-10f) == 0x0000);
+	EXPECT(FloatToHalf(-1e-10f) == 0x8000);
+	// float 的非规格化数远小于半精度能表示的最小值
+	EXPECT(FloatToHalf(std::numeric_limits<float>::denorm_min()) == 0x0000);
+
+	// 溢出：65504 是最大的有限值，65520 是它与 65536 的中点，舍入为偶数即 Inf
+	EXPECT(FloatToHalf(65504.0f) == 0x7BFF);
+	EXPECT(FloatToHalf(65519.0f) == 0x7BFF);
+	EXPECT(FloatToHalf(65520.0f) == 0x7C00);
+	EXPECT(FloatToHalf(1e10f) == 0x7C00);
+	EXPECT(FloatToHalf(-1e10f) == 0xFC00);
+	EXPECT(FloatToHalf(s_Infinity) == 0x7C00);
+	EXPECT(FloatToHalf(-s_Infinity) == 0xFC00);
+	EXPECT(IsHalfNaN(FloatToHalf(s_NaN)));
+	EXPECT(IsHalfNaN(FloatToHalf(-s_NaN)));
+}
+
+// 批量接口与单值接口一致，末尾不足 4 个时不写出 count 之外的元素
+static void TestHalfBatch() {
+	const float source[7] = { 0.0f, -1.0f, 0.333f, 65504.0f, 1e-6f, s_Infinity, -2.5f };
+	uint16_t packed[8];
+	memset(packed, 0xCD, sizeof(packed));
+	PackHalf(source, packed, 7);
+	for (size_t i = 0; i < 7; ++i) {
+		EXPECT(packed[i] == FloatToHalf(source[i]));
+	}
+	EXPECT(packed[7] == 0xCDCD);
+
+	float unpacked[8];
+	unpacked[7] = 42.0f;
+	UnpackHalf(packed, unpacked, 7);
+	for (size_t i = 0; i < 7; ++i) {
+		EXPECT(unpacked[i] == HalfToFloat(packed[i]));
+	}
+	EXPECT(unpacked[7] == 42.0f);
+}
+
+// 超出范围的值截断到 [0, 1] / [-1, 1]，NaN 截断为下限；0.5 的中点按舍入到偶数处理
+static void TestNormalizedClamping() {
+	const float source[8] = { -1.0f, 0.0f, 0.5f, 1.0f, 2.0f, s_NaN, s_Infinity, -s_Infinity };
+
+	uint8_t unorm8[8];
+	PackUnorm8(source, unorm8, 8);
+	const uint8_t expectedUnorm8[8] = { 0, 0, 128, 255, 255, 0, 255, 0 };
+	EXPECT(memcmp(unorm8, expectedUnorm8, sizeof(unorm8)) == 0);
+
+	int8_t snorm8[8];
+	PackSnorm8(source, snorm8, 8);
+	const int8_t expectedSnorm8[8] = { -127, 0, 64, 127, 127, -127, 127, -127 };
+	EXPECT(memcmp(snorm8, expectedSnorm8, sizeof(snorm8)) == 0);
+
+	uint16_t unorm16[8];
+	PackUnorm16(source, unorm16, 8);
+	const uint16_t expectedUnorm16[8] = { 0, 0, 32768, 65535, 65535, 0, 65535, 0 };
+	EXPECT(memcmp(unorm16, expectedUnorm16, sizeof(unorm16)) == 0);
+
+	int16_t snorm16[8];
+	PackSnorm16(source, snorm16, 8);
+	const int16_t expectedSnorm16[8] = { -32767, 0, 16384, 32767, 32767, -32767, 32767, -32767 };
+	EXPECT(memcmp(snorm16, expectedSnorm16, sizeof(snorm16)) == 0);
+
+	// 有符号格式的最小编码值解码为 -1
+	const int8_t minByte = -128;
+	float decoded = 0.0f;
+	UnpackSnorm8(&minByte, &decoded, 1);
+	EXPECT(decoded == -1.0f);
+	const int16_t minShort = -32768;
+	UnpackSnorm16(&minShort, &decoded, 1);
+	EXPECT(decoded == -1.0f);
+}
+
+// 范围内的值往返误差不超过半个量化步长
+static void TestNormalizedRoundTrip() {
+	constexpr size_t count = 101;
+	float unitValues[count];
+	float signedValues[count];
+	for (size_t i = 0; i < count; ++i) {
+		unitValues[i] = static_cast<float>(i) / static_cast<float>(count - 1);
+		signedValues[i] = unitValues[i] * 2.0f - 1.0f;
+	}
+	float decoded[count];
+
+	uint8_t unorm8[count];
+	PackUnorm8(unitValues, unorm8, count);
+	UnpackUnorm8(unorm8, decoded, count);
+	for (size_t i = 0; i < count; ++i) {
+		EXPECT(std::abs(decoded[i] - unitValues[i]) <= 0.5f / 255.0f + 1e-6f);
+	}
+
+	int8_t snorm8[count];
+	PackSnorm8(signedValues, snorm8, count);
+	UnpackSnorm8(snorm8, decoded, count);
+	for (size_t i = 0; i < count; ++i) {
+		EXPECT(std::abs(decoded[i] - signedValues[i]) <= 0.5f / 127.0f + 1e-6f);
+	}
+
+	uint16_t unorm16[count];
+	PackUnorm16(unitValues, unorm16, count);
+	UnpackUnorm16(unorm16, decoded, count);
+	for (size_t i = 0; i < count; ++i) {
+		EXPECT(std::abs(decoded[i] - unitValues[i]) <= 0.5f / 65535.0f + 1e-6f);
+	}
+
+	int16_t snorm16[count];
+	PackSnorm16(signedValues, snorm16, count);
+	UnpackSnorm16(snorm16, decoded, count);
+	for (size_t i = 0; i < count; ++i) {
+		EXPECT(std::abs(decoded[i] - signedValues[i]) <= 0.5f / 32767.0f + 1e-6f);
+	}
+}
+
+static void TestSnorm1010102() {
+	// x = 511, y = 0, z = -511 (0x201), w = 1
+	EXPECT(PackSnorm1010102(1.0f, 0.0f, -1.0f, 1.0f) == (511u | (0x201u << 20) | (1u << 30)));
+	// w = -1 编码为 0b11
+	EXPECT(PackSnorm1010102(0.0f, 0.0f, 0.0f, -1.0f) == (3u << 30));
+	// 截断：超出范围与 Inf 截断到 ±1，NaN 截断为 -1
+	EXPECT(PackSnorm1010102(2.0f, s_Infinity, -s_Infinity, 5.0f) == PackSnorm1010102(1.0f, 1.0f, -1.0f, 1.0f));
+	EXPECT(PackSnorm1010102(s_NaN, 0.0f, 0.0f, 0.0f) == PackSnorm1010102(-1.0f, 0.0f, 0.0f, 0.0f));
+
+	// 5 个向量：一组完整的 4 个加上末尾的 1 个
+	const float normals[5 * 4] = {
+		0.0f, 0.0f, 1.0f, 1.0f,
+		0.6f, -0.8f, 0.0f, -1.0f,
+		0.57735f, 0.57735f, -0.57735f, 1.0f,
+		-1.0f, 0.0f, 0.0f, -1.0f,
+		0.1f, 0.2f, -0.3f, 1.0f,
+	};
+	uint32_t packed[6];
+	packed[5] = 0xDEADBEEF;
+	PackSnorm1010102(normals, packed, 5);
+	EXPECT(packed[5] == 0xDEADBEEF);
+	for (size_t i = 0; i < 5; ++i) {
+		EXPECT(packed[i] == PackSnorm1010102(normals[i * 4], normals[i * 4 + 1], normals[i * 4 + 2], normals[i * 4 + 3]));
+	}
+	float decoded[6 * 4];
+	decoded[20] = 42.0f;
+	UnpackSnorm1010102(packed, decoded, 5);
+	EXPECT(decoded[20] == 42.0f);
+	for (size_t i = 0; i < 5 * 4; ++i) {
+		EXPECT(std::abs(decoded[i] - normals[i]) <= 0.5f / 511.0f + 1e-6f);
+	}
+}
+
+int main() {
+	TestHalfRoundTrip();
+	TestHalfRounding();
+	TestHalfSpecialValues();
+	TestHalfBatch();
+	TestNormalizedClamping();
+	TestNormalizedRoundTrip();
+	TestSnorm1010102();
+	return GE::Test::TestResult();
+}